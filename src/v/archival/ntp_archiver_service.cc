@@ -14,6 +14,9 @@
 #include "archival/logger.h"
 #include "cloud_storage/partition_manifest.h"
 #include "cloud_storage/remote.h"
+#include "cloud_storage/remote_segment.h"
+#include "cloud_storage/remote_segment_index.h"
+#include "cloud_storage/segment_index_manifest.h"
 #include "cloud_storage/tx_range_manifest.h"
 #include "cloud_storage/types.h"
 #include "cluster/partition_manager.h"
@@ -50,7 +53,8 @@ ntp_archiver::ntp_archiver(
   cluster::partition_manager& partition_manager,
   const configuration& conf,
   cloud_storage::remote& remote,
-  ss::lw_shared_ptr<cluster::partition> part)
+  ss::lw_shared_ptr<cluster::partition> part,
+  upload_scheduler* scheduler)
   : _probe(conf.ntp_metrics_disabled, ntp.ntp())
   , _ntp(ntp.ntp())
   , _rev(ntp.get_initial_revision())
@@ -71,6 +75,14 @@ ntp_archiver::ntp_archiver(
   , _sync_manifest_timeout(
       config::shard_local_cfg()
         .cloud_storage_readreplica_manifest_sync_timeout_ms.bind())
+  , _multipart_upload_threshold(
+      config::shard_local_cfg().cloud_storage_multipart_upload_threshold.bind())
+  , _multipart_upload_part_size(
+      config::shard_local_cfg().cloud_storage_multipart_upload_part_size.bind())
+  , _multipart_upload_concurrency(
+      config::shard_local_cfg()
+        .cloud_storage_multipart_upload_concurrency.bind())
+  , _scheduler(scheduler)
   , _upload_sg(conf.upload_scheduling_group)
   , _io_priority(conf.upload_io_priority) {
     vassert(
@@ -366,9 +378,18 @@ ntp_archiver::upload_segment(upload_candidate candidate) {
 
     vlog(ctxlog.debug, "Uploading segment {} to {}", candidate, path);
 
-    auto reset_func = [this, candidate] {
-        return candidate.source->reader().data_stream(
+    // The data is charged to the bandwidth budget as it's streamed, the
+    // bytes sent by the failed attempts are not charged again on retry.
+    size_t charged = 0;
+    auto reset_func = [this, candidate, &charged]()
+      -> ss::future<storage::segment_reader_handle> {
+        auto handle = co_await candidate.source->reader().data_stream(
           candidate.file_offset, candidate.final_file_offset, _io_priority);
+        if (_scheduler != nullptr) {
+            handle.set_stream(
+              _scheduler->throttle_stream(handle.take_stream(), charged, _as));
+        }
+        co_return handle;
     };
 
     auto original_term = _partition->term();
@@ -391,6 +412,43 @@ ntp_archiver::upload_segment(upload_candidate candidate) {
           return lost_leadership;
       },
     };
+    if (_scheduler != nullptr) {
+        // Don't lease a client from the pool while the previous uploads are
+        // in bandwidth debt
+        co_await _scheduler->wait_for_budget(_as);
+    }
+    auto threshold = _multipart_upload_threshold();
+    if (threshold != 0 && candidate.content_length > threshold) {
+        const auto part_size = std::max<size_t>(
+          _multipart_upload_part_size(), 1);
+        std::vector<size_t> charged_parts(
+          (candidate.content_length + part_size - 1) / part_size);
+        auto reset_range_func =
+          [this, candidate, part_size, &charged_parts](
+            size_t offset,
+            size_t length) -> ss::future<storage::segment_reader_handle> {
+            auto begin = candidate.file_offset + offset;
+            auto handle = co_await candidate.source->reader().data_stream(
+              begin, begin + length, _io_priority);
+            if (_scheduler != nullptr) {
+                handle.set_stream(_scheduler->throttle_stream(
+                  handle.take_stream(),
+                  charged_parts[offset / part_size],
+                  _as));
+            }
+            co_return handle;
+        };
+        co_return co_await _remote.upload_segment_multipart(
+          _bucket,
+          path,
+          candidate.content_length,
+          reset_range_func,
+          part_size,
+          _multipart_upload_concurrency(),
+          fib,
+          lazy_abort_source);
+    }
+
     co_return co_await _remote.upload_segment(
       _bucket,
       path,
@@ -428,6 +486,52 @@ ntp_archiver::upload_tx(upload_candidate candidate) {
     co_return co_await _remote.upload_manifest(_bucket, manifest, fib);
 }
 
+ss::future<> ntp_archiver::upload_index(
+  upload_candidate candidate, model::offset delta) {
+    gate_guard guard{_gate};
+    retry_chain_node fib(
+      _segment_upload_timeout, _cloud_storage_initial_backoff, &_rtcnode);
+    retry_chain_logger ctxlog(archival_log, fib, _ntp.path());
+
+    auto path = cloud_storage::generate_remote_segment_path(
+      _ntp, _rev, candidate.exposed_name, _start_term);
+
+    vlog(ctxlog.debug, "Uploading segment index {}", candidate.exposed_name);
+
+    // The index is optional, readers hydrate the whole segment if it's
+    // missing, so failures are logged and otherwise ignored.
+    cloud_storage::offset_index ix(
+      candidate.starting_offset,
+      candidate.starting_offset - delta,
+      0,
+      cloud_storage::remote_segment_sampling_step_bytes);
+    auto parser = ss::make_lw_shared<storage::continuous_batch_parser>(
+      std::make_unique<cloud_storage::remote_segment_index_builder>(
+        ix, delta, cloud_storage::remote_segment_sampling_step_bytes),
+      co_await candidate.source->reader().data_stream(
+        candidate.file_offset, candidate.final_file_offset, _io_priority));
+    auto res = co_await parser->consume().finally(
+      [parser] { return parser->close(); });
+    if (res.has_error()) {
+        vlog(
+          ctxlog.warn,
+          "Failed to build index of segment {}: {}",
+          candidate.exposed_name,
+          res.error().message());
+        co_return;
+    }
+
+    cloud_storage::segment_index_manifest manifest(path, ix.to_iobuf());
+    auto result = co_await _remote.upload_manifest(_bucket, manifest, fib);
+    if (result != cloud_storage::upload_result::success) {
+        vlog(
+          ctxlog.warn,
+          "Failed to upload index of segment {}: {}",
+          candidate.exposed_name,
+          result);
+    }
+}
+
 ss::future<ntp_archiver::scheduled_upload> ntp_archiver::schedule_single_upload(
   model::offset start_upload_offset, model::offset last_stable_offset) {
     std::optional<storage::log> log = _partition_manager.log(_ntp);
@@ -522,10 +626,17 @@ ss::future<ntp_archiver::scheduled_upload> ntp_archiver::schedule_single_upload(
     auto segment_lock_deadline = std::chrono::steady_clock::now()
                                  + _segment_upload_timeout;
     // The upload is successful only if both segment and tx_range are uploaded.
+    // The segment index is optional and doesn't affect the result.
     auto upl_fut
-      = ss::when_all(upload_segment(upload), upload_tx(upload))
+      = ss::when_all(
+          upload_segment(upload),
+          upload_tx(upload),
+          upload_index(upload, delta).handle_exception(
+            [this](std::exception_ptr e) {
+                vlog(_rtclog.warn, "Failed to upload segment index: {}", e);
+            }))
           .then([](auto tup) {
-              auto [fs, ftx] = std::move(tup);
+              auto [fs, ftx, fix] = std::move(tup);
               auto rs = fs.get();
               auto rtx = ftx.get();
               if (
@@ -557,8 +668,48 @@ ss::future<ntp_archiver::scheduled_upload> ntp_archiver::schedule_single_upload(
     };
 }
 
+void ntp_archiver::update_upload_lag(model::offset last_stable_offset) {
+    auto start_upload_offset = _manifest.size() ? _manifest.get_last_offset()
+                                                    + model::offset(1)
+                                                : model::offset(0);
+    auto lag = last_stable_offset - start_upload_offset;
+    _probe.upload_lag(lag);
+    if (lag > model::offset(0)) {
+        if (
+          _lso_checkpoints.empty()
+          || _lso_checkpoints.back().first < last_stable_offset) {
+            if (_lso_checkpoints.size() < max_lso_checkpoints) {
+                _lso_checkpoints.emplace_back(
+                  last_stable_offset, ss::lowres_clock::now());
+            } else {
+                // The newest offsets are attributed to the previous
+                // checkpoint, this only overestimates their age
+                _lso_checkpoints.back().first = last_stable_offset;
+            }
+        }
+        while (_lso_checkpoints.front().first < start_upload_offset) {
+            _lso_checkpoints.pop_front();
+        }
+        _backlog_since = _lso_checkpoints.front().second;
+    } else {
+        _lso_checkpoints.clear();
+        _backlog_since = std::nullopt;
+    }
+    _probe.upload_backlog(estimate_backlog_size(), _backlog_since);
+}
+
+ss::future<upload_scheduler::slots> ntp_archiver::acquire_upload_slots() {
+    if (_scheduler == nullptr || !_backlog_since.has_value()) {
+        // Not scheduled or nothing to upload, no need to wait for the slots
+        return ss::make_ready_future<upload_scheduler::slots>(
+          upload_scheduler::slots(nullptr, _concurrency));
+    }
+    return _scheduler->acquire(_concurrency, *_backlog_since, _as);
+}
+
 ss::future<std::vector<ntp_archiver::scheduled_upload>>
-ntp_archiver::schedule_uploads(model::offset last_stable_offset) {
+ntp_archiver::schedule_uploads(
+  model::offset last_stable_offset, size_t max_uploads) {
     // We have to increment last offset to guarantee progress.
     // The manifest's last offset contains dirty_offset of the
     // latest uploaded segment but '_policy' requires offset that
@@ -573,22 +724,22 @@ ntp_archiver::schedule_uploads(model::offset last_stable_offset) {
       "scheduling uploads, start_upload_offset: {}, last_stable_offset: {}",
       start_upload_offset,
       last_stable_offset);
-    _probe.upload_lag(last_stable_offset - start_upload_offset);
 
     return ss::do_with(
       std::vector<scheduled_upload>(),
       size_t(0),
       start_upload_offset,
-      [this, last_stable_offset](
+      [this, last_stable_offset, max_uploads](
         std::vector<scheduled_upload>& scheduled,
         size_t& ix,
         model::offset& start_upload_offset) {
           return ss::repeat([this,
                              &start_upload_offset,
                              last_stable_offset,
+                             max_uploads,
                              &scheduled,
                              &ix] {
-                     if (ix == _concurrency) {
+                     if (ix == max_uploads) {
                          return ss::make_ready_future<ss::stop_iteration>(
                            ss::stop_iteration::yes);
                      }
@@ -720,10 +871,19 @@ ss::future<ntp_archiver::batch_result> ntp_archiver::upload_next_candidates(
              [this, last_stable_offset] {
                  return ss::with_semaphore(
                    _mutex, 1, [this, last_stable_offset] {
-                       return schedule_uploads(last_stable_offset)
-                         .then([this](std::vector<scheduled_upload> scheduled) {
-                             return wait_all_scheduled_uploads(
-                               std::move(scheduled));
+                       update_upload_lag(last_stable_offset);
+                       return acquire_upload_slots().then(
+                         [this, last_stable_offset](
+                           upload_scheduler::slots slots) {
+                             auto max_uploads = slots.count();
+                             return schedule_uploads(
+                                      last_stable_offset, max_uploads)
+                               .then([this](
+                                       std::vector<scheduled_upload> scheduled) {
+                                   return wait_all_scheduled_uploads(
+                                     std::move(scheduled));
+                               })
+                               .finally([slots = std::move(slots)] {});
                          });
                    });
              })
@@ -12,6 +12,7 @@
 #include "archival/archival_policy.h"
 #include "archival/probe.h"
 #include "archival/types.h"
+#include "archival/upload_scheduler.h"
 #include "cloud_storage/remote.h"
 #include "cloud_storage/types.h"
 #include "cluster/fwd.h"
@@ -28,6 +29,7 @@
 #include <seastar/core/lowres_clock.hh>
 #include <seastar/core/shared_ptr.hh>
 
+#include <deque>
 #include <functional>
 #include <map>
 
@@ -66,13 +68,16 @@ public:
     /// \param ntp is an ntp that archiver is responsible for
     /// \param conf is an S3 client configuration
     /// \param remote is an object used to send/recv data
-    /// \param svc_probe is a service level probe (optional)
+    /// \param scheduler is a shard-wide upload scheduler (optional), if
+    ///        not set the archiver doesn't share its upload slots and
+    ///        bandwidth with other partitions
     ntp_archiver(
       const storage::ntp_config& ntp,
       cluster::partition_manager&,
       const configuration& conf,
       cloud_storage::remote& remote,
-      ss::lw_shared_ptr<cluster::partition> part);
+      ss::lw_shared_ptr<cluster::partition> part,
+      upload_scheduler* scheduler = nullptr);
 
     /// Start the fiber that will upload the partition data to the cloud
     /// storage. Can be started only once.
@@ -127,7 +132,9 @@ public:
     /// \brief Upload next set of segments to S3 (if any)
     /// The semaphore is used to track number of parallel uploads. The method
     /// will pick not more than '_concurrency' candidates and start
-    /// uploading them.
+    /// uploading them. If the upload scheduler is set, the number of
+    /// candidates is limited by the number of upload slots that the
+    /// scheduler grants to the partition.
     ///
     /// \param lso_override last stable offset override
     /// \return future that returns number of uploaded/failed segments
@@ -171,9 +178,15 @@ private:
     ss::future<scheduled_upload> schedule_single_upload(
       model::offset last_uploaded_offset, model::offset last_stable_offset);
 
-    /// Start all uploads
+    /// Start not more than 'max_uploads' uploads
     ss::future<std::vector<scheduled_upload>>
-    schedule_uploads(model::offset last_stable_offset);
+    schedule_uploads(model::offset last_stable_offset, size_t max_uploads);
+
+    /// Update upload lag metrics and the age of the upload backlog
+    void update_upload_lag(model::offset last_stable_offset);
+
+    /// Acquire upload slots from the scheduler
+    ss::future<upload_scheduler::slots> acquire_upload_slots();
 
     /// Wait until all scheduled uploads will be completed
     ///
@@ -193,6 +206,12 @@ private:
     ss::future<cloud_storage::upload_result>
     upload_tx(upload_candidate candidate);
 
+    /// Build the offset index of the segment and upload it to S3 so readers
+    /// can fetch only the byte ranges they need.
+    ///
+    /// \param delta offset translator delta at the start of the segment
+    ss::future<> upload_index(upload_candidate candidate, model::offset delta);
+
     /// Upload manifest to the pre-defined S3 location
     ss::future<cloud_storage::upload_result> upload_manifest();
 
@@ -228,9 +247,23 @@ private:
     ss::lowres_clock::duration _upload_loop_initial_backoff;
     ss::lowres_clock::duration _upload_loop_max_backoff;
     config::binding<std::chrono::milliseconds> _sync_manifest_timeout;
+    config::binding<size_t> _multipart_upload_threshold;
+    config::binding<size_t> _multipart_upload_part_size;
+    config::binding<size_t> _multipart_upload_concurrency;
     simple_time_jitter<ss::lowres_clock> _backoff_jitter{100ms};
     size_t _concurrency{4};
     ss::lowres_clock::time_point _last_upload_time;
+    /// Time since the oldest data which is not uploaded yet became
+    /// available, the uploads of the partitions with older backlog are
+    /// scheduled first
+    std::optional<ss::lowres_clock::time_point> _backlog_since;
+    /// Last stable offsets seen by the upload loop and the time they were
+    /// first seen, all offsets up to the checkpoint were available at that
+    /// time. Checkpoints below the upload offset are dropped.
+    static constexpr size_t max_lso_checkpoints = 64;
+    std::deque<std::pair<model::offset, ss::lowres_clock::time_point>>
+      _lso_checkpoints;
+    upload_scheduler* _scheduler;
     ss::scheduling_group _upload_sg;
     ss::io_priority_class _io_priority;
 
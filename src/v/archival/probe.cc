@@ -64,6 +64,27 @@ ntp_level_probe::ntp_level_probe(
           sm::description("Pending offsets"),
           labels)
           .aggregate(aggregate_labels),
+        sm::make_gauge(
+          "pending_bytes",
+          [this] { return _pending_bytes; },
+          sm::description("Size of the data that ought to be uploaded"),
+          labels)
+          .aggregate(aggregate_labels),
+        sm::make_gauge(
+          "upload_lag_seconds",
+          [this] {
+              if (!_backlog_since.has_value()) {
+                  return 0.0;
+              }
+              std::chrono::duration<double> lag = ss::lowres_clock::now()
+                                                  - *_backlog_since;
+              return lag.count();
+          },
+          sm::description(
+            "Time since the oldest data which is not uploaded yet was "
+            "available"),
+          labels)
+          .aggregate(aggregate_labels),
       });
 }
 
@@ -15,9 +15,11 @@
 #include "model/fundamental.h"
 #include "seastarx.h"
 
+#include <seastar/core/lowres_clock.hh>
 #include <seastar/core/metrics_registration.hh>
 
 #include <cstdint>
+#include <optional>
 
 namespace archival {
 
@@ -43,6 +45,14 @@ public:
     /// Register the offset the ought to be uploaded
     void upload_lag(model::offset offset_delta) { _pending = offset_delta; }
 
+    /// Register the size of the data that ought to be uploaded and the
+    /// time since the partition has this data
+    void upload_backlog(
+      uint64_t bytes, std::optional<ss::lowres_clock::time_point> since) {
+        _pending_bytes = bytes;
+        _backlog_since = since;
+    }
+
 private:
     /// Uploaded offsets
     uint64_t _uploaded = 0;
@@ -52,6 +62,10 @@ private:
     int64_t _missing = 0;
     /// Width of the offset range yet to be uploaded
     int64_t _pending = 0;
+    /// Size of the data yet to be uploaded
+    uint64_t _pending_bytes = 0;
+    /// Time since the oldest data which is not uploaded yet was available
+    std::optional<ss::lowres_clock::time_point> _backlog_since;
 
     ss::metrics::metric_groups _metrics;
 };
@@ -137,7 +137,9 @@ scheduler_service_impl::scheduler_service_impl(
   , _remote(remote)
   , _topic_manifest_upload_timeout(conf.manifest_upload_timeout)
   , _initial_backoff(conf.cloud_storage_initial_backoff)
-  , _upload_sg(conf.upload_scheduling_group) {}
+  , _upload_sg(conf.upload_scheduling_group)
+  , _upload_scheduler(
+      remote.local().concurrency(), conf.svc_metrics_disabled) {}
 
 scheduler_service_impl::scheduler_service_impl(
   ss::sharded<cloud_storage::remote>& remote,
@@ -176,6 +178,7 @@ ss::future<> scheduler_service_impl::stop() {
     return ss::do_with(
       std::move(outstanding), [this](std::vector<ss::future<>>& outstanding) {
           return ss::when_all_succeed(outstanding.begin(), outstanding.end())
+            .finally([this] { return _upload_scheduler.stop(); })
             .finally([this] { return _gate.close(); });
       });
 }
@@ -313,7 +316,8 @@ scheduler_service_impl::create_archivers(std::vector<model::ntp> to_create) {
                 _partition_manager.local(),
                 _conf,
                 _remote.local(),
-                part);
+                part,
+                &_upload_scheduler);
               return add_ntp_archiver(archiver);
           } else {
               return ss::now();
@@ -10,6 +10,7 @@
 
 #pragma once
 #include "archival/ntp_archiver_service.h"
+#include "archival/upload_scheduler.h"
 #include "cluster/fwd.h"
 #include "model/fundamental.h"
 #include "s3/client.h"
@@ -136,6 +137,8 @@ private:
     ss::lowres_clock::duration _topic_manifest_upload_timeout;
     ss::lowres_clock::duration _initial_backoff;
     ss::scheduling_group _upload_sg;
+    /// Upload slots and bandwidth shared by all archivers of the shard
+    upload_scheduler _upload_scheduler;
 };
 
 } // namespace internal
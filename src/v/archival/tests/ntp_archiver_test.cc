@@ -13,6 +13,7 @@
 #include "archival/tests/service_fixture.h"
 #include "bytes/iobuf.h"
 #include "cloud_storage/remote.h"
+#include "cloud_storage/segment_index_manifest.h"
 #include "cloud_storage/types.h"
 #include "model/metadata.h"
 #include "net/unresolved_address.h"
@@ -138,7 +139,8 @@ FIXTURE_TEST(test_upload_segments, archiver_fixture) {
     for (auto [url, req] : get_targets()) {
         vlog(test_log.info, "{} {}", req._method, req._url);
     }
-    BOOST_REQUIRE_EQUAL(get_requests().size(), 3);
+    // manifest, 2 segments and their indexes
+    BOOST_REQUIRE_EQUAL(get_requests().size(), 5);
 
     cloud_storage::partition_manifest manifest;
     {
@@ -158,6 +160,12 @@ FIXTURE_TEST(test_upload_segments, archiver_fixture) {
         const auto& [url, req] = *it;
         BOOST_REQUIRE_EQUAL(req._method, "PUT"); // NOLINT
         verify_segment(manifest_ntp, segment1_name, req.content);
+
+        auto index_url = cloud_storage::generate_remote_index_path(
+          segment1_url);
+        auto ix = get_targets().find("/" + index_url().string());
+        BOOST_REQUIRE(ix != get_targets().end());
+        BOOST_REQUIRE_EQUAL(ix->second._method, "PUT"); // NOLINT
     }
 
     {
@@ -381,7 +389,8 @@ FIXTURE_TEST(test_upload_segments_leadership_transfer, archiver_fixture) {
     for (auto req : get_requests()) {
         vlog(test_log.info, "{} {}", req._method, req._url);
     }
-    BOOST_REQUIRE_EQUAL(get_requests().size(), 4);
+    // manifest GET and PUT, 2 segments and their indexes
+    BOOST_REQUIRE_EQUAL(get_requests().size(), 6);
 
     cloud_storage::partition_manifest manifest;
     {
@@ -600,7 +609,8 @@ static void test_partial_upload_impl(
     for (auto req : test.get_requests()) {
         vlog(test_log.info, "{} {}", req._method, req._url);
     }
-    BOOST_REQUIRE_EQUAL(test.get_requests().size(), 3);
+    // manifest GET and PUT, segment and its index
+    BOOST_REQUIRE_EQUAL(test.get_requests().size(), 4);
 
     {
         auto [begin, end] = test.get_targets().equal_range(manifest_url);
@@ -641,7 +651,7 @@ static void test_partial_upload_impl(
     BOOST_REQUIRE_EQUAL(res.num_succeded, 1);
     BOOST_REQUIRE_EQUAL(res.num_failed, 0);
 
-    BOOST_REQUIRE_EQUAL(test.get_requests().size(), 5);
+    BOOST_REQUIRE_EQUAL(test.get_requests().size(), 7);
     {
         auto [begin, end] = test.get_targets().equal_range(manifest_url);
         size_t len = std::distance(begin, end);
@@ -0,0 +1,199 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "archival/upload_scheduler.h"
+#include "bytes/iobuf.h"
+#include "config/configuration.h"
+#include "units.h"
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <chrono>
+#include <optional>
+#include <vector>
+
+using namespace std::chrono_literals;
+using archival::upload_scheduler;
+
+namespace {
+
+struct config_override {
+    explicit config_override(
+      std::optional<size_t> max_uploads,
+      std::optional<size_t> bandwidth = std::nullopt) {
+        config::shard_local_cfg().cloud_storage_max_concurrent_uploads.set_value(
+          max_uploads);
+        config::shard_local_cfg().cloud_storage_upload_bandwidth_limit.set_value(
+          bandwidth);
+    }
+    ~config_override() {
+        config::shard_local_cfg().cloud_storage_max_concurrent_uploads.set_value(
+          std::optional<size_t>{});
+        config::shard_local_cfg().cloud_storage_upload_bandwidth_limit.set_value(
+          std::optional<size_t>{});
+    }
+};
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_upload_scheduler_fair_share) {
+    config_override cfg(4);
+    upload_scheduler sched(20, archival::service_metrics_disabled::yes);
+    ss::abort_source as;
+    auto now = ss::lowres_clock::now();
+
+    BOOST_REQUIRE_EQUAL(sched.total_slots(), 4);
+
+    // The first partition gets everything it asks for
+    auto s1 = sched.acquire(2, now, as).get();
+    BOOST_REQUIRE_EQUAL(s1.count(), 2);
+    BOOST_REQUIRE_EQUAL(sched.available_slots(), 2);
+
+    // Two contenders, the second partition gets half of the slots
+    auto s2 = sched.acquire(4, now, as).get();
+    BOOST_REQUIRE_EQUAL(s2.count(), 2);
+    BOOST_REQUIRE_EQUAL(sched.available_slots(), 0);
+
+    // The third partition has to wait until the slots are released
+    auto f3 = sched.acquire(4, now, as);
+    BOOST_REQUIRE(!f3.available());
+    BOOST_REQUIRE_EQUAL(sched.waiters(), 1);
+
+    // The waiter can't take all slots since the second partition is
+    // still holding its share
+    s1 = upload_scheduler::slots(nullptr, 0);
+    auto s3 = f3.get();
+    BOOST_REQUIRE_EQUAL(s3.count(), 2);
+    BOOST_REQUIRE_EQUAL(sched.available_slots(), 0);
+
+    // Released slots are returned to the scheduler
+    s2 = upload_scheduler::slots(nullptr, 0);
+    s3 = upload_scheduler::slots(nullptr, 0);
+    BOOST_REQUIRE_EQUAL(sched.available_slots(), 4);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_upload_scheduler_oldest_backlog_first) {
+    config_override cfg(1);
+    upload_scheduler sched(20, archival::service_metrics_disabled::yes);
+    ss::abort_source as;
+    auto now = ss::lowres_clock::now();
+
+    auto holder = std::make_optional(sched.acquire(1, now, as).get());
+
+    // Requests are queued out of order, the one with the oldest backlog
+    // should be served first.
+    std::vector<int> order;
+    auto f_new = sched.acquire(1, now, as).then([&order](auto s) {
+        order.push_back(0);
+        return s;
+    });
+    auto f_old = sched.acquire(1, now - 10s, as).then([&order](auto s) {
+        order.push_back(1);
+        return s;
+    });
+    auto f_mid = sched.acquire(1, now - 5s, as).then([&order](auto s) {
+        order.push_back(2);
+        return s;
+    });
+    BOOST_REQUIRE_EQUAL(sched.waiters(), 3);
+
+    holder = std::nullopt;
+    f_old.get();
+    f_mid.get();
+    f_new.get();
+    BOOST_REQUIRE_EQUAL(order.size(), 3);
+    BOOST_REQUIRE_EQUAL(order[0], 1);
+    BOOST_REQUIRE_EQUAL(order[1], 2);
+    BOOST_REQUIRE_EQUAL(order[2], 0);
+    BOOST_REQUIRE_EQUAL(sched.available_slots(), 1);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_upload_scheduler_abort_waiter) {
+    config_override cfg(1);
+    upload_scheduler sched(20, archival::service_metrics_disabled::yes);
+    ss::abort_source as1;
+    ss::abort_source as2;
+    auto now = ss::lowres_clock::now();
+
+    auto s1 = sched.acquire(1, now, as1).get();
+    auto f2 = sched.acquire(1, now, as2);
+    as2.request_abort();
+    BOOST_REQUIRE_THROW(f2.get(), ss::abort_requested_exception);
+    BOOST_REQUIRE_EQUAL(sched.waiters(), 0);
+
+    auto f3 = sched.acquire(1, now, as1);
+    sched.stop().get();
+    BOOST_REQUIRE_THROW(f3.get(), ss::abort_requested_exception);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_upload_scheduler_throttle) {
+    // 1MiB/s, the bucket starts empty
+    constexpr size_t rate = 1_MiB;
+    config_override cfg(std::nullopt, rate);
+    upload_scheduler sched(20, archival::service_metrics_disabled::yes);
+    ss::abort_source as;
+
+    auto start = ss::lowres_clock::now();
+    sched.throttle(rate / 4, as).get();
+    sched.throttle(rate / 4, as).get();
+    auto elapsed = ss::lowres_clock::now() - start;
+    // Half of the second worth of data should take roughly half of the second
+    BOOST_REQUIRE(elapsed >= 400ms);
+    BOOST_REQUIRE(elapsed < 2s);
+
+    // The bucket is empty, the wait can be aborted
+    auto f = sched.throttle(rate, as);
+    as.request_abort();
+    BOOST_REQUIRE_THROW(f.get(), ss::abort_requested_exception);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_upload_scheduler_throttle_stream) {
+    constexpr size_t rate = 1_MiB;
+    config_override cfg(std::nullopt, rate);
+    upload_scheduler sched(20, archival::service_metrics_disabled::yes);
+    ss::abort_source as;
+
+    iobuf data;
+    data.append(ss::temporary_buffer<char>(rate / 4));
+    size_t charged = 0;
+    auto read_all = [&] {
+        auto in = sched.throttle_stream(
+          make_iobuf_input_stream(data.copy()), charged, as);
+        while (!in.read().get().empty()) {
+        }
+        in.close().get();
+    };
+
+    auto start = ss::lowres_clock::now();
+    read_all();
+    auto elapsed = ss::lowres_clock::now() - start;
+    BOOST_REQUIRE_EQUAL(charged, rate / 4);
+    BOOST_REQUIRE(elapsed >= 150ms);
+
+    // The retry of the same upload isn't charged again
+    start = ss::lowres_clock::now();
+    read_all();
+    elapsed = ss::lowres_clock::now() - start;
+    BOOST_REQUIRE_EQUAL(charged, rate / 4);
+    BOOST_REQUIRE(elapsed < 100ms);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_upload_scheduler_unlimited_bandwidth) {
+    config_override cfg(std::nullopt);
+    upload_scheduler sched(20, archival::service_metrics_disabled::yes);
+    ss::abort_source as;
+
+    BOOST_REQUIRE_EQUAL(sched.total_slots(), 20);
+    auto f = sched.throttle(1_GiB, as);
+    BOOST_REQUIRE(f.available());
+    f.get();
+}
@@ -0,0 +1,277 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "archival/upload_scheduler.h"
+
+#include "archival/logger.h"
+#include "config/configuration.h"
+#include "prometheus/prometheus_sanitize.h"
+#include "vlog.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/metrics.hh>
+#include <seastar/core/sleep.hh>
+#include <seastar/core/smp.hh>
+
+#include <algorithm>
+#include <chrono>
+
+namespace archival {
+
+namespace {
+/// Split the node-wide limit between shards, every shard gets at least one
+/// unit of the resource.
+size_t per_shard(size_t node_limit) {
+    return std::max<size_t>(
+      1, (node_limit + ss::smp::count - 1) / ss::smp::count);
+}
+} // namespace
+
+void upload_scheduler::slots::release() noexcept {
+    if (_parent != nullptr && _count > 0) {
+        _parent->release(_count);
+    }
+    _parent = nullptr;
+    _count = 0;
+}
+
+upload_scheduler::upload_scheduler(
+  size_t default_slots, service_metrics_disabled disabled)
+  : _default_slots(std::max<size_t>(1, default_slots))
+  , _max_concurrent_uploads(
+      config::shard_local_cfg().cloud_storage_max_concurrent_uploads.bind())
+  , _bandwidth_limit(
+      config::shard_local_cfg().cloud_storage_upload_bandwidth_limit.bind())
+  , _last_refill(ss::lowres_clock::now()) {
+    // The limit can be increased at runtime, let the waiters use the
+    // new slots.
+    _max_concurrent_uploads.watch([this] { notify_waiters(); });
+    setup_metrics(disabled);
+}
+
+ss::future<> upload_scheduler::stop() {
+    _stopped = true;
+    auto waiters = std::exchange(_waiters, {});
+    for (auto& [_, w] : waiters) {
+        w->sub.reset();
+        w->promise.set_exception(ss::abort_requested_exception());
+    }
+    return ss::now();
+}
+
+size_t upload_scheduler::total_slots() const {
+    auto limit = _max_concurrent_uploads();
+    if (limit.has_value()) {
+        return per_shard(*limit);
+    }
+    return _default_slots;
+}
+
+size_t upload_scheduler::fair_share(size_t requested) const {
+    // Every partition that holds or waits for the slots gets an equal share
+    // of the shard's slots, the new request is one of the contenders.
+    auto contenders = _holders + std::max<size_t>(1, _waiters.size());
+    auto share = std::max<size_t>(1, total_slots() / contenders);
+    return std::min({std::max<size_t>(1, requested), share, available_slots()});
+}
+
+ss::future<upload_scheduler::slots> upload_scheduler::acquire(
+  size_t requested,
+  ss::lowres_clock::time_point backlog_since,
+  ss::abort_source& as) {
+    if (_stopped || as.abort_requested()) {
+        return ss::make_exception_future<slots>(
+          ss::abort_requested_exception());
+    }
+    if (_waiters.empty() && available_slots() > 0) {
+        auto count = fair_share(requested);
+        _used_slots += count;
+        _holders++;
+        return ss::make_ready_future<slots>(slots(this, count));
+    }
+    auto w = ss::make_lw_shared<waiter>(waiter{.requested = requested});
+    auto it = _waiters.emplace(backlog_since, w);
+    w->sub = as.subscribe([this, it]() noexcept {
+        it->second->promise.set_exception(ss::abort_requested_exception());
+        _waiters.erase(it);
+    });
+    vlog(
+      archival_log.trace,
+      "Upload slots are not available, {} requests are waiting",
+      _waiters.size());
+    // The waiter owns the abort subscription, keep it alive until the
+    // future is resolved so the subscription is not destroyed from its own
+    // callback.
+    return w->promise.get_future().finally([w] {});
+}
+
+void upload_scheduler::release(size_t count) noexcept {
+    vassert(
+      _used_slots >= count && _holders > 0,
+      "Releasing {} upload slots, {} slots are used by {} partitions",
+      count,
+      _used_slots,
+      _holders);
+    _used_slots -= count;
+    _holders--;
+    notify_waiters();
+}
+
+void upload_scheduler::notify_waiters() {
+    while (!_waiters.empty() && available_slots() > 0) {
+        auto it = _waiters.begin();
+        auto count = fair_share(it->second->requested);
+        auto w = it->second;
+        _waiters.erase(it);
+        w->sub.reset();
+        _used_slots += count;
+        _holders++;
+        w->promise.set_value(slots(this, count));
+    }
+}
+
+std::optional<size_t> upload_scheduler::bandwidth_limit() const {
+    auto limit = _bandwidth_limit();
+    if (!limit.has_value() || *limit == 0) {
+        return std::nullopt;
+    }
+    return per_shard(*limit);
+}
+
+void upload_scheduler::refill_tokens() {
+    auto now = ss::lowres_clock::now();
+    auto limit = bandwidth_limit();
+    if (limit.has_value()) {
+        // The bucket can hold one second worth of uploads
+        auto capacity = static_cast<int64_t>(*limit);
+        std::chrono::duration<double> elapsed = now - _last_refill;
+        auto refill = static_cast<int64_t>(
+          elapsed.count() * static_cast<double>(*limit));
+        _tokens = std::min(capacity, _tokens + refill);
+    }
+    _last_refill = now;
+}
+
+ss::future<> upload_scheduler::throttle(size_t bytes, ss::abort_source& as) {
+    if (!bandwidth_limit().has_value()) {
+        return ss::now();
+    }
+    refill_tokens();
+    _tokens -= static_cast<int64_t>(bytes);
+    if (_tokens >= 0) {
+        return ss::now();
+    }
+    _throttled_bytes += bytes;
+    return wait_for_budget(as);
+}
+
+ss::future<> upload_scheduler::wait_for_budget(ss::abort_source& as) {
+    auto limit = bandwidth_limit();
+    if (!limit.has_value()) {
+        co_return;
+    }
+    refill_tokens();
+    if (_tokens >= 0) {
+        co_return;
+    }
+    std::chrono::duration<double> debt(
+      static_cast<double>(-_tokens) / static_cast<double>(*limit));
+    auto delay = std::chrono::duration_cast<ss::lowres_clock::duration>(debt);
+    _throttled_time += delay;
+    vlog(
+      archival_log.debug,
+      "Upload is throttled for {}ms, bandwidth debt {} bytes",
+      std::chrono::duration_cast<std::chrono::milliseconds>(delay).count(),
+      -_tokens);
+    co_await ss::sleep_abortable<ss::lowres_clock>(delay, as);
+}
+
+namespace {
+/// Charges the data to the bandwidth budget of the scheduler as it's read
+class throttled_data_source final : public ss::data_source_impl {
+public:
+    throttled_data_source(
+      upload_scheduler& scheduler,
+      ss::input_stream<char> in,
+      size_t& charged,
+      ss::abort_source& as)
+      : _scheduler(scheduler)
+      , _in(std::move(in))
+      , _charged(charged)
+      , _as(as) {}
+
+    ss::future<ss::temporary_buffer<char>> get() override {
+        auto buf = co_await _in.read();
+        _pos += buf.size();
+        if (_pos > _charged) {
+            auto bytes = _pos - _charged;
+            _charged = _pos;
+            co_await _scheduler.throttle(bytes, _as);
+        }
+        co_return buf;
+    }
+
+    ss::future<> close() override { return _in.close(); }
+
+private:
+    upload_scheduler& _scheduler;
+    ss::input_stream<char> _in;
+    size_t& _charged;
+    ss::abort_source& _as;
+    size_t _pos{0};
+};
+} // namespace
+
+ss::input_stream<char> upload_scheduler::throttle_stream(
+  ss::input_stream<char> in, size_t& charged, ss::abort_source& as) {
+    return ss::input_stream<char>(ss::data_source(
+      std::make_unique<throttled_data_source>(
+        *this, std::move(in), charged, as)));
+}
+
+void upload_scheduler::setup_metrics(service_metrics_disabled disabled) {
+    if (disabled) {
+        return;
+    }
+    namespace sm = ss::metrics;
+
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("archival_upload_scheduler"),
+      {
+        sm::make_gauge(
+          "slots_total",
+          [this] { return total_slots(); },
+          sm::description("Number of upload slots of the shard")),
+        sm::make_gauge(
+          "slots_used",
+          [this] { return _used_slots; },
+          sm::description("Number of upload slots used by partitions")),
+        sm::make_gauge(
+          "waiters",
+          [this] { return _waiters.size(); },
+          sm::description("Number of partitions waiting for upload slots")),
+        sm::make_total_bytes(
+          "throttled_bytes",
+          [this] { return _throttled_bytes; },
+          sm::description(
+            "Total number of bytes delayed by the upload bandwidth limit")),
+        sm::make_counter(
+          "throttled_ms",
+          [this] {
+              return std::chrono::duration_cast<std::chrono::milliseconds>(
+                       _throttled_time)
+                .count();
+          },
+          sm::description(
+            "Total time uploads were delayed by the bandwidth limit (ms)")),
+      });
+}
+
+} // namespace archival
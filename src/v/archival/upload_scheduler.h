@@ -0,0 +1,176 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "archival/types.h"
+#include "config/property.h"
+#include "seastarx.h"
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/future.hh>
+#include <seastar/core/iostream.hh>
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/metrics_registration.hh>
+
+#include <map>
+#include <optional>
+
+namespace archival {
+
+/// \brief Shard-local scheduler of the archival uploads
+///
+/// All ntp_archiver instances of the shard share two resources:
+/// - upload slots, every slot allows one segment upload to run. Partitions
+///   ask for several slots and get their fair share of the available slots.
+///   When there are no free slots the requests are queued and served in
+///   order of backlog age, so the partition which has been waiting for the
+///   upload the longest goes first.
+/// - upload bandwidth, the token bucket limits the rate at which the data
+///   is sent to the cloud storage.
+///
+/// Both limits are configured per node and split evenly between shards.
+class upload_scheduler {
+public:
+    /// Set of upload slots acquired by the partition. The slots are
+    /// returned to the scheduler when the object is destroyed.
+    class slots {
+    public:
+        slots(upload_scheduler* parent, size_t count) noexcept
+          : _parent(parent)
+          , _count(count) {}
+        slots(slots&& other) noexcept
+          : _parent(std::exchange(other._parent, nullptr))
+          , _count(std::exchange(other._count, 0)) {}
+        slots& operator=(slots&& other) noexcept {
+            if (this != &other) {
+                release();
+                _parent = std::exchange(other._parent, nullptr);
+                _count = std::exchange(other._count, 0);
+            }
+            return *this;
+        }
+        slots(const slots&) = delete;
+        slots& operator=(const slots&) = delete;
+        ~slots() noexcept { release(); }
+
+        size_t count() const { return _count; }
+
+    private:
+        void release() noexcept;
+
+        upload_scheduler* _parent;
+        size_t _count;
+    };
+
+    /// \param default_slots is the number of upload slots of the shard used
+    ///        when the node-wide limit is not set
+    upload_scheduler(size_t default_slots, service_metrics_disabled disabled);
+
+    upload_scheduler(const upload_scheduler&) = delete;
+    upload_scheduler& operator=(const upload_scheduler&) = delete;
+    upload_scheduler(upload_scheduler&&) = delete;
+    upload_scheduler& operator=(upload_scheduler&&) = delete;
+    ~upload_scheduler() = default;
+
+    /// Fail all pending requests
+    ss::future<> stop();
+
+    /// \brief Acquire upload slots
+    ///
+    /// Waits until at least one slot is available. The number of acquired
+    /// slots is limited by 'requested' and by the fair share of the
+    /// partition.
+    /// \param requested is a max number of slots that the partition can use
+    /// \param backlog_since is the time since the partition has data that
+    ///        waits for upload, the requests with older backlog are served
+    ///        first
+    /// \param as is an abort source of the partition
+    ss::future<slots> acquire(
+      size_t requested,
+      ss::lowres_clock::time_point backlog_since,
+      ss::abort_source& as);
+
+    /// \brief Wait until the bandwidth budget allows to upload 'bytes'
+    ///
+    /// The bucket can go into debt so large uploads don't have to wait
+    /// until the bucket can hold all of their bytes. The following
+    /// requests wait until the debt is repaid.
+    ss::future<> throttle(size_t bytes, ss::abort_source& as);
+
+    /// Wait until the bandwidth debt of the previous uploads is repaid
+    ss::future<> wait_for_budget(ss::abort_source& as);
+
+    /// \brief Wrap the stream so its data is charged to the bandwidth
+    /// budget as it's read
+    ///
+    /// \param charged is the number of bytes of the stream charged by the
+    ///        previous attempts to upload it, these bytes are not charged
+    ///        again. It's updated as the stream is read and has to outlive
+    ///        the stream.
+    ss::input_stream<char> throttle_stream(
+      ss::input_stream<char> in, size_t& charged, ss::abort_source& as);
+
+    /// Total number of the slots of the shard
+    size_t total_slots() const;
+
+    /// Number of slots which are not acquired by any partition
+    size_t available_slots() const {
+        auto total = total_slots();
+        return total > _used_slots ? total - _used_slots : 0;
+    }
+
+    /// Number of requests waiting for the slots
+    size_t waiters() const { return _waiters.size(); }
+
+private:
+    struct waiter {
+        size_t requested;
+        ss::promise<slots> promise;
+        std::optional<ss::abort_source::subscription> sub;
+    };
+    using waiters_t
+      = std::multimap<ss::lowres_clock::time_point, ss::lw_shared_ptr<waiter>>;
+
+    /// Number of slots granted to the request
+    size_t fair_share(size_t requested) const;
+
+    void release(size_t count) noexcept;
+
+    /// Grant slots to the waiters in order of backlog age
+    void notify_waiters();
+
+    /// Bandwidth limit of the shard in bytes per second, nullopt if
+    /// the bandwidth is not limited
+    std::optional<size_t> bandwidth_limit() const;
+
+    void refill_tokens();
+
+    void setup_metrics(service_metrics_disabled disabled);
+
+    size_t _default_slots;
+    config::binding<std::optional<size_t>> _max_concurrent_uploads;
+    config::binding<std::optional<size_t>> _bandwidth_limit;
+    size_t _used_slots{0};
+    /// Number of partitions holding the slots
+    size_t _holders{0};
+    waiters_t _waiters;
+    /// Token bucket state, the tokens can be negative (debt)
+    int64_t _tokens{0};
+    ss::lowres_clock::time_point _last_refill;
+    /// Total number of bytes that had to wait for the bandwidth budget
+    uint64_t _throttled_bytes{0};
+    /// Total time spent waiting for the bandwidth budget
+    ss::lowres_clock::duration _throttled_time{0};
+    bool _stopped{false};
+    ss::metrics::metric_groups _metrics;
+};
+
+} // namespace archival
@@ -0,0 +1,193 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "bytes/details/io_fragment_pool.h"
+
+#include <seastar/core/deleter.hh>
+#include <seastar/core/metrics.hh>
+#include <seastar/core/smp.hh>
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+namespace details {
+
+// buffers may outlive the pool of their shard when it is destroyed on exit
+static thread_local bool pool_destroyed = false;
+
+io_fragment_pool::~io_fragment_pool() noexcept {
+    pool_destroyed = true;
+    trim(0);
+}
+
+io_fragment_pool& io_fragment_pool::local() {
+    static thread_local io_fragment_pool pool;
+    return pool;
+}
+
+std::optional<size_t> io_fragment_pool::size_class(size_t size) {
+    const auto& table = io_allocation_size::alloc_table;
+    auto it = std::lower_bound(table.begin(), table.end(), size);
+    if (it == table.end() || *it != size) {
+        return std::nullopt;
+    }
+    return static_cast<size_t>(std::distance(table.begin(), it));
+}
+
+void io_fragment_pool::configure(config cfg) {
+    cfg.low_watermark = std::min(cfg.low_watermark, cfg.high_watermark);
+    trim(cfg.high_watermark);
+    _cfg = cfg;
+
+    if (!enabled()) {
+        _reclaimer.reset();
+        return;
+    }
+
+    // the free lists never grow past their capacity so that releasing a
+    // buffer, which may happen during reclaim, never allocates
+    for (size_t cls = 0; cls < size_classes; ++cls) {
+        _free[cls].reserve(
+          _cfg.high_watermark / io_allocation_size::alloc_table[cls]);
+    }
+
+    if (!_reclaimer) {
+        _reclaimer = std::make_unique<ss::memory::reclaimer>(
+          [this](ss::memory::reclaimer::request) {
+              auto reclaimed = trim(_cfg.low_watermark);
+              if (reclaimed == 0) {
+                  return ss::memory::reclaiming_result::reclaimed_nothing;
+              }
+              ++_stats.reclaims;
+              _stats.reclaimed_bytes += reclaimed;
+              return ss::memory::reclaiming_result::reclaimed_something;
+          },
+          ss::memory::reclaimer_scope::sync);
+    }
+}
+
+ss::temporary_buffer<char> io_fragment_pool::allocate(size_t size) {
+    auto cls = enabled() ? size_class(size) : std::nullopt;
+    if (!cls) {
+        return ss::temporary_buffer<char>(size);
+    }
+
+    char* buf = nullptr;
+    if (auto& free = _free[*cls]; !free.empty()) {
+        buf = free.back();
+        free.pop_back();
+        _stats.cached_bytes -= size;
+        ++_stats.hits;
+    } else {
+        // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+        buf = static_cast<char*>(std::malloc(size));
+        if (!buf) {
+            throw std::bad_alloc();
+        }
+        ++_stats.misses;
+    }
+
+    try {
+        return ss::temporary_buffer<char>(
+          buf,
+          size,
+          ss::make_deleter([buf, cls = *cls, owner = ss::this_shard_id()] {
+              release(buf, cls, owner);
+          }));
+    } catch (...) {
+        push(buf, *cls);
+        throw;
+    }
+}
+
+void io_fragment_pool::release(
+  char* buf, size_t cls, ss::shard_id owner) noexcept {
+    // fragments freed on another shard go back to the allocator which returns
+    // them to the shard owning the memory
+    if (owner != ss::this_shard_id() || pool_destroyed) {
+        std::free(buf); // NOLINT(cppcoreguidelines-no-malloc)
+        return;
+    }
+    local().push(buf, cls);
+}
+
+void io_fragment_pool::push(char* buf, size_t cls) noexcept {
+    const size_t size = io_allocation_size::alloc_table[cls];
+    auto& free = _free[cls];
+    if (
+      _stats.cached_bytes + size > _cfg.high_watermark
+      || free.size() == free.capacity()) {
+        std::free(buf); // NOLINT(cppcoreguidelines-no-malloc)
+        ++_stats.overflows;
+        return;
+    }
+    free.push_back(buf);
+    _stats.cached_bytes += size;
+}
+
+size_t io_fragment_pool::trim(size_t target) noexcept {
+    size_t freed = 0;
+    for (size_t cls = size_classes; cls-- > 0;) {
+        const size_t size = io_allocation_size::alloc_table[cls];
+        auto& free = _free[cls];
+        while (_stats.cached_bytes > target && !free.empty()) {
+            std::free(free.back()); // NOLINT(cppcoreguidelines-no-malloc)
+            free.pop_back();
+            _stats.cached_bytes -= size;
+            freed += size;
+        }
+    }
+    return freed;
+}
+
+void io_fragment_pool::setup_metrics() {
+    namespace sm = ss::metrics;
+    _metrics = std::make_unique<sm::metric_groups>();
+    _metrics->add_group(
+      "iobuf_fragment_pool",
+      {
+        sm::make_counter(
+          "hits",
+          [this] { return _stats.hits; },
+          sm::description("Number of fragments allocated from the pool")),
+        sm::make_counter(
+          "misses",
+          [this] { return _stats.misses; },
+          sm::description(
+            "Number of pooled fragments allocated from the allocator")),
+        sm::make_counter(
+          "overflows",
+          [this] { return _stats.overflows; },
+          sm::description(
+            "Number of fragments freed because the pool was full")),
+        sm::make_counter(
+          "reclaims",
+          [this] { return _stats.reclaims; },
+          sm::description(
+            "Number of times the pool was trimmed under memory pressure")),
+        sm::make_counter(
+          "reclaimed_bytes",
+          [this] { return _stats.reclaimed_bytes; },
+          sm::description("Bytes freed under memory pressure")),
+        sm::make_gauge(
+          "cached_bytes",
+          [this] { return _stats.cached_bytes; },
+          sm::description("Bytes held by the pool for reuse")),
+      });
+}
+
+void io_fragment_pool::stop() {
+    _metrics.reset();
+    configure(config{});
+}
+
+} // namespace details
@@ -0,0 +1,108 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "bytes/details/io_allocation_size.h"
+#include "seastarx.h"
+
+#include <seastar/core/memory.hh>
+#include <seastar/core/metrics_registration.hh>
+#include <seastar/core/temporary_buffer.hh>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace details {
+
+/**
+ * Per-shard cache of the buffers backing iobuf fragments.
+ *
+ * Fragments grown by appending to an iobuf are allocated with one of the sizes
+ * of `io_allocation_size::alloc_table`. When enabled, the buffers of those
+ * fragments are returned to a free list of their size class once the last
+ * share of the fragment is released (e.g. after a response was written to the
+ * socket) and reused for the next fragment of the same size, instead of going
+ * back to the seastar allocator.
+ *
+ * Watermarks
+ * ==========
+ *
+ * Buffers released while `high_watermark` bytes are cached are freed right
+ * away. Under memory pressure the seastar reclaimer trims the pool down to
+ * `low_watermark` bytes.
+ *
+ * The pool is disabled while the high watermark is zero, which is the default,
+ * and buffers are then allocated as plain temporary buffers. Pooled buffers
+ * carry a heap allocated deleter which returns them to the pool, so enabling
+ * it only pays off for workloads churning through large fragments.
+ */
+class io_fragment_pool {
+public:
+    static constexpr size_t size_classes
+      = io_allocation_size::alloc_table.size();
+
+    struct config {
+        size_t high_watermark{0};
+        size_t low_watermark{0};
+    };
+
+    struct stats {
+        uint64_t hits{0};
+        uint64_t misses{0};
+        // buffers freed because the pool was above the high watermark
+        uint64_t overflows{0};
+        uint64_t reclaims{0};
+        size_t reclaimed_bytes{0};
+        size_t cached_bytes{0};
+    };
+
+    io_fragment_pool() = default;
+    io_fragment_pool(const io_fragment_pool&) = delete;
+    io_fragment_pool& operator=(const io_fragment_pool&) = delete;
+    io_fragment_pool(io_fragment_pool&&) = delete;
+    io_fragment_pool& operator=(io_fragment_pool&&) = delete;
+    ~io_fragment_pool() noexcept;
+
+    /// The pool of the current shard
+    static io_fragment_pool& local();
+
+    void configure(config);
+    bool enabled() const { return _cfg.high_watermark > 0; }
+
+    /// Buffer of the given size, pooled if the size is a size class.
+    ss::temporary_buffer<char> allocate(size_t size);
+
+    const stats& get_stats() const { return _stats; }
+
+    void setup_metrics();
+    /// Unregisters the metrics and frees all cached buffers.
+    void stop();
+
+private:
+    static std::optional<size_t> size_class(size_t size);
+    static void release(char* buf, size_t cls, ss::shard_id owner) noexcept;
+
+    void push(char* buf, size_t cls) noexcept;
+    /// free cached buffers, largest first, until at most target bytes are left
+    size_t trim(size_t target) noexcept;
+
+    config _cfg;
+    stats _stats;
+    std::array<std::vector<char*>, size_classes> _free;
+    std::unique_ptr<ss::memory::reclaimer> _reclaimer;
+    std::unique_ptr<ss::metrics::metric_groups> _metrics;
+};
+
+} // namespace details
@@ -19,8 +19,55 @@
 
 #include <seastar/core/sstring.hh>
 
+#include <array>
 #include <memory>
 
+namespace vint {
+
+/**
+ * Decode a varint and advance the consumer past it. When the varint can't
+ * cross the end of the current fragment it is decoded from the fragment
+ * memory directly.
+ */
+inline std::pair<int64_t, uint8_t>
+consume_varlong(iobuf::iterator_consumer& in) {
+    std::pair<int64_t, size_t> ret;
+    if (likely(in.segment_bytes_left() >= max_length)) {
+        ret = deserialize(
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+          reinterpret_cast<const uint8_t*>(&*in.begin()),
+          in.segment_bytes_left());
+    } else {
+        ret = deserialize(in);
+    }
+    in.skip(ret.second);
+    return {ret.first, static_cast<uint8_t>(ret.second)};
+}
+
+/**
+ * Decode N consecutive varints, e.g. the fixed part of a record, at once when
+ * all of them are in the current fragment.
+ */
+template<size_t N>
+std::array<int64_t, N> consume_varlongs(iobuf::iterator_consumer& in) {
+    std::array<int64_t, N> ret;
+    if (likely(in.segment_bytes_left() >= N * max_length)) {
+        in.skip(deserialize_n(
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+          reinterpret_cast<const uint8_t*>(&*in.begin()),
+          in.segment_bytes_left(),
+          ret.data(),
+          N));
+    } else {
+        for (auto& v : ret) {
+            v = consume_varlong(in).first;
+        }
+    }
+    return ret;
+}
+
+} // namespace vint
+
 /**
  * iobuf parser interface suitable for an iobuf passed by const-ref. also
  * accepts an iobuf value. in both cases it is safe to move this type, but when
@@ -46,9 +93,12 @@ public:
     size_t bytes_consumed() const { return _in.bytes_consumed(); }
 
     std::pair<int64_t, uint8_t> read_varlong() {
-        auto [val, length_size] = vint::deserialize(_in);
-        _in.skip(length_size);
-        return {val, length_size};
+        return vint::consume_varlong(_in);
+    }
+
+    template<size_t N>
+    std::array<int64_t, N> read_varlongs() {
+        return vint::consume_varlongs<N>(_in);
     }
 
     std::pair<uint32_t, uint8_t> read_unsigned_varint() {
@@ -9,6 +9,7 @@
 
 #include "bytes/bytes.h"
 #include "bytes/details/io_allocation_size.h"
+#include "bytes/details/io_fragment_pool.h"
 #include "bytes/iobuf.h"
 #include "bytes/iobuf_istreambuf.h"
 #include "bytes/iobuf_ostreambuf.h"
@@ -18,6 +19,7 @@
 
 #include <seastar/core/temporary_buffer.hh>
 #include <seastar/testing/thread_test_case.hh>
+#include <seastar/util/defer.hh>
 
 #include <boost/range/algorithm/for_each.hpp>
 #include <boost/test/tools/old/interface.hpp>
@@ -672,3 +674,52 @@ SEASTAR_THREAD_TEST_CASE(iobuf_is_zero_test) {
     zero.append(zeros.data(), zeros.size());
     BOOST_REQUIRE_EQUAL(is_zero(zero), true);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_fragment_pool_reuse) {
+    auto& pool = details::io_fragment_pool::local();
+    pool.configure({.high_watermark = 1024 * 1024, .low_watermark = 0});
+    auto stop_pool = ss::defer([&pool] { pool.stop(); });
+    const auto& stats = pool.get_stats();
+    const std::array<char, 100> data{};
+
+    const char* first = nullptr;
+    size_t capacity = 0;
+    {
+        iobuf buf;
+        buf.append(data.data(), data.size());
+        first = buf.begin()->get();
+        capacity = buf.begin()->capacity();
+    }
+    BOOST_REQUIRE_EQUAL(stats.cached_bytes, capacity);
+
+    // the released buffer backs the next fragment of the same size
+    auto hits = stats.hits;
+    iobuf buf;
+    buf.append(data.data(), data.size());
+    BOOST_REQUIRE(buf.begin()->get() == first);
+    BOOST_REQUIRE_EQUAL(stats.hits, hits + 1);
+    BOOST_REQUIRE_EQUAL(stats.cached_bytes, 0);
+
+    // only returned once the last share is released
+    auto shared = buf.share(0, buf.size_bytes());
+    buf.clear();
+    BOOST_REQUIRE_EQUAL(stats.cached_bytes, 0);
+    shared.clear();
+    BOOST_REQUIRE_EQUAL(stats.cached_bytes, capacity);
+
+    // buffers above the high watermark go back to the allocator
+    pool.configure({.high_watermark = capacity, .low_watermark = 0});
+    auto overflows = stats.overflows;
+    {
+        iobuf a;
+        a.append(data.data(), data.size());
+        iobuf b;
+        b.append(data.data(), data.size());
+    }
+    BOOST_REQUIRE_EQUAL(stats.cached_bytes, capacity);
+    BOOST_REQUIRE_EQUAL(stats.overflows, overflows + 1);
+
+    // disabling the pool frees the cached buffers
+    pool.configure({});
+    BOOST_REQUIRE_EQUAL(stats.cached_bytes, 0);
+}
@@ -14,7 +14,9 @@
 #include "units.h"
 
 #include <seastar/core/coroutine.hh>
+#include <seastar/core/preempt.hh>
 #include <seastar/core/smp.hh>
+#include <seastar/coroutine/maybe_yield.hh>
 
 #include <absl/container/btree_map.h>
 
@@ -54,21 +56,47 @@ void read_nested(
 
 namespace cloud_storage {
 
+static uint32_t to_seconds(std::chrono::system_clock::time_point ts) {
+    return std::chrono::time_point_cast<std::chrono::seconds>(ts)
+      .time_since_epoch()
+      .count();
+}
+
+void access_time_tracker::add(
+  std::string_view key, std::chrono::system_clock::time_point ts, size_t size) {
+    auto seconds = to_seconds(ts);
+    auto [it, inserted] = _files.try_emplace(
+      ss::sstring(key.data(), key.size()), file_info{seconds, size});
+    if (!inserted) {
+        _lru.erase({it->second.atime, it->first});
+        _total_size -= it->second.size;
+        it->second = file_info{seconds, size};
+    }
+    _lru.emplace(seconds, it->first);
+    _total_size += size;
+    _dirty = true;
+}
+
 void access_time_tracker::add_timestamp(
   std::string_view key, std::chrono::system_clock::time_point ts) {
-    uint32_t seconds = std::chrono::time_point_cast<std::chrono::seconds>(ts)
-                         .time_since_epoch()
-                         .count();
-    uint32_t hash = xxhash_32(key.data(), key.size());
-    _table.data[hash] = seconds;
+    auto it = _files.find(ss::sstring(key.data(), key.size()));
+    add(key, ts, it == _files.end() ? 0 : it->second.size);
+}
+
+void access_time_tracker::erase(std::string_view key) {
+    auto it = _files.find(ss::sstring(key.data(), key.size()));
+    if (it == _files.end()) {
+        return;
+    }
+    _lru.erase({it->second.atime, it->first});
+    _total_size -= it->second.size;
+    _files.erase(it);
     _dirty = true;
 }
 
 void access_time_tracker::remove_timestamp(std::string_view key) noexcept {
     try {
-        uint32_t hash = xxhash_32(key.data(), key.size());
-        _table.data.erase(hash);
-        _dirty = true;
+        erase(key);
     } catch (...) {
         vassert(
           false,
@@ -78,36 +106,111 @@ void access_time_tracker::remove_timestamp(std::string_view key) noexcept {
     }
 }
 
-void access_time_tracker::remove_others(const access_time_tracker& t) {
-    table_t tmp;
-    for (auto it : _table.data) {
-        if (t._table.data.contains(it.first)) {
-            tmp.data.insert(it);
-        }
-    }
-    _table = std::move(tmp);
-}
-
 std::optional<std::chrono::system_clock::time_point>
 access_time_tracker::estimate_timestamp(std::string_view key) const {
-    uint32_t hash = xxhash_32(key.data(), key.size());
-    auto it = _table.data.find(hash);
-    if (it == _table.data.end()) {
+    auto it = _files.find(ss::sstring(key.data(), key.size()));
+    if (it == _files.end()) {
         return std::nullopt;
     }
-    auto seconds = std::chrono::seconds(it->second);
+    auto seconds = std::chrono::seconds(it->second.atime);
     std::chrono::system_clock::time_point ts(seconds);
     return ts;
 }
 
-iobuf access_time_tracker::to_iobuf() {
+std::optional<access_time_tracker::file_metadata>
+access_time_tracker::get(std::string_view key) const {
+    auto it = _files.find(ss::sstring(key.data(), key.size()));
+    if (it == _files.end()) {
+        return std::nullopt;
+    }
+    return file_metadata{
+      .atime = std::chrono::system_clock::time_point(
+        std::chrono::seconds(it->second.atime)),
+      .size = it->second.size};
+}
+
+std::vector<access_time_tracker::eviction_candidate>
+access_time_tracker::eviction_candidates(uint64_t bytes) const {
+    std::vector<eviction_candidate> result;
+    uint64_t total = 0;
+    for (auto it = _lru.begin(); it != _lru.end() && total < bytes; ++it) {
+        ss::sstring path(it->second.data(), it->second.size());
+        auto size = _files.find(path)->second.size;
+        result.push_back({.path = std::move(path), .size = size});
+        total += size;
+    }
+    return result;
+}
+
+ss::future<> access_time_tracker::table_t::serde_async_write(iobuf& out) {
+    // same layout as the fields written by serde::write
+    using serde::write;
+    write(out, static_cast<uint64_t>(data.size()));
+    for (auto [hash, atime] : data) {
+        write(out, hash);
+        write(out, atime);
+        co_await ss::coroutine::maybe_yield();
+    }
+    write(out, static_cast<serde::serde_size_t>(files.size()));
+    for (auto& f : files) {
+        write(out, std::move(f));
+        co_await ss::coroutine::maybe_yield();
+    }
+}
+
+ss::future<iobuf> access_time_tracker::to_iobuf() {
+    table_t table;
+    table.files.reserve(_files.size());
+    // updates made while the tracker is serialized must mark it dirty again
     _dirty = false;
-    return serde::to_iobuf(_table);
+    // Files are visited in access time order. After a yield the walk resumes
+    // after the last visited file, which is still in place if it wasn't
+    // accessed or removed in the meantime.
+    for (auto it = _lru.begin(); it != _lru.end();) {
+        auto [atime, path] = *it;
+        auto size = _files.find(ss::sstring(path.data(), path.size()))
+                      ->second.size;
+        table.data[xxhash_32(path.data(), path.size())] = atime;
+        table.files.push_back(
+          {.path = ss::sstring(path.data(), path.size()),
+           .atime = atime,
+           .size = size});
+        ++it;
+        if (ss::need_preempt()) {
+            co_await ss::coroutine::maybe_yield();
+            it = _lru.upper_bound(
+              std::make_pair(atime, std::string_view(table.files.back().path)));
+        }
+    }
+    iobuf out;
+    co_await serde::write_async(out, std::move(table));
+    co_return out;
 }
 
 void access_time_tracker::from_iobuf(iobuf b) {
     iobuf_parser parser(std::move(b));
-    _table = serde::read<table_t>(parser);
+    auto table = serde::read<table_t>(parser);
+    _files.clear();
+    _lru.clear();
+    _total_size = 0;
+    // Version 0 of the table only has hashes of the file names, these
+    // entries can't be used for eviction. The files are re-added by the
+    // directory scan that runs on startup.
+    for (auto& f : table.files) {
+        auto [it, inserted] = _files.try_emplace(
+          std::move(f.path), file_info{f.atime, f.size});
+        if (!inserted) {
+            // the file was accessed while the tracker was serialized
+            if (it->second.atime >= f.atime) {
+                continue;
+            }
+            _lru.erase({it->second.atime, it->first});
+            _total_size -= it->second.size;
+            it->second = file_info{f.atime, f.size};
+        }
+        _lru.emplace(f.atime, it->first);
+        _total_size += f.size;
+    }
     _dirty = false;
 }
 
@@ -16,58 +16,118 @@
 #include "serde/envelope.h"
 
 #include <seastar/core/future.hh>
+#include <seastar/core/sstring.hh>
 
 #include <absl/container/btree_map.h>
+#include <absl/container/btree_set.h>
+#include <absl/container/node_hash_map.h>
 
 #include <chrono>
 #include <string_view>
+#include <vector>
 
 namespace cloud_storage {
 
-/// Access time tracker maintains map from filename hash to
-/// the timestamp that represents the time when the file was
-/// accessed last.
+/// Access time tracker maintains an index of the files stored in the
+/// cache. For every file it stores the time when the file was accessed
+/// last and its size. The files are also ordered by access time so the
+/// least recently used files can be found without scanning the
+/// directory or the whole index.
 ///
-/// It is possible to have conflicts. In case of conflict
-/// 'add_timestamp' method will overwrite another key. For that
-/// key we will observe larger access time. When one of the
-/// conflicted entries will be deleted another will be deleted
-/// as well. This is OK because the code in the
-/// 'cloud_storage/cache_service' is ready for that.
+/// The index is persisted on disk (see 'to_iobuf'/'from_iobuf') and
+/// survives restarts.
 class access_time_tracker {
     using timestamp_t = uint32_t;
+
+    struct file_entry
+      : serde::
+          envelope<file_entry, serde::version<0>, serde::compat_version<0>> {
+        ss::sstring path;
+        timestamp_t atime;
+        uint64_t size;
+    };
+
     struct table_t
-      : serde::envelope<table_t, serde::version<0>, serde::compat_version<0>> {
+      : serde::envelope<table_t, serde::version<1>, serde::compat_version<0>> {
+        /// Access times by file name hash, the only field in version 0.
+        /// Still written to make downgrades possible but never read.
         absl::btree_map<uint32_t, timestamp_t> data;
+        /// Files of the cache with sizes and access times (version 1)
+        std::vector<file_entry> files;
+
+        ss::future<> serde_async_write(iobuf& out);
+    };
+
+    struct file_info {
+        timestamp_t atime;
+        uint64_t size;
     };
 
 public:
-    /// Add access time to the container.
+    access_time_tracker() = default;
+    access_time_tracker(const access_time_tracker&) = delete;
+    access_time_tracker& operator=(const access_time_tracker&) = delete;
+    access_time_tracker(access_time_tracker&&) noexcept = default;
+    access_time_tracker& operator=(access_time_tracker&&) noexcept = default;
+    ~access_time_tracker() = default;
+
+    /// Add file to the container or update its access time and size.
+    void
+    add(std::string_view key, std::chrono::system_clock::time_point ts, size_t);
+
+    /// Add access time to the container. The size of the file is
+    /// preserved if it's already tracked and set to zero otherwise.
     void add_timestamp(
       std::string_view key, std::chrono::system_clock::time_point ts);
 
     /// Remove key from the container.
     void remove_timestamp(std::string_view) noexcept;
 
-    /// Return access time estimate (it can differ if there is a conflict
-    /// on file name hash).
+    /// Return access time of the file if it's tracked.
     std::optional<std::chrono::system_clock::time_point>
     estimate_timestamp(std::string_view key) const;
 
-    iobuf to_iobuf();
+    struct file_metadata {
+        std::chrono::system_clock::time_point atime;
+        uint64_t size;
+    };
+
+    /// Return access time and size of the file if it's tracked.
+    std::optional<file_metadata> get(std::string_view key) const;
+
+    struct eviction_candidate {
+        ss::sstring path;
+        uint64_t size;
+    };
+
+    /// Return least recently accessed files with total size of at least
+    /// 'bytes' (or all files if the total size of the cache is smaller).
+    /// The complexity is linear to the number of returned files.
+    std::vector<eviction_candidate> eviction_candidates(uint64_t bytes) const;
+
+    /// Serialize the tracker. The tracker can be updated concurrently, files
+    /// accessed while it's serialized may be written twice, in which case
+    /// the most recent access time is restored by 'from_iobuf'.
+    ss::future<iobuf> to_iobuf();
     void from_iobuf(iobuf b);
 
     /// Returns true if tracker has new data which wasn't serialized
     /// to disk.
     bool is_dirty() const;
 
-    /// Remove every key which isn't present in 't'
-    void remove_others(const access_time_tracker& t);
+    /// Number of tracked files
+    size_t size() const { return _files.size(); }
 
-    size_t size() const { return _table.data.size(); }
+    /// Total size of all tracked files
+    uint64_t total_size() const { return _total_size; }
 
 private:
-    table_t _table;
+    void erase(std::string_view key);
+
+    absl::node_hash_map<ss::sstring, file_info> _files;
+    /// Files ordered by access time, keys reference the keys of '_files'
+    absl::btree_set<std::pair<timestamp_t, std::string_view>> _lru;
+    uint64_t _total_size{0};
     bool _dirty{false};
 };
 
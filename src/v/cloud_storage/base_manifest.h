@@ -28,6 +28,7 @@ enum class manifest_type {
     topic,
     partition,
     tx_range,
+    segment_index,
 };
 
 class base_manifest {
@@ -12,6 +12,7 @@
 #include "cloud_storage/logger.h"
 #include "ssx/future-util.h"
 #include "storage/segment.h"
+#include "utils/file_io.h"
 #include "utils/gate_guard.h"
 #include "vassert.h"
 #include "vlog.h"
@@ -102,10 +103,10 @@ cache::recursive_delete_empty_directory(const std::string_view& key) {
 
 uint64_t cache::get_total_cleaned() { return _total_cleaned; }
 
-ss::future<> cache::consume_cache_space(size_t sz) {
+ss::future<> cache::consume_cache_space(ss::sstring path, size_t sz) {
     vassert(ss::this_shard_id() == 0, "This method can only run on shard 0");
-    _current_cache_size += sz;
-    if (_current_cache_size > _max_cache_size) {
+    _access_time_tracker.add(path, std::chrono::system_clock::now(), sz);
+    if (_access_time_tracker.total_size() > _max_cache_size) {
         auto units = ss::try_get_units(_cleanup_sm, 1);
         if (units) {
             co_await clean_up_cache();
@@ -118,23 +119,20 @@ ss::future<> cache::clean_up_at_start() {
     gate_guard guard{_gate};
     auto [cache_size, candidates_for_deletion] = co_await _walker.walk(
       _cache_dir.native(), _access_time_tracker);
-    probe.set_size(cache_size);
-    probe.set_num_files(candidates_for_deletion.size());
 
     // The state of the _access_time_tracker and the actual content of the
     // cache directory might diverge over time (if the user removes segment
-    // files manually). We need to take this into account.
-    access_time_tracker tmp;
-    for (const auto& it : candidates_for_deletion) {
-        tmp.add_timestamp(
-          it.path, std::chrono::system_clock::time_point::min());
-    }
-    _access_time_tracker.remove_others(tmp);
-    _current_cache_size = cache_size;
-
+    // files manually). The index is rebuilt from the directory content, the
+    // access times of the known files are preserved by the walker.
+    access_time_tracker index;
     for (auto& file_item : candidates_for_deletion) {
         auto filepath_to_remove = file_item.path;
 
+        if (
+          std::filesystem::path(filepath_to_remove).filename()
+          == access_time_tracker_file_name) {
+            continue;
+        }
         // delete only tmp files that are left from previous RedPanda run
         if (std::string_view(filepath_to_remove).ends_with(tmp_extension)) {
             try {
@@ -147,72 +145,77 @@ ss::future<> cache::clean_up_at_start() {
                   filepath_to_remove,
                   e.what());
             }
+        } else {
+            index.add(file_item.path, file_item.access_time, file_item.size);
         }
     }
+    _access_time_tracker = std::move(index);
+    probe.set_size(_access_time_tracker.total_size());
+    probe.set_num_files(_access_time_tracker.size());
     vlog(
       cst_log.debug,
-      "Clean up at start deleted files of total size {}.",
-      _total_cleaned);
+      "Clean up at start deleted files of total size {}, {} files indexed.",
+      _total_cleaned,
+      _access_time_tracker.size());
 }
 
 ss::future<> cache::clean_up_cache() {
     vassert(ss::this_shard_id() == 0, "Method can only be invoked on shard 0");
     gate_guard guard{_gate};
-    auto [current_cache_size, candidates_for_deletion] = co_await _walker.walk(
-      _cache_dir.native(), _access_time_tracker);
-    _current_cache_size = current_cache_size;
-    probe.set_size(_current_cache_size);
-    probe.set_num_files(candidates_for_deletion.size());
-
-    // Updating the access time tracker in case if some files were removed
-    // from cache directory by the user manually.
-    access_time_tracker tmp;
-    for (const auto& it : candidates_for_deletion) {
-        tmp.add_timestamp(
-          it.path, std::chrono::system_clock::time_point::min());
+    auto current_cache_size = _access_time_tracker.total_size();
+    probe.set_size(current_cache_size);
+    probe.set_num_files(_access_time_tracker.size());
+
+    if (current_cache_size < _max_cache_size) {
+        co_return;
     }
-    _access_time_tracker.remove_others(tmp);
+    auto size_to_delete
+      = current_cache_size
+        - (_max_cache_size * (long double)_cache_size_low_watermark);
 
+    // Only the files that has to be deleted are visited
+    auto candidates_for_deletion = _access_time_tracker.eviction_candidates(
+      static_cast<uint64_t>(size_to_delete));
     uint64_t deleted_size = 0;
-    if (_current_cache_size >= _max_cache_size) {
-        auto size_to_delete
-          = _current_cache_size
-            - (_max_cache_size * (long double)_cache_size_low_watermark);
-
-        size_t i_to_delete = 0;
-        while (i_to_delete < candidates_for_deletion.size()
-               && deleted_size < size_to_delete) {
-            auto filename_to_remove = candidates_for_deletion[i_to_delete].path;
-
-            // skip tmp files since someone may be writing to it
-            if (!std::string_view(filename_to_remove)
-                   .ends_with(tmp_extension)) {
-                try {
-                    co_await recursive_delete_empty_directory(
-                      filename_to_remove);
-                    deleted_size += candidates_for_deletion[i_to_delete].size;
-                    // Remove key if possible to make sure there is no resource
-                    // leak
-                    _access_time_tracker.remove_timestamp(
-                      std::string_view(filename_to_remove));
-                } catch (std::exception& e) {
-                    vlog(
-                      cst_log.error,
-                      "Cache eviction couldn't delete {}: {}.",
-                      filename_to_remove,
-                      e.what());
-                }
+    size_t deleted_count = 0;
+    for (auto& candidate : candidates_for_deletion) {
+        try {
+            co_await recursive_delete_empty_directory(candidate.path);
+            deleted_size += candidate.size;
+            deleted_count++;
+        } catch (std::filesystem::filesystem_error& e) {
+            if (e.code() != std::errc::no_such_file_or_directory) {
+                vlog(
+                  cst_log.error,
+                  "Cache eviction couldn't delete {}: {}.",
+                  candidate.path,
+                  e.what());
+                continue;
             }
-            i_to_delete++;
+            // The file was removed from the cache directory by the user
+            // manually, the index has to be updated.
+            vlog(
+              cst_log.debug,
+              "Cache eviction couldn't find {}, removing it from the index",
+              candidate.path);
+        } catch (std::exception& e) {
+            vlog(
+              cst_log.error,
+              "Cache eviction couldn't delete {}: {}.",
+              candidate.path,
+              e.what());
+            continue;
         }
-        _total_cleaned += deleted_size;
-        _current_cache_size -= deleted_size;
-        vlog(
-          cst_log.debug,
-          "Cache eviction deleted {} files of total size {}.",
-          i_to_delete,
-          deleted_size);
+        _access_time_tracker.remove_timestamp(candidate.path);
     }
+    _total_cleaned += deleted_size;
+    probe.set_size(_access_time_tracker.total_size());
+    probe.set_num_files(_access_time_tracker.size());
+    vlog(
+      cst_log.debug,
+      "Cache eviction deleted {} files of total size {}.",
+      deleted_count,
+      deleted_size);
 }
 
 ss::future<> cache::load_access_time_tracker() {
@@ -226,34 +229,16 @@ ss::future<> cache::load_access_time_tracker() {
     }
     vlog(
       cst_log.info, "Trying to hydrate access time tracker from '{}'", source);
-    if (auto cache_item = co_await get(source); cache_item.has_value()) {
-        try {
-            ss::file_input_stream_options options{};
-            options.buffer_size
-              = config::shard_local_cfg().storage_read_buffer_size;
-            options.read_ahead
-              = config::shard_local_cfg().storage_read_readahead_count;
-            options.io_priority_class
-              = priority_manager::local().shadow_indexing_priority();
-            auto inp_stream = ss::make_file_input_stream(
-              cache_item->body, options);
-            iobuf state;
-            auto out_stream = make_iobuf_ref_output_stream(state);
-            co_await ss::copy(inp_stream, out_stream).finally([&inp_stream] {
-                return inp_stream.close();
-            });
-            _access_time_tracker.from_iobuf(std::move(state));
-        } catch (...) {
-            vlog(
-              cst_log.warn,
-              "Failed to materialize access time tracker '{}'. Error: {}",
-              source,
-              std::current_exception());
-        }
-        co_await cache_item->body.close();
-    } else {
+    // The tracker file is not a cache entry, it's read and written directly
+    // so that it's neither tracked by nor evicted through itself.
+    try {
+        _access_time_tracker.from_iobuf(co_await read_fully(source));
+    } catch (...) {
         vlog(
-          cst_log.info, "Access time tracker is not available at '{}'", source);
+          cst_log.warn,
+          "Failed to materialize access time tracker '{}'. Error: {}",
+          source,
+          std::current_exception());
     }
 }
 
@@ -261,13 +246,16 @@ ss::future<> cache::save_access_time_tracker() {
     ss::gate::holder guard{_gate};
     vassert(ss::this_shard_id() == 0, "Method can only be invoked on shard 0");
     auto source = _cache_dir / access_time_tracker_file_name;
-    auto index_stream = make_iobuf_input_stream(
-      _access_time_tracker.to_iobuf());
+    auto tmp = std::filesystem::path(
+      ss::format("{}_{}{}", source.native(), ++_cnt, tmp_extension));
+    auto buf = co_await _access_time_tracker.to_iobuf();
     vlog(
       cst_log.debug,
       "current access_time_tracker size: {}",
       _access_time_tracker.size());
-    co_await put(source.native(), index_stream);
+    co_await ss::recursive_touch_directory(_cache_dir.native());
+    co_await write_fully(tmp, std::move(buf));
+    co_await ss::rename_file(tmp.native(), source.native());
 }
 
 ss::future<> cache::maybe_save_access_time_tracker() {
@@ -315,19 +303,6 @@ ss::future<std::optional<cache_item>> cache::get(std::filesystem::path key) {
     try {
         auto source = (_cache_dir / key).native();
         cache_file = co_await ss::open_file_dma(source, ss::open_flags::ro);
-
-        // Bump access time of the file
-        if (ss::this_shard_id() == 0) {
-            _access_time_tracker.add_timestamp(
-              source, std::chrono::system_clock::now());
-        } else {
-            ssx::spawn_with_gate(_gate, [this, source] {
-                return container().invoke_on(0, [source](cache& c) {
-                    c._access_time_tracker.add_timestamp(
-                      source, std::chrono::system_clock::now());
-                });
-            });
-        }
     } catch (std::filesystem::filesystem_error& e) {
         if (e.code() == std::errc::no_such_file_or_directory) {
             co_return std::nullopt;
@@ -337,6 +312,20 @@ ss::future<std::optional<cache_item>> cache::get(std::filesystem::path key) {
     }
 
     auto data_size = co_await cache_file.size();
+
+    // Bump access time of the file
+    auto source = (_cache_dir / key).native();
+    if (ss::this_shard_id() == 0) {
+        _access_time_tracker.add(
+          source, std::chrono::system_clock::now(), data_size);
+    } else {
+        ssx::spawn_with_gate(_gate, [this, source, data_size] {
+            return container().invoke_on(0, [source, data_size](cache& c) {
+                c._access_time_tracker.add(
+                  source, std::chrono::system_clock::now(), data_size);
+            });
+        });
+    }
     probe.cached_get();
     co_return std::optional(cache_item{std::move(cache_file), data_size});
 }
@@ -435,22 +424,13 @@ ss::future<> cache::put(
 
     auto put_size = co_await ss::file_size(dest);
 
-    // Bump access time of the file
-    if (ss::this_shard_id() == 0) {
-        _access_time_tracker.add_timestamp(
-          dest, std::chrono::system_clock::now());
-        ssx::spawn_with_gate(_gate, [this, dest, put_size] {
-            return consume_cache_space(put_size);
-        });
-    } else {
-        ssx::spawn_with_gate(_gate, [this, dest, put_size] {
-            return container().invoke_on(0, [dest, put_size](cache& c) {
-                c._access_time_tracker.add_timestamp(
-                  dest, std::chrono::system_clock::now());
-                return c.consume_cache_space(put_size);
-            });
-        });
-    }
+    // Add the file to the index, this also bumps its access time
+    ssx::spawn_with_gate(
+      _gate, [this, path = ss::sstring(dest.data(), dest.size()), put_size] {
+          return container().invoke_on(0, [path, put_size](cache& c) {
+              return c.consume_cache_space(path, put_size);
+          });
+      });
 }
 
 ss::future<cache_element_status>
@@ -476,8 +456,17 @@ ss::future<> cache::invalidate(const std::filesystem::path& key) {
       "Trying to invalidate {} from archival cache.",
       key.native());
     try {
-        _access_time_tracker.remove_timestamp(key.native());
-        co_await recursive_delete_empty_directory((_cache_dir / key).native());
+        auto source = (_cache_dir / key).native();
+        if (ss::this_shard_id() == 0) {
+            _access_time_tracker.remove_timestamp(source);
+        } else {
+            ssx::spawn_with_gate(_gate, [this, source] {
+                return container().invoke_on(0, [source](cache& c) {
+                    c._access_time_tracker.remove_timestamp(source);
+                });
+            });
+        }
+        co_await recursive_delete_empty_directory(source);
     } catch (std::filesystem::filesystem_error& e) {
         if (e.code() == std::errc::no_such_file_or_directory) {
             vlog(
@@ -97,12 +97,14 @@ private:
     /// Save access time tracker state to the file if needed
     ss::future<> maybe_save_access_time_tracker();
 
-    /// Triggers directory walker, creates a list of files to delete and deletes
-    /// them until cache size <= _cache_size_low_watermark * max_cache_size
+    /// Deletes the least recently used files until cache size <=
+    /// _cache_size_low_watermark * max_cache_size. The files are found
+    /// using the access time tracker index, the directory is not scanned.
     ss::future<> clean_up_cache();
 
-    /// Triggers directory walker, creates a list of files to delete and deletes
-    /// only tmp files that are left from previous Red Panda run
+    /// Triggers directory walker, deletes tmp files that are left from
+    /// previous Red Panda run and rebuilds the access time tracker index
+    /// from the content of the cache directory
     ss::future<> clean_up_at_start();
 
     /// Deletes a file and then recursively goes up and deletes a directory
@@ -111,9 +113,9 @@ private:
     /// \param key if a path to a file what should be deleted
     ss::future<> recursive_delete_empty_directory(const std::string_view& key);
 
-    /// This method is called on shard 0 by other shards to report disk
-    /// space changes.
-    ss::future<> consume_cache_space(size_t);
+    /// This method is called on shard 0 to add new file to the index and
+    /// trigger eviction if the cache is full.
+    ss::future<> consume_cache_space(ss::sstring path, size_t);
 
     std::filesystem::path _cache_dir;
     size_t _max_cache_size;
@@ -123,11 +125,10 @@ private:
     static constexpr double _cache_size_low_watermark{0.8};
     cloud_storage::recursive_directory_walker _walker;
     uint64_t _total_cleaned;
-    /// Current size of the cache directory (only used on shard 0)
-    uint64_t _current_cache_size{0};
     ssx::semaphore _cleanup_sm{1, "cloud/cache"};
     std::set<std::filesystem::path> _files_in_progress;
     cache_probe probe;
+    /// Index of the cache content (only used on shard 0)
     access_time_tracker _access_time_tracker;
     ss::timer<ss::lowres_clock> _tracker_timer;
 };
@@ -55,8 +55,10 @@ recursive_directory_walker::walk(
                &current_cache_size,
                &dirlist,
                _target{target},
-               _tracker{tracker}](ss::directory_entry entry) -> ss::future<> {
+               _tracker{&tracker}](ss::directory_entry entry) -> ss::future<> {
                   auto target{_target};
+                  // The tracker is captured by pointer since it can't be
+                  // copied (and copying it for every entry is expensive).
                   auto tracker{_tracker};
                   vlog(cst_log.debug, "Looking at directory {}", target);
 
@@ -67,11 +69,23 @@ recursive_directory_walker::walk(
                     && entry.type == ss::directory_entry_type::regular) {
                       vlog(cst_log.debug, "Regular file found {}", entry_path);
 
+                      // Files which are already indexed don't have to be
+                      // stat'ed, the index has their sizes.
+                      if (auto tracked = tracker->get(entry_path.native());
+                          tracked && tracked->size != 0) {
+                          current_cache_size += tracked->size;
+                          files.push_back(
+                            {tracked->atime,
+                             entry_path.native(),
+                             tracked->size});
+                          co_return;
+                      }
+
                       auto file_stats = co_await ss::file_stat(
                         entry_path.string());
 
                       auto last_access_timepoint
-                        = tracker.estimate_timestamp(entry_path.native())
+                        = tracker->estimate_timestamp(entry_path.native())
                             .value_or(file_stats.time_accessed);
 
                       current_cache_size += static_cast<uint64_t>(
@@ -13,6 +13,7 @@
 #include "cloud_storage/logger.h"
 #include "cloud_storage/types.h"
 #include "s3/client.h"
+#include "ssx/future-util.h"
 #include "ssx/sformat.h"
 #include "utils/intrusive_list_helpers.h"
 #include "utils/retry_chain_node.h"
@@ -36,6 +37,9 @@ namespace cloud_storage {
 
 using namespace std::chrono_literals;
 
+static constexpr auto multipart_abort_timeout = 10s;
+static constexpr auto multipart_abort_backoff = 100ms;
+
 enum class error_outcome {
     /// Error condition that could be retried
     retry,
@@ -219,6 +223,9 @@ ss::future<download_result> remote::download_manifest(
             case manifest_type::tx_range:
                 _probe.txrange_manifest_download();
                 break;
+            case manifest_type::segment_index:
+                _probe.segment_index_download();
+                break;
             }
             co_return download_result::success;
         } catch (...) {
@@ -304,6 +311,9 @@ ss::future<upload_result> remote::upload_manifest(
             case manifest_type::tx_range:
                 _probe.txrange_manifest_upload();
                 break;
+            case manifest_type::segment_index:
+                _probe.segment_index_upload();
+                break;
             }
             _probe.register_upload_size(size);
             co_return upload_result::success;
@@ -458,27 +468,308 @@ ss::future<upload_result> remote::upload_segment(
     co_return upload_result::timedout;
 }
 
+ss::future<upload_result> remote::do_multipart_request(
+  const s3::bucket_name& bucket,
+  const s3::object_key& path,
+  std::string_view request_name,
+  const multipart_request& request,
+  retry_chain_node& fib) {
+    retry_chain_logger ctxlog(cst_log, fib);
+    auto permit = fib.retry();
+    while (!_gate.is_closed() && permit.is_allowed) {
+        auto [client, deleter] = co_await _pool.acquire();
+        std::exception_ptr eptr = nullptr;
+        try {
+            co_await request(*client);
+            co_return upload_result::success;
+        } catch (...) {
+            eptr = std::current_exception();
+        }
+        co_await client->shutdown();
+        auto outcome = categorize_error(eptr, fib, bucket, path);
+        switch (outcome) {
+        case error_outcome::retry_slowdown:
+            [[fallthrough]];
+        case error_outcome::retry:
+            vlog(
+              ctxlog.debug,
+              "{} request for {} failed, {} backoff required",
+              request_name,
+              path,
+              std::chrono::duration_cast<std::chrono::milliseconds>(
+                permit.delay));
+            _probe.upload_backoff();
+            co_await ss::sleep_abortable(permit.delay, _as);
+            permit = fib.retry();
+            break;
+        case error_outcome::notfound:
+            // not expected during upload
+        case error_outcome::fail:
+            co_return upload_result::failed;
+        }
+    }
+    co_return upload_result::timedout;
+}
+
+ss::future<std::optional<upload_result>> remote::upload_parts(
+  const s3::bucket_name& bucket,
+  const s3::object_key& path,
+  const s3::upload_id& id,
+  uint64_t content_length,
+  const reset_input_stream_range& reset_str,
+  size_t part_size,
+  size_t max_concurrency,
+  std::vector<std::optional<s3::completed_part>>& parts,
+  retry_chain_node& fib) {
+    retry_chain_logger ctxlog(cst_log, fib);
+    std::vector<size_t> pending;
+    for (size_t ix = 0; ix < parts.size(); ix++) {
+        if (!parts[ix]) {
+            pending.push_back(ix);
+        }
+    }
+    std::optional<upload_result> result;
+    // Requested on the first part that can't be retried, the parts that are
+    // still in flight or not started yet are cancelled.
+    ss::abort_source parts_as;
+    co_await ss::max_concurrent_for_each(
+      pending, max_concurrency, [&](size_t ix) -> ss::future<> {
+          if (parts_as.abort_requested()) {
+              co_return;
+          }
+          auto [client, deleter] = co_await _pool.acquire();
+          if (parts_as.abort_requested()) {
+              co_return;
+          }
+          auto sub = parts_as.subscribe([&client]() noexcept {
+              ssx::background = client->shutdown();
+          });
+          auto offset = ix * part_size;
+          auto length = std::min<uint64_t>(part_size, content_length - offset);
+          auto part_number = ix + 1;
+          std::optional<storage::segment_reader_handle> reader_handle;
+          std::exception_ptr eptr = nullptr;
+          try {
+              reader_handle.emplace(co_await reset_str(offset, length));
+              auto etag = co_await client->upload_part(
+                bucket,
+                path,
+                id,
+                part_number,
+                length,
+                reader_handle->take_stream(),
+                fib.get_timeout());
+              parts[ix] = s3::completed_part{
+                .part_number = part_number, .etag = std::move(etag)};
+              _probe.register_upload_size(length);
+          } catch (...) {
+              eptr = std::current_exception();
+          }
+          if (reader_handle) {
+              co_await reader_handle->close();
+          }
+          if (!eptr) {
+              co_return;
+          }
+          co_await client->shutdown();
+          if (parts_as.abort_requested()) {
+              vlog(
+                ctxlog.debug,
+                "Uploading part {} of {} cancelled",
+                part_number,
+                path);
+              co_return;
+          }
+          auto outcome = categorize_error(eptr, fib, bucket, path);
+          if (
+            outcome == error_outcome::fail
+            || outcome == error_outcome::notfound) {
+              result = upload_result::failed;
+              parts_as.request_abort();
+          } else {
+              vlog(
+                ctxlog.debug,
+                "Uploading part {} of {} failed, will be retried",
+                part_number,
+                path);
+          }
+      });
+    co_return result;
+}
+
+ss::future<upload_result> remote::upload_segment_multipart(
+  const s3::bucket_name& bucket,
+  const remote_segment_path& segment_path,
+  uint64_t content_length,
+  const reset_input_stream_range& reset_str,
+  size_t part_size,
+  size_t max_concurrency,
+  retry_chain_node& parent,
+  lazy_abort_source& lazy_abort_source) {
+    gate_guard guard{_gate};
+    retry_chain_node fib(&parent);
+    retry_chain_logger ctxlog(cst_log, fib);
+    vassert(part_size > 0, "Multipart upload part size can't be zero");
+    std::vector<s3::object_tag> tags = {{"rp-type", "segment"}};
+    auto path = s3::object_key(segment_path());
+    const auto num_parts = (content_length + part_size - 1) / part_size;
+    vlog(
+      ctxlog.debug,
+      "Uploading segment to path {}, length {}, {} parts",
+      segment_path,
+      content_length,
+      num_parts);
+
+    std::optional<s3::upload_id> id;
+    auto result = co_await do_multipart_request(
+      bucket,
+      path,
+      "CreateMultipartUpload",
+      [&](s3::client& client) -> ss::future<> {
+          id = co_await client.create_multipart_upload(
+            bucket, path, tags, fib.get_timeout());
+      },
+      fib);
+    if (result != upload_result::success) {
+        vlog(
+          ctxlog.warn,
+          "Uploading segment {} to {}, can't start multipart upload: {}",
+          segment_path,
+          bucket,
+          result);
+        _probe.failed_upload();
+        co_return result;
+    }
+
+    std::vector<std::optional<s3::completed_part>> parts(num_parts);
+    auto is_complete = [&parts] {
+        return std::all_of(parts.begin(), parts.end(), [](const auto& p) {
+            return p.has_value();
+        });
+    };
+    result = upload_result::timedout;
+    auto permit = fib.retry();
+    while (!_gate.is_closed() && permit.is_allowed) {
+        if (lazy_abort_source.abort_requested()) {
+            vlog(
+              ctxlog.warn,
+              "{}: cancelled uploading {} to {}",
+              lazy_abort_source.abort_reason(),
+              segment_path,
+              bucket);
+            result = upload_result::cancelled;
+            break;
+        }
+        auto part_result = co_await upload_parts(
+          bucket,
+          path,
+          *id,
+          content_length,
+          reset_str,
+          part_size,
+          std::max<size_t>(max_concurrency, 1),
+          parts,
+          fib);
+        if (part_result) {
+            result = *part_result;
+            break;
+        }
+        if (is_complete()) {
+            std::vector<s3::completed_part> completed;
+            completed.reserve(parts.size());
+            for (auto& p : parts) {
+                completed.push_back(std::move(*p));
+            }
+            result = co_await do_multipart_request(
+              bucket,
+              path,
+              "CompleteMultipartUpload",
+              [&](s3::client& client) {
+                  return client.complete_multipart_upload(
+                    bucket, path, *id, completed, fib.get_timeout());
+              },
+              fib);
+            break;
+        }
+        vlog(
+          ctxlog.debug,
+          "Uploading segment {} to {}, {} backoff required",
+          path,
+          bucket,
+          std::chrono::duration_cast<std::chrono::milliseconds>(permit.delay));
+        _probe.upload_backoff();
+        co_await ss::sleep_abortable(permit.delay, _as);
+        permit = fib.retry();
+    }
+
+    if (result == upload_result::success) {
+        _probe.successful_upload();
+        co_return result;
+    }
+
+    vlog(
+      ctxlog.warn,
+      "Uploading segment {} to {}, {}, aborting multipart upload",
+      segment_path,
+      bucket,
+      result);
+    _probe.failed_upload();
+    // Abort the upload to release the storage used by the uploaded parts.
+    // The abort uses its own retry budget since the parent's budget may be
+    // exhausted already.
+    retry_chain_node abort_fib(
+      _as, multipart_abort_timeout, multipart_abort_backoff);
+    co_await do_multipart_request(
+      bucket,
+      path,
+      "AbortMultipartUpload",
+      [&](s3::client& client) {
+          return client.abort_multipart_upload(
+            bucket, path, *id, abort_fib.get_timeout());
+      },
+      abort_fib);
+    co_return result;
+}
+
 ss::future<download_result> remote::download_segment(
   const s3::bucket_name& bucket,
   const remote_segment_path& segment_path,
   const try_consume_stream& cons_str,
-  retry_chain_node& parent) {
+  retry_chain_node& parent,
+  std::optional<s3::byte_range> range) {
     gate_guard guard{_gate};
     retry_chain_node fib(&parent);
     retry_chain_logger ctxlog(cst_log, fib);
     auto path = s3::object_key(segment_path());
     auto [client, deleter] = co_await _pool.acquire();
     auto permit = fib.retry();
-    vlog(ctxlog.debug, "Download segment {}", path);
+    if (range) {
+        vlog(
+          ctxlog.debug,
+          "Download segment {}, bytes {}-{}",
+          path,
+          range->first,
+          range->last);
+    } else {
+        vlog(ctxlog.debug, "Download segment {}", path);
+    }
     std::optional<download_result> result;
     while (!_gate.is_closed() && permit.is_allowed && !result) {
         std::exception_ptr eptr = nullptr;
         try {
             auto resp = co_await client->get_object(
-              bucket, path, fib.get_timeout());
+              bucket, path, fib.get_timeout(), range);
             vlog(ctxlog.debug, "Receive OK response from {}", path);
             auto length = boost::lexical_cast<uint64_t>(resp->get_headers().at(
               boost::beast::http::field::content_length));
+            if (range && length != range->last - range->first + 1) {
+                // the range wasn't honored, the body can't be used as is
+                throw std::runtime_error(fmt::format(
+                  "Requested {} bytes from {}, got {}",
+                  range->last - range->first + 1,
+                  path,
+                  length));
+            }
             uint64_t content_length = co_await cons_str(
               length, resp->as_input_stream());
             _probe.successful_download();
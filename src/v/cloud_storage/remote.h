@@ -107,6 +107,14 @@ public:
     using reset_input_stream
       = ss::noncopyable_function<ss::future<storage::segment_reader_handle>()>;
 
+    /// Functor that returns fresh input_stream object that returns
+    /// 'length' bytes of the data that needs to be uploaded starting
+    /// from 'offset'. Used to upload (and re-upload) individual parts
+    /// of a multipart upload.
+    using reset_input_stream_range
+      = ss::noncopyable_function<ss::future<storage::segment_reader_handle>(
+        size_t offset, size_t length)>;
+
     /// Functor that attempts to consume the input stream. If the connection
     /// is broken during the download the functor is responsible for he cleanup.
     /// The functor should be reenterable since it can be called many times.
@@ -187,6 +195,27 @@ public:
       retry_chain_node& parent,
       lazy_abort_source& lazy_abort_source);
 
+    /// \brief Upload segment to S3 using multipart upload
+    ///
+    /// The segment is split into parts of 'part_size' bytes (the last part
+    /// can be smaller) that are uploaded in parallel using up to
+    /// 'max_concurrency' connections from the pool. If some parts fail
+    /// with a retryable error only these parts are re-uploaded after the
+    /// backoff. The upload is aborted if it can't be completed.
+    /// \param reset_str is a functor that returns an input_stream with the
+    ///                  byte range of the segment
+    /// \param part_size is a size of the individual part
+    /// \param max_concurrency is a max number of parts uploaded in parallel
+    ss::future<upload_result> upload_segment_multipart(
+      const s3::bucket_name& bucket,
+      const remote_segment_path& segment_path,
+      uint64_t content_length,
+      const reset_input_stream_range& reset_str,
+      size_t part_size,
+      size_t max_concurrency,
+      retry_chain_node& parent,
+      lazy_abort_source& lazy_abort_source);
+
     /// \brief Download segment from S3
     ///
     /// The method downloads the segment while tolerating some errors. It can
@@ -195,11 +224,14 @@ public:
     /// segment's data
     /// \param name is a segment's name in S3
     /// \param manifest is a manifest that should have the segment metadata
+    /// \param range is an optional byte range, if set only this part of the
+    /// segment is downloaded and passed to cons_str
     ss::future<download_result> download_segment(
       const s3::bucket_name& bucket,
       const remote_segment_path& path,
       const try_consume_stream& cons_str,
-      retry_chain_node& parent);
+      retry_chain_node& parent,
+      std::optional<s3::byte_range> range = std::nullopt);
 
     /// Checks if the segment exists in the bucket
     ss::future<download_result> segment_exists(
@@ -209,6 +241,36 @@ public:
 
 private:
     ss::future<> propagate_credentials(cloud_roles::credentials credentials);
+
+    using multipart_request
+      = ss::noncopyable_function<ss::future<>(s3::client&)>;
+
+    /// Run one of the requests that start, complete or abort the multipart
+    /// upload. The request is retried until it succeeds or the retry
+    /// budget of 'fib' is exhausted.
+    ss::future<upload_result> do_multipart_request(
+      const s3::bucket_name& bucket,
+      const s3::object_key& path,
+      std::string_view request_name,
+      const multipart_request& request,
+      retry_chain_node& fib);
+
+    /// Upload all parts that are not yet in 'parts'. Parts that failed
+    /// with a retryable error are left empty. The first part that fails
+    /// with an error that can't be retried cancels the remaining parts.
+    /// \return upload_result::failed if some part failed with an error that
+    ///         can't be retried, nullopt otherwise
+    ss::future<std::optional<upload_result>> upload_parts(
+      const s3::bucket_name& bucket,
+      const s3::object_key& path,
+      const s3::upload_id& id,
+      uint64_t content_length,
+      const reset_input_stream_range& reset_str,
+      size_t part_size,
+      size_t max_concurrency,
+      std::vector<std::optional<s3::completed_part>>& parts,
+      retry_chain_node& fib);
+
     s3::client_pool _pool;
     ss::gate _gate;
     ss::abort_source _as;
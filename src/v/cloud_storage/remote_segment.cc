@@ -15,6 +15,7 @@
 #include "cloud_storage/logger.h"
 #include "cloud_storage/partition_manifest.h"
 #include "cloud_storage/remote_segment_index.h"
+#include "cloud_storage/segment_index_manifest.h"
 #include "cloud_storage/tx_range_manifest.h"
 #include "cloud_storage/types.h"
 #include "config/configuration.h"
@@ -110,6 +111,9 @@ remote_segment::remote_segment(
     _max_rp_offset = meta->committed_offset;
     _base_offset_delta = std::clamp(
       meta->delta_offset, model::offset(0), model::offset::max());
+    _size_bytes = meta->size_bytes;
+    _chunk_size
+      = config::shard_local_cfg().cloud_storage_hydration_chunk_size();
 
     // run hydration loop in the background
     ssx::background = run_hydrate_bg();
@@ -186,6 +190,71 @@ remote_segment::data_stream(size_t pos, ss::io_priority_class io_priority) {
     co_return storage::segment_reader_handle(std::move(data_stream));
 }
 
+/// Data source which reads a remote segment chunk by chunk, hydrating the
+/// chunks on demand. The next chunks are prefetched as the reader moves into
+/// a new chunk, so sequential reads don't have to wait for the download.
+class chunked_segment_data_source final : public ss::data_source_impl {
+public:
+    chunked_segment_data_source(
+      remote_segment& segment, uint64_t pos, ss::io_priority_class io_priority)
+      : _segment(segment)
+      , _pos(pos)
+      , _io_priority(io_priority) {}
+
+    ss::future<ss::temporary_buffer<char>> get() override {
+        while (_pos < _segment.size_bytes()) {
+            if (!_chunk_stream) {
+                co_await open_next_chunk();
+            }
+            auto buf = co_await _chunk_stream->read();
+            if (buf.empty()) {
+                co_await close_chunk();
+                continue;
+            }
+            _pos += buf.size();
+            co_return buf;
+        }
+        co_return ss::temporary_buffer<char>{};
+    }
+
+    ss::future<> close() override { return close_chunk(); }
+
+private:
+    ss::future<> open_next_chunk() {
+        const auto chunk_size = _segment.chunk_size();
+        const auto chunk_start = _pos - _pos % chunk_size;
+        const auto chunk_end = std::min(
+          chunk_start + chunk_size, _segment.size_bytes());
+        _chunk_file = co_await _segment.open_chunk(chunk_start);
+        _segment.prefetch_chunks(chunk_start);
+        ss::file_input_stream_options options{};
+        options.buffer_size
+          = config::shard_local_cfg().storage_read_buffer_size();
+        options.read_ahead
+          = config::shard_local_cfg().storage_read_readahead_count();
+        options.io_priority_class = _io_priority;
+        _chunk_stream = ss::make_file_input_stream(
+          _chunk_file, _pos - chunk_start, chunk_end - _pos, options);
+    }
+
+    ss::future<> close_chunk() {
+        if (_chunk_stream) {
+            co_await _chunk_stream->close();
+            _chunk_stream.reset();
+        }
+        if (_chunk_file) {
+            co_await _chunk_file.close();
+            _chunk_file = ss::file{};
+        }
+    }
+
+    remote_segment& _segment;
+    uint64_t _pos;
+    ss::io_priority_class _io_priority;
+    ss::file _chunk_file;
+    std::optional<ss::input_stream<char>> _chunk_stream;
+};
+
 ss::future<remote_segment::input_stream_with_offsets>
 remote_segment::offset_data_stream(
   model::offset kafka_offset, ss::io_priority_class io_priority) {
@@ -194,6 +263,26 @@ remote_segment::offset_data_stream(
       "remote segment file input stream at offset {}",
       kafka_offset);
     ss::gate::holder g(_gate);
+    if (co_await use_chunked_hydration()) {
+        auto pos = maybe_get_offsets(kafka_offset)
+                     .value_or(offset_index::find_result{
+                       .rp_offset = _base_rp_offset,
+                       .kaf_offset = _base_rp_offset - _base_offset_delta,
+                       .file_pos = 0,
+                     });
+        vlog(
+          _ctxlog.debug,
+          "serving offset {} from chunks starting at file position {}",
+          kafka_offset,
+          pos.file_pos);
+        co_return input_stream_with_offsets{
+          .stream = ss::input_stream<char>(
+            ss::data_source(std::make_unique<chunked_segment_data_source>(
+              *this, pos.file_pos, io_priority))),
+          .rp_offset = pos.rp_offset,
+          .kafka_offset = pos.kaf_offset,
+        };
+    }
     co_await hydrate();
     auto pos = maybe_get_offsets(kafka_offset)
                  .value_or(offset_index::find_result{
@@ -276,7 +365,8 @@ ss::future<> remote_segment::do_hydrate_segment() {
         }
         if (index_prepared) {
             auto index_stream = make_iobuf_input_stream(tmpidx.to_iobuf());
-            co_await _cache.put(_path().native() + ".index", index_stream);
+            co_await _cache.put(
+              generate_remote_index_path(_path)(), index_stream);
             _index = std::move(tmpidx);
         }
         co_return size_bytes;
@@ -299,6 +389,194 @@ ss::future<> remote_segment::do_hydrate_segment() {
     }
 }
 
+ss::future<bool> remote_segment::use_chunked_hydration() {
+    if (_chunk_size == 0 || _data_file) {
+        co_return false;
+    }
+    if (
+      co_await _cache.is_cached(_path)
+      != cache_element_status::not_available) {
+        co_return false;
+    }
+    if (!_index) {
+        co_await hydrate_index();
+    }
+    // Without the index the reader would have to scan the segment from the
+    // beginning, so the segment is hydrated as a whole instead.
+    co_return _index.has_value();
+}
+
+ss::future<> remote_segment::hydrate_index() {
+    ss::gate::holder guard(_gate);
+    if (_index_hydration) {
+        co_await _index_hydration->get_shared_future();
+        co_return;
+    }
+    _index_hydration.emplace();
+    try {
+        co_await do_hydrate_index();
+    } catch (...) {
+        vlog(
+          _ctxlog.debug,
+          "Failed to hydrate segment index: {}",
+          std::current_exception());
+    }
+    auto pr = std::move(*_index_hydration);
+    _index_hydration.reset();
+    pr.set_value();
+}
+
+ss::future<> remote_segment::do_hydrate_index() {
+    co_await maybe_materialize_index();
+    if (_index || _index_unavailable) {
+        co_return;
+    }
+    retry_chain_node local_rtc(
+      cache_hydration_timeout, cache_hydration_backoff, &_rtc);
+
+    segment_index_manifest manifest(_path);
+
+    auto res = co_await _api.download_manifest(
+      _bucket, manifest.get_manifest_path(), manifest, local_rtc);
+
+    if (res == download_result::notfound) {
+        // Segments uploaded by older versions don't have the index
+        vlog(
+          _ctxlog.debug,
+          "Segment index {} doesn't exist in the bucket",
+          manifest.get_manifest_path());
+        _index_unavailable = true;
+        co_return;
+    } else if (res != download_result::success) {
+        throw download_exception(res, manifest.get_manifest_path()());
+    }
+    auto state = std::move(manifest).get_index();
+    offset_index ix(
+      _base_rp_offset,
+      _base_rp_offset - _base_offset_delta,
+      0,
+      remote_segment_sampling_step_bytes);
+    ix.from_iobuf(state.copy());
+    auto index_stream = make_iobuf_input_stream(std::move(state));
+    co_await _cache.put(generate_remote_index_path(_path)(), index_stream);
+    _index = std::move(ix);
+    vlog(_ctxlog.debug, "Segment index hydrated");
+}
+
+std::filesystem::path
+remote_segment::get_chunk_path(uint64_t chunk_start) const {
+    // chunk size is a part of the name since it can be changed at runtime
+    return fmt::format(
+      "{}.chunk.{}_{}", _path().native(), chunk_start, _chunk_size);
+}
+
+ss::future<ss::file> remote_segment::open_chunk(uint64_t chunk_start) {
+    ss::gate::holder guard(_gate);
+    const auto path = get_chunk_path(chunk_start);
+    while (true) {
+        co_await hydrate_chunk(chunk_start);
+        if (auto item = co_await _cache.get(path); item.has_value()) {
+            co_return item->body;
+        }
+        // The chunk got evicted right after it was hydrated
+        vlog(_ctxlog.info, "Chunk {} evicted, re-hydrating", path);
+    }
+}
+
+void remote_segment::prefetch_chunks(uint64_t chunk_start) {
+    const auto prefetch
+      = config::shard_local_cfg().cloud_storage_hydration_prefetch_chunks();
+    for (size_t i = 1; i <= prefetch; i++) {
+        const auto next = chunk_start + i * _chunk_size;
+        if (next >= _size_bytes) {
+            break;
+        }
+        ssx::spawn_with_gate(_gate, [this, next] {
+            return hydrate_chunk(next).handle_exception(
+              [this, next](std::exception_ptr e) {
+                  vlog(
+                    _ctxlog.debug,
+                    "Failed to prefetch chunk at {}: {}",
+                    next,
+                    e);
+              });
+        });
+    }
+}
+
+ss::future<> remote_segment::hydrate_chunk(uint64_t chunk_start) {
+    ss::gate::holder guard(_gate);
+    while (true) {
+        if (auto it = _chunks_in_progress.find(chunk_start);
+            it != _chunks_in_progress.end()) {
+            co_await it->second.get_shared_future();
+        }
+        auto status = co_await _cache.is_cached(get_chunk_path(chunk_start));
+        if (status == cache_element_status::available) {
+            co_return;
+        }
+        if (_chunks_in_progress.contains(chunk_start)) {
+            // somebody started the download while we were checking the cache
+            continue;
+        }
+        _chunks_in_progress.emplace(chunk_start, ss::shared_promise<>{});
+        std::exception_ptr err;
+        try {
+            co_await do_hydrate_chunk(chunk_start);
+        } catch (...) {
+            err = std::current_exception();
+        }
+        auto node = _chunks_in_progress.extract(chunk_start);
+        if (err) {
+            node.mapped().set_exception(err);
+            std::rethrow_exception(err);
+        }
+        node.mapped().set_value();
+        co_return;
+    }
+}
+
+ss::future<> remote_segment::do_hydrate_chunk(uint64_t chunk_start) {
+    const auto path = get_chunk_path(chunk_start);
+    const auto last = std::min(chunk_start + _chunk_size, _size_bytes) - 1;
+    vlog(
+      _ctxlog.debug,
+      "Hydrating chunk {}, bytes {}-{}",
+      path,
+      chunk_start,
+      last);
+    auto callback = [this, &path](
+                      uint64_t size_bytes,
+                      ss::input_stream<char> s) -> ss::future<uint64_t> {
+        co_await _cache.put(path, s).finally([&s] { return s.close(); });
+        co_return size_bytes;
+    };
+
+    retry_chain_node local_rtc(
+      cache_hydration_timeout, cache_hydration_backoff, &_rtc);
+
+    auto res = co_await _api.download_segment(
+      _bucket,
+      _path,
+      callback,
+      local_rtc,
+      s3::byte_range{.first = chunk_start, .last = last});
+
+    if (res != download_result::success) {
+        vlog(_ctxlog.debug, "Failed to hydrate chunk {}", path);
+        throw download_exception(res, path);
+    }
+}
+
+ss::future<> remote_segment::hydrate_txrange() {
+    if (_tx_range) {
+        co_return;
+    }
+    if (!co_await do_materialize_txrange()) {
+        co_await do_hydrate_txrange();
+    }
+}
+
 ss::future<> remote_segment::do_hydrate_txrange() {
     ss::gate::holder guard(_gate);
     retry_chain_node local_rtc(
@@ -401,7 +679,7 @@ ss::future<bool> remote_segment::do_materialize_txrange() {
 
 ss::future<> remote_segment::maybe_materialize_index() {
     ss::gate::holder guard(_gate);
-    auto path = _path().native() + ".index";
+    auto path = generate_remote_index_path(_path)();
     offset_index ix(
       _base_rp_offset,
       _base_rp_offset - _base_offset_delta,
@@ -617,7 +895,13 @@ ss::future<> remote_segment::hydrate() {
 
 ss::future<std::vector<cluster::rm_stm::tx_range>>
 remote_segment::aborted_transactions(model::offset from, model::offset to) {
-    co_await hydrate();
+    if (co_await use_chunked_hydration()) {
+        // readers are served by chunks, there is no need to hydrate the
+        // whole segment to get its tx manifest
+        co_await hydrate_txrange();
+    } else {
+        co_await hydrate();
+    }
     std::vector<cluster::rm_stm::tx_range> result;
     if (!_tx_range) {
         // We got NoSuchKey when we tried to download the
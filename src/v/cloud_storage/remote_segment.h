@@ -31,9 +31,12 @@
 #include <seastar/core/condition-variable.hh>
 #include <seastar/core/expiring_fifo.hh>
 #include <seastar/core/io_priority_class.hh>
+#include <seastar/core/shared_future.hh>
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/temporary_buffer.hh>
 
+#include <absl/container/node_hash_map.h>
+
 namespace cloud_storage {
 
 static constexpr size_t remote_segment_sampling_step_bytes = 64_KiB;
@@ -115,6 +118,18 @@ public:
     /// Hydrate the segment
     ss::future<> hydrate();
 
+    /// Hydrate the chunk of the segment which starts at 'chunk_start' (byte
+    /// position in the segment file) and open it. Only used when chunked
+    /// hydration is enabled.
+    ss::future<ss::file> open_chunk(uint64_t chunk_start);
+
+    /// Hydrate chunks following 'chunk_start' in the background
+    void prefetch_chunks(uint64_t chunk_start);
+
+    uint64_t chunk_size() const { return _chunk_size; }
+
+    uint64_t size_bytes() const { return _size_bytes; }
+
     retry_chain_node* get_retry_chain_node() { return &_rtc; }
 
     bool download_in_progress() const noexcept { return !_wait_list.empty(); }
@@ -154,6 +169,25 @@ private:
     /// Load segment index from file (if available)
     ss::future<> maybe_materialize_index();
 
+    /// True if the reader can be served by chunks of the segment instead of
+    /// hydrating it as a whole. This is the case when chunked hydration is
+    /// enabled, the segment isn't hydrated and its index can be downloaded
+    /// to locate the chunk which contains the requested offset.
+    ss::future<bool> use_chunked_hydration();
+
+    /// Download the segment index uploaded alongside the segment unless it's
+    /// already materialized. Concurrent callers share one download.
+    ss::future<> hydrate_index();
+    ss::future<> do_hydrate_index();
+
+    /// Download a chunk into the cache unless it's already there
+    ss::future<> hydrate_chunk(uint64_t chunk_start);
+    ss::future<> do_hydrate_chunk(uint64_t chunk_start);
+    std::filesystem::path get_chunk_path(uint64_t chunk_start) const;
+
+    /// Hydrate tx manifest without hydrating the segment
+    ss::future<> hydrate_txrange();
+
     ss::gate _gate;
     remote& _api;
     cache& _cache;
@@ -165,6 +199,9 @@ private:
     model::offset _base_rp_offset;
     model::offset _base_offset_delta;
     model::offset _max_rp_offset;
+    uint64_t _size_bytes;
+    /// Chunk size used for chunked hydration, 0 if disabled
+    uint64_t _chunk_size;
 
     retry_chain_node _rtc;
     retry_chain_logger _ctxlog;
@@ -181,6 +218,13 @@ private:
 
     using tx_range_vec = fragmented_vector<cluster::rm_stm::tx_range>;
     std::optional<tx_range_vec> _tx_range;
+
+    /// Chunks being downloaded, keyed by their start position
+    absl::node_hash_map<uint64_t, ss::shared_promise<>> _chunks_in_progress;
+    /// Set while the segment index is being downloaded
+    std::optional<ss::shared_promise<>> _index_hydration;
+    /// The segment was uploaded without the index
+    bool _index_unavailable{false};
 };
 
 class remote_segment_batch_consumer;
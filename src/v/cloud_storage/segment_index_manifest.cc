@@ -0,0 +1,49 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/segment_index_manifest.h"
+
+#include "bytes/iobuf.h"
+
+#include <seastar/core/iostream.hh>
+
+namespace cloud_storage {
+
+remote_manifest_path
+generate_remote_index_path(const remote_segment_path& path) {
+    return remote_manifest_path(fmt::format("{}.index", path().native()));
+}
+
+segment_index_manifest::segment_index_manifest(
+  remote_segment_path spath, iobuf index)
+  : _path(std::move(spath))
+  , _index(std::move(index)) {}
+
+segment_index_manifest::segment_index_manifest(remote_segment_path spath)
+  : _path(std::move(spath)) {}
+
+ss::future<> segment_index_manifest::update(ss::input_stream<char> is) {
+    iobuf result;
+    auto os = make_iobuf_ref_output_stream(result);
+    co_await ss::copy(is, os);
+    _index = std::move(result);
+}
+
+serialized_json_stream segment_index_manifest::serialize() const {
+    return {
+      .stream = make_iobuf_input_stream(_index.copy()),
+      .size_bytes = _index.size_bytes()};
+}
+
+remote_manifest_path segment_index_manifest::get_manifest_path() const {
+    return generate_remote_index_path(_path);
+}
+
+} // namespace cloud_storage
@@ -0,0 +1,55 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "cloud_storage/base_manifest.h"
+#include "cloud_storage/types.h"
+
+namespace cloud_storage {
+
+/// Segment index path in S3
+remote_manifest_path
+generate_remote_index_path(const remote_segment_path& path);
+
+/// Serialized offset_index of the segment. It's uploaded alongside the
+/// segment with (.index) suffix so readers can locate the byte range that
+/// contains an offset without downloading the segment.
+class segment_index_manifest final : public base_manifest {
+public:
+    /// Create manifest for the serialized index of the segment
+    segment_index_manifest(remote_segment_path spath, iobuf index);
+
+    /// Create empty manifest that supposed to be updated later
+    explicit segment_index_manifest(remote_segment_path spath);
+
+    /// Update manifest file from input_stream (remote set)
+    ss::future<> update(ss::input_stream<char> is) override;
+
+    /// Serialize manifest object
+    ///
+    /// \return asynchronous input_stream with the serialized index
+    serialized_json_stream serialize() const override;
+
+    /// Manifest object name in S3
+    remote_manifest_path get_manifest_path() const override;
+
+    manifest_type get_manifest_type() const override {
+        return manifest_type::segment_index;
+    };
+
+    iobuf&& get_index() && { return std::move(_index); }
+
+private:
+    remote_segment_path _path;
+    iobuf _index;
+};
+} // namespace cloud_storage
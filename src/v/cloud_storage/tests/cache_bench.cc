@@ -36,3 +36,24 @@ static void run_test(int test_scale) {
 PERF_TEST(cache_utils, cm_sketch_1000) { run_test(1000); }
 
 PERF_TEST(cache_utils, cm_sketch_10000) { run_test(10000); }
+
+static void run_eviction_test(int test_scale) {
+    cloud_storage::access_time_tracker tracker;
+    for (int i = 0; i < test_scale; i++) {
+        tracker.add(ssx::sformat("name-{}", i), make_ts(i), 1024);
+    }
+    // Evict 1% of the cache, only the evicted entries should be visited
+    perf_tests::start_measuring_time();
+    auto candidates = tracker.eviction_candidates(
+      tracker.total_size() / 100);
+    perf_tests::do_not_optimize(candidates);
+    perf_tests::stop_measuring_time();
+}
+
+PERF_TEST(cache_utils, eviction_candidates_100000) {
+    run_eviction_test(100000);
+}
+
+PERF_TEST(cache_utils, eviction_candidates_1000000) {
+    run_eviction_test(1000000);
+}
@@ -12,6 +12,7 @@
 #include "cache_test_fixture.h"
 #include "cloud_storage/access_time_tracker.h"
 #include "cloud_storage/cache_service.h"
+#include "ssx/sformat.h"
 #include "test_utils/fixture.h"
 #include "units.h"
 
@@ -196,6 +197,22 @@ FIXTURE_TEST(eviction_cleans_directory, cache_test_fixture) {
     BOOST_CHECK(ss::file_exists(CACHE_DIR.native()).get());
 }
 
+FIXTURE_TEST(eviction_skips_externally_removed_files, cache_test_fixture) {
+    auto data_string1 = create_data_string('a', 1_MiB + 1_KiB);
+    put_into_cache(data_string1, KEY);
+    ss::sleep(1s).get();
+    // The file is removed behind the cache's back, the index still has it
+    ss::remove_file((CACHE_DIR / KEY).native()).get();
+
+    auto data_string2 = create_data_string('b', 1_MiB + 1_KiB);
+    put_into_cache(data_string2, KEY2);
+
+    ss::sleep(ss::lowres_clock::duration(2s)).get();
+
+    BOOST_CHECK_EQUAL(0, sharded_cache.local().get_total_cleaned());
+    BOOST_REQUIRE(ss::file_exists((CACHE_DIR / KEY2).native()).get());
+}
+
 FIXTURE_TEST(invalidate_outside_cache_dir_throws, cache_test_fixture) {
     // make sure the cache directory is empty to get reliable results
     ss::recursive_touch_directory(CACHE_DIR.native()).get();
@@ -362,10 +379,40 @@ SEASTAR_THREAD_TEST_CASE(test_access_time_tracker_serializer) {
     }
 
     access_time_tracker out;
-    out.from_iobuf(in.to_iobuf());
+    out.from_iobuf(in.to_iobuf().get());
 
     for (int i = 0; i < 10; i++) {
         auto ts = out.estimate_timestamp(names[i]);
         BOOST_REQUIRE(ts.value() >= timestamps[i]);
     }
 }
+
+SEASTAR_THREAD_TEST_CASE(test_access_time_tracker_eviction_candidates) {
+    access_time_tracker in;
+    for (int i = 0; i < 10; i++) {
+        in.add(ssx::sformat("key{}", i), make_ts(1653000000 + i), 100);
+    }
+    // key0 becomes the most recently used file
+    in.add_timestamp("key0", make_ts(1653000010));
+    BOOST_REQUIRE_EQUAL(in.total_size(), 1000);
+
+    auto candidates = in.eviction_candidates(250);
+    BOOST_REQUIRE_EQUAL(candidates.size(), 3);
+    BOOST_REQUIRE_EQUAL(candidates[0].path, "key1");
+    BOOST_REQUIRE_EQUAL(candidates[1].path, "key2");
+    BOOST_REQUIRE_EQUAL(candidates[2].path, "key3");
+    BOOST_REQUIRE_EQUAL(candidates[0].size, 100);
+
+    in.remove_timestamp("key1");
+    BOOST_REQUIRE_EQUAL(in.total_size(), 900);
+    BOOST_REQUIRE_EQUAL(in.size(), 9);
+
+    access_time_tracker out;
+    out.from_iobuf(in.to_iobuf().get());
+    BOOST_REQUIRE_EQUAL(out.total_size(), 900);
+    BOOST_REQUIRE_EQUAL(out.size(), 9);
+    candidates = out.eviction_candidates(1000);
+    BOOST_REQUIRE_EQUAL(candidates.size(), 9);
+    BOOST_REQUIRE_EQUAL(candidates.front().path, "key2");
+    BOOST_REQUIRE_EQUAL(candidates.back().path, "key0");
+}
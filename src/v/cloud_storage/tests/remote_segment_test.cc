@@ -14,10 +14,14 @@
 #include "cloud_storage/partition_manifest.h"
 #include "cloud_storage/remote.h"
 #include "cloud_storage/remote_segment.h"
+#include "cloud_storage/remote_segment_index.h"
+#include "cloud_storage/segment_index_manifest.h"
 #include "cloud_storage/tests/cloud_storage_fixture.h"
 #include "cloud_storage/tests/common_def.h"
 #include "cloud_storage/types.h"
+#include "config/configuration.h"
 #include "model/metadata.h"
+#include "model/record_batch_types.h"
 #include "model/timeout_clock.h"
 #include "s3/client.h"
 #include "seastarx.h"
@@ -29,6 +33,7 @@
 #include "storage/types.h"
 #include "test_utils/async.h"
 #include "test_utils/fixture.h"
+#include "units.h"
 #include "utils/retry_chain_node.h"
 
 #include <seastar/core/future.hh>
@@ -419,3 +424,192 @@ FIXTURE_TEST(
     reader.stop().get();
     segment->stop().get();
 }
+
+/// Upload the segment which consists of 'num_batches' single record batches
+/// with 4KiB records. If 'with_index' is set the segment index is uploaded
+/// alongside the segment.
+static remote_segment_path upload_chunked_segment(
+  remote& remote,
+  const s3::bucket_name& bucket,
+  partition_manifest& m,
+  const partition_manifest::key& key,
+  iobuf& segment_bytes,
+  int num_batches,
+  bool with_index) {
+    segment_bytes = generate_segment(
+      model::offset(1),
+      std::vector<batch_t>(
+        num_batches,
+        batch_t{
+          .num_records = 1,
+          .type = model::record_batch_type::raft_data,
+          .record_sizes = {4_KiB}}));
+    uint64_t clen = segment_bytes.size_bytes();
+    auto reset_stream = make_reset_fn(segment_bytes);
+    retry_chain_node fib(1000ms, 200ms);
+    partition_manifest::segment_meta meta{
+      .is_compacted = false,
+      .size_bytes = segment_bytes.size_bytes(),
+      .base_offset = model::offset(1),
+      .committed_offset = model::offset(num_batches),
+      .base_timestamp = {},
+      .max_timestamp = {},
+      .delta_offset = model::offset(0),
+      .ntp_revision = model::initial_revision_id(777)};
+    auto path = m.generate_segment_path(key, meta);
+    auto upl_res = remote
+                     .upload_segment(
+                       bucket, path, clen, reset_stream, fib, always_continue)
+                     .get();
+    BOOST_REQUIRE(upl_res == upload_result::success);
+    m.add(key, meta);
+    if (with_index) {
+        offset_index ix(
+          model::offset(1),
+          model::offset(1),
+          0,
+          remote_segment_sampling_step_bytes);
+        auto builder = make_remote_segment_index_builder(
+          make_iobuf_input_stream(iobuf_deep_copy(segment_bytes)),
+          ix,
+          model::offset(0),
+          remote_segment_sampling_step_bytes);
+        builder->consume().get();
+        builder->close().get();
+        segment_index_manifest index(path, ix.to_iobuf());
+        BOOST_REQUIRE(
+          remote.upload_manifest(bucket, index, fib).get()
+          == upload_result::success);
+    }
+    return path;
+}
+
+FIXTURE_TEST(
+  test_remote_segment_chunked_download, cloud_storage_fixture) { // NOLINT
+    set_expectations_and_listen({});
+    auto conf = get_configuration();
+    auto bucket = s3::bucket_name("bucket");
+    remote remote(s3_connection_limit(10), conf, config_file);
+    auto action = ss::defer([&remote] { remote.stop().get(); });
+    partition_manifest m(manifest_ntp, manifest_revision);
+    auto key = partition_manifest::key{
+      .base_offset = model::offset(1), .term = model::term_id(2)};
+    iobuf segment_bytes;
+    auto path = upload_chunked_segment(
+      remote, bucket, m, key, segment_bytes, 40, true);
+
+    std::vector<model::record_batch_header> headers;
+    std::vector<iobuf> records;
+    std::vector<uint64_t> file_offsets;
+    auto parser = make_recording_batch_parser(
+      iobuf_deep_copy(segment_bytes), headers, records, file_offsets);
+    parser->consume().get();
+    parser->close().get();
+
+    const size_t chunk_size = 4_KiB;
+    config::shard_local_cfg()
+      .get("cloud_storage_hydration_chunk_size")
+      .set_value(chunk_size);
+    auto reset_cfg = ss::defer([] {
+        config::shard_local_cfg()
+          .get("cloud_storage_hydration_chunk_size")
+          .set_value(size_t(0));
+    });
+
+    retry_chain_node fib(1000ms, 200ms);
+    remote_segment segment(remote, cache.local(), bucket, m, key, fib);
+    auto stream_off = segment
+                        .offset_data_stream(
+                          headers.back().base_offset,
+                          ss::default_priority_class())
+                        .get();
+    iobuf downloaded;
+    auto rds = make_iobuf_ref_output_stream(downloaded);
+    ss::copy(stream_off.stream, rds).get();
+    stream_off.stream.close().get();
+    segment.stop().get();
+
+    // The reader starts at the indexed position in front of the offset
+    auto it = std::find_if(
+      headers.begin(), headers.end(), [&stream_off](const auto& hdr) {
+          return hdr.base_offset == stream_off.rp_offset;
+      });
+    BOOST_REQUIRE(it != headers.end());
+    auto file_pos = file_offsets.at(std::distance(headers.begin(), it));
+    BOOST_REQUIRE(file_pos >= remote_segment_sampling_step_bytes);
+    BOOST_REQUIRE(
+      downloaded
+      == segment_bytes.share(file_pos, segment_bytes.size_bytes() - file_pos));
+    BOOST_REQUIRE(
+      cache.local().is_cached(path()).get()
+      == cache_element_status::not_available);
+    BOOST_REQUIRE(
+      cache.local().is_cached(generate_remote_index_path(path)()).get()
+      == cache_element_status::available);
+    // Only the chunks starting from the indexed position are downloaded
+    size_t ranged_requests = 0;
+    for (const auto& req : get_requests()) {
+        if (
+          req._method == "GET"
+          && req._url == ss::sstring("/" + path().native())) {
+            auto range = req.get_header("Range");
+            BOOST_REQUIRE(!range.empty());
+            BOOST_REQUIRE(range.find("bytes=0-") != 0);
+            ranged_requests++;
+        }
+    }
+    const auto num_chunks = (segment_bytes.size_bytes() - file_pos
+                             + chunk_size - 1)
+                            / chunk_size;
+    BOOST_REQUIRE_LE(ranged_requests, num_chunks + 1);
+}
+
+FIXTURE_TEST(
+  test_remote_segment_chunked_download_no_index,
+  cloud_storage_fixture) { // NOLINT
+    set_expectations_and_listen({});
+    auto conf = get_configuration();
+    auto bucket = s3::bucket_name("bucket");
+    remote remote(s3_connection_limit(10), conf, config_file);
+    auto action = ss::defer([&remote] { remote.stop().get(); });
+    partition_manifest m(manifest_ntp, manifest_revision);
+    auto key = partition_manifest::key{
+      .base_offset = model::offset(1), .term = model::term_id(2)};
+    iobuf segment_bytes;
+    auto path = upload_chunked_segment(
+      remote, bucket, m, key, segment_bytes, 40, false);
+
+    config::shard_local_cfg()
+      .get("cloud_storage_hydration_chunk_size")
+      .set_value(size_t(4_KiB));
+    auto reset_cfg = ss::defer([] {
+        config::shard_local_cfg()
+          .get("cloud_storage_hydration_chunk_size")
+          .set_value(size_t(0));
+    });
+
+    retry_chain_node fib(1000ms, 200ms);
+    remote_segment segment(remote, cache.local(), bucket, m, key, fib);
+    auto stream_off = segment
+                        .offset_data_stream(
+                          model::offset(1), ss::default_priority_class())
+                        .get();
+    iobuf downloaded;
+    auto rds = make_iobuf_ref_output_stream(downloaded);
+    ss::copy(stream_off.stream, rds).get();
+    stream_off.stream.close().get();
+    segment.stop().get();
+
+    // Without the index the segment is hydrated as a whole
+    BOOST_REQUIRE(downloaded == segment_bytes);
+    BOOST_REQUIRE(
+      cache.local().is_cached(path()).get()
+      == cache_element_status::available);
+    for (const auto& req : get_requests()) {
+        if (
+          req._method == "GET"
+          && req._url == ss::sstring("/" + path().native())) {
+            BOOST_REQUIRE(req.get_header("Range").empty());
+        }
+    }
+}
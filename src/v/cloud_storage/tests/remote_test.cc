@@ -175,6 +175,121 @@ FIXTURE_TEST(
     BOOST_REQUIRE(get_requests().empty());
 }
 
+FIXTURE_TEST(test_upload_segment_multipart, s3_imposter_fixture) { // NOLINT
+    set_expectations_and_listen({});
+    // The second part fails on the first attempt and has to be re-uploaded,
+    // other parts should be uploaded only once
+    fail_parts_once({2});
+    auto conf = get_configuration();
+    remote remote(s3_connection_limit(10), conf, config_file);
+    auto name = segment_name("1-2-v1.log");
+    auto path = generate_remote_segment_path(
+      manifest_ntp, manifest_revision, name, model::term_id{123});
+    uint64_t clen = manifest_payload.size();
+    constexpr size_t part_size = 100;
+    auto action = ss::defer([&remote] { remote.stop().get(); });
+    auto reset_stream = [](size_t offset, size_t length)
+      -> ss::future<storage::segment_reader_handle> {
+        iobuf out;
+        out.append(manifest_payload.data() + offset, length);
+        co_return storage::segment_reader_handle(
+          make_iobuf_input_stream(std::move(out)));
+    };
+    retry_chain_node fib(1s, 20ms);
+    auto res = remote
+                 .upload_segment_multipart(
+                   s3::bucket_name("bucket"),
+                   path,
+                   clen,
+                   reset_stream,
+                   part_size,
+                   2,
+                   fib,
+                   always_continue)
+                 .get();
+    BOOST_REQUIRE(res == upload_result::success);
+
+    const size_t num_parts = (clen + part_size - 1) / part_size;
+    std::map<ss::sstring, size_t> attempts;
+    for (const auto& req : get_requests()) {
+        if (req._method == "PUT") {
+            attempts[req.get_query_param("partNumber")]++;
+        }
+    }
+    BOOST_REQUIRE_EQUAL(attempts.size(), num_parts);
+    for (const auto& [part, cnt] : attempts) {
+        BOOST_REQUIRE_EQUAL(cnt, part == "2" ? 2 : 1);
+    }
+
+    iobuf downloaded;
+    auto try_consume = [&downloaded](
+                         uint64_t len,
+                         ss::input_stream<char> is) -> ss::future<uint64_t> {
+        downloaded.clear();
+        auto rds = make_iobuf_ref_output_stream(downloaded);
+        co_await ss::copy(is, rds);
+        co_return downloaded.size_bytes();
+    };
+    auto dl_res = remote
+                    .download_segment(
+                      s3::bucket_name("bucket"), path, try_consume, fib)
+                    .get();
+    BOOST_REQUIRE(dl_res == download_result::success);
+    iobuf_parser p(std::move(downloaded));
+    auto actual = p.read_string(p.bytes_left());
+    BOOST_REQUIRE(actual == manifest_payload);
+}
+
+FIXTURE_TEST(
+  test_upload_segment_multipart_permanent_failure,
+  s3_imposter_fixture) { // NOLINT
+    set_expectations_and_listen({});
+    // The first part can't be uploaded, the remaining parts should be
+    // cancelled instead of being uploaded
+    reject_parts({1});
+    auto conf = get_configuration();
+    remote remote(s3_connection_limit(10), conf, config_file);
+    auto name = segment_name("1-2-v1.log");
+    auto path = generate_remote_segment_path(
+      manifest_ntp, manifest_revision, name, model::term_id{123});
+    uint64_t clen = manifest_payload.size();
+    constexpr size_t part_size = 100;
+    auto action = ss::defer([&remote] { remote.stop().get(); });
+    auto reset_stream = [](size_t offset, size_t length)
+      -> ss::future<storage::segment_reader_handle> {
+        iobuf out;
+        out.append(manifest_payload.data() + offset, length);
+        co_return storage::segment_reader_handle(
+          make_iobuf_input_stream(std::move(out)));
+    };
+    retry_chain_node fib(1s, 20ms);
+    auto res = remote
+                 .upload_segment_multipart(
+                   s3::bucket_name("bucket"),
+                   path,
+                   clen,
+                   reset_stream,
+                   part_size,
+                   1,
+                   fib,
+                   always_continue)
+                 .get();
+    BOOST_REQUIRE(res == upload_result::failed);
+
+    size_t part_uploads = 0;
+    size_t aborts = 0;
+    for (const auto& req : get_requests()) {
+        if (req._method == "PUT") {
+            BOOST_REQUIRE_EQUAL(req.get_query_param("partNumber"), "1");
+            part_uploads++;
+        } else if (req._method == "DELETE") {
+            aborts++;
+        }
+    }
+    BOOST_REQUIRE_EQUAL(part_uploads, 1);
+    BOOST_REQUIRE_EQUAL(aborts, 1);
+}
+
 FIXTURE_TEST(test_upload_segment_timeout, s3_imposter_fixture) { // NOLINT
     auto conf = get_configuration();
     remote remote(s3_connection_limit(10), conf, config_file);
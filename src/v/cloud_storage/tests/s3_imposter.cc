@@ -68,6 +68,14 @@ s3_imposter_fixture::get_targets() const {
     return _targets;
 }
 
+void s3_imposter_fixture::fail_parts_once(std::set<size_t> part_numbers) {
+    _failing_parts = std::move(part_numbers);
+}
+
+void s3_imposter_fixture::reject_parts(std::set<size_t> part_numbers) {
+    _rejected_parts = std::move(part_numbers);
+}
+
 void s3_imposter_fixture::set_expectations_and_listen(
   const std::vector<s3_imposter_fixture::expectation>& expectations) {
     _server
@@ -107,6 +115,23 @@ void s3_imposter_fixture::set_routes(
               request._url,
               request.content_length,
               request._method);
+            if (request.query_parameters.contains("uploadId")) {
+                return handle_multipart(request, repl);
+            }
+            if (
+              request._method == "POST"
+              && request.query_parameters.contains("uploads")) {
+                auto id = ssx::sformat("upload-{}", next_upload_id++);
+                uploads[id] = {};
+                return ssx::sformat(
+                  R"xml(<?xml version="1.0" encoding="UTF-8"?>
+                        <InitiateMultipartUploadResult>
+                            <Key>{}</Key>
+                            <UploadId>{}</UploadId>
+                        </InitiateMultipartUploadResult>)xml",
+                  request._url,
+                  id);
+            }
             if (request._method == "GET") {
                 auto it = expectations.find(request._url);
                 if (it == expectations.end() || !it->second.body.has_value()) {
@@ -114,6 +139,15 @@ void s3_imposter_fixture::set_routes(
                     repl.set_status(reply::status_type::not_found);
                     return error_payload;
                 }
+                if (auto range = request.get_header("Range"); !range.empty()) {
+                    // Range: bytes={first}-{last}
+                    auto eq = range.find('=');
+                    auto dash = range.find('-');
+                    auto first = std::stoul(
+                      range.substr(eq + 1, dash - eq - 1));
+                    auto last = std::stoul(range.substr(dash + 1));
+                    return it->second.body->substr(first, last - first + 1);
+                }
                 return *it->second.body;
             } else if (request._method == "PUT") {
                 expectations[request._url] = {
@@ -151,7 +185,80 @@ void s3_imposter_fixture::set_routes(
             BOOST_FAIL("Unexpected request");
             return "";
         }
+        ss::sstring handle_multipart(const_req request, reply& repl) {
+            static const ss::sstring no_such_upload
+              = R"xml(<?xml version="1.0" encoding="UTF-8"?>
+                        <Error>
+                            <Code>NoSuchUpload</Code>
+                            <Message>Upload not found</Message>
+                            <Resource>resource</Resource>
+                            <RequestId>requestid</RequestId>
+                        </Error>)xml";
+            static const ss::sstring slow_down
+              = R"xml(<?xml version="1.0" encoding="UTF-8"?>
+                        <Error>
+                            <Code>SlowDown</Code>
+                            <Message>Slow down</Message>
+                            <Resource>resource</Resource>
+                            <RequestId>requestid</RequestId>
+                        </Error>)xml";
+            static const ss::sstring access_denied
+              = R"xml(<?xml version="1.0" encoding="UTF-8"?>
+                        <Error>
+                            <Code>AccessDenied</Code>
+                            <Message>Access denied</Message>
+                            <Resource>resource</Resource>
+                            <RequestId>requestid</RequestId>
+                        </Error>)xml";
+            auto id = request.get_query_param("uploadId");
+            auto it = uploads.find(id);
+            if (it == uploads.end()) {
+                repl.set_status(reply::status_type::not_found);
+                return no_such_upload;
+            }
+            if (request._method == "PUT") {
+                auto part = std::stoul(request.get_query_param("partNumber"));
+                if (fixture._failing_parts.erase(part) != 0) {
+                    vlog(fixt_log.trace, "Fail upload of part {}", part);
+                    repl.set_status(reply::status_type::service_unavailable);
+                    return slow_down;
+                }
+                if (fixture._rejected_parts.contains(part)) {
+                    vlog(fixt_log.trace, "Reject upload of part {}", part);
+                    repl.set_status(reply::status_type::forbidden);
+                    return access_denied;
+                }
+                it->second[part] = request.content;
+                repl.add_header("ETag", ssx::sformat("\"part-{}\"", part));
+                return "";
+            } else if (request._method == "POST") {
+                // Assemble the object from the parts in order
+                ss::sstring body;
+                for (const auto& [part, content] : it->second) {
+                    body += content;
+                }
+                expectations[request._url] = {
+                  .url = request._url, .body = std::move(body)};
+                uploads.erase(it);
+                return ssx::sformat(
+                  R"xml(<?xml version="1.0" encoding="UTF-8"?>
+                        <CompleteMultipartUploadResult>
+                            <Key>{}</Key>
+                            <ETag>"multipart"</ETag>
+                        </CompleteMultipartUploadResult>)xml",
+                  request._url);
+            } else if (request._method == "DELETE") {
+                uploads.erase(it);
+                repl.set_status(reply::status_type::no_content);
+                return "";
+            }
+            BOOST_FAIL("Unexpected multipart request");
+            return "";
+        }
         std::map<ss::sstring, expectation> expectations;
+        /// Parts of the incomplete multipart uploads by upload id
+        std::map<ss::sstring, std::map<size_t, ss::sstring>> uploads;
+        size_t next_upload_id{0};
         s3_imposter_fixture& fixture;
     };
     auto hd = ss::make_shared<content_handler>(expectations, *this);
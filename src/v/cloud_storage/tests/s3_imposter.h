@@ -20,6 +20,7 @@
 #include <chrono>
 #include <exception>
 #include <map>
+#include <set>
 #include <vector>
 
 /// Emulates S3 REST API for testing purposes.
@@ -31,6 +32,8 @@
 /// http response with error code 404 and xml formatted error message.
 /// If the body of the expectation is set by the user or PUT request it can
 /// be retrieved using the GET request or deleted using the DELETE request.
+/// Multipart uploads are supported, the object is created when the upload
+/// is completed.
 class s3_imposter_fixture {
 public:
     s3_imposter_fixture();
@@ -65,6 +68,14 @@ public:
     /// Access all http requests ordered by target url
     const std::multimap<ss::sstring, ss::httpd::request>& get_targets() const;
 
+    /// Reply with SlowDown error to the first attempt to upload any of
+    /// the parts (1-based part numbers) of a multipart upload
+    void fail_parts_once(std::set<size_t> part_numbers);
+
+    /// Reply with AccessDenied error, which can't be retried, to every
+    /// attempt to upload any of the parts of a multipart upload
+    void reject_parts(std::set<size_t> part_numbers);
+
     static s3::configuration get_configuration();
 
 private:
@@ -79,4 +90,8 @@ private:
     std::vector<ss::httpd::request> _requests;
     /// Contains all accessed target urls
     std::multimap<ss::sstring, ss::httpd::request> _targets;
+    /// Multipart upload parts that should fail on the first attempt
+    std::set<size_t> _failing_parts;
+    /// Multipart upload parts that should always fail
+    std::set<size_t> _rejected_parts;
 };
@@ -292,6 +292,7 @@ ss::future<> controller::start() {
             _raft_manager.local().raft_client(),
             std::ref(_shard_table),
             std::ref(_partition_manager),
+            std::ref(_hm_frontend),
             std::ref(_as),
             config::shard_local_cfg().enable_leader_balancer.bind(),
             config::shard_local_cfg().leader_balancer_idle_timeout.bind(),
@@ -299,6 +300,7 @@ ss::future<> controller::start() {
             config::shard_local_cfg().leader_balancer_node_mute_timeout.bind(),
             config::shard_local_cfg()
               .leader_balancer_transfer_limit_per_shard.bind(),
+            config::shard_local_cfg().leader_balancer_mode.bind(),
             _raft0);
           return _leader_balancer->start();
       })
@@ -375,7 +377,9 @@ ss::future<> controller::start() {
             config::shard_local_cfg()
               .partition_autobalancing_tick_interval_ms.bind(),
             config::shard_local_cfg()
-              .partition_autobalancing_movement_batch_size_bytes.bind());
+              .partition_autobalancing_movement_batch_size_bytes.bind(),
+            config::shard_local_cfg()
+              .partition_autobalancing_throughput_skew_percent.bind());
       })
       .then([this] {
           return _partition_balancer.invoke_on(
@@ -25,6 +25,7 @@
 #include "config/property.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
+#include "prometheus/prometheus_sanitize.h"
 #include "raft/fwd.h"
 #include "random/generators.h"
 #include "rpc/connection_cache.h"
@@ -33,6 +34,7 @@
 
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/lowres_clock.hh>
+#include <seastar/core/metrics.hh>
 #include <seastar/core/reactor.hh>
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/sleep.hh>
@@ -75,7 +77,11 @@ health_monitor_backend::health_monitor_backend(
       std::move(storage_min_percent_alert),
       std::move(storage_min_bytes),
       storage_node_api,
-      storage_api) {
+      storage_api)
+  , _report_version(random_generators::get_int<uint64_t>())
+  , _full_report_interval(
+      config::shard_local_cfg().health_monitor_full_report_interval.bind()) {
+    setup_metrics();
     _leadership_notification_handle
       = _raft_manager.local().register_leadership_notification(
         [this](
@@ -384,6 +390,9 @@ health_monitor_backend::dispatch_refresh_cluster_health_request(
     }
 
     _reports_disk_health = cluster_disk_health;
+    // reports were not collected by this node, they can't be used as a base
+    // for delta reports
+    _report_versions.clear();
     co_return make_error_code(errc::success);
 }
 
@@ -486,6 +495,41 @@ health_monitor_backend::maybe_refresh_cluster_health(
 
 ss::future<result<node_health_report>>
 health_monitor_backend::collect_remote_node_health(model::node_id id) {
+    std::optional<uint64_t> acked_version;
+    if (auto it = _report_versions.find(id);
+        it != _report_versions.end() && _reports.contains(id)) {
+        acked_version = it->second;
+    }
+
+    auto reply = co_await dispatch_node_health_request(id, acked_version);
+    if (
+      reply && reply.value().report.has_value()
+      && reply.value().base_version.has_value()) {
+        if (!apply_node_health_delta(id, reply.value())) {
+            // the cached report is not the base of the delta, request the
+            // full report
+            _report_versions.erase(id);
+            reply = co_await dispatch_node_health_request(id, std::nullopt);
+        }
+    }
+
+    if (reply && reply.value().report.has_value()) {
+        auto& r = reply.value();
+        if (!r.base_version.has_value()) {
+            ++_received_stats.full_reports;
+            for (const auto& t : r.report->topics) {
+                _received_stats.partitions += t.partitions.size();
+            }
+        }
+        _report_versions[id] = r.report_version;
+    }
+
+    co_return process_node_reply(id, std::move(reply));
+}
+
+ss::future<result<get_node_health_reply>>
+health_monitor_backend::dispatch_node_health_request(
+  model::node_id id, std::optional<uint64_t> acked_version) {
     const auto timeout = model::timeout_clock::now() + max_metadata_age();
     return _connections.local()
       .with_node_client<controller_client_protocol>(
@@ -493,15 +537,56 @@ health_monitor_backend::collect_remote_node_health(model::node_id id) {
         ss::this_shard_id(),
         id,
         max_metadata_age(),
-        [timeout](controller_client_protocol client) mutable {
+        [timeout, acked_version](controller_client_protocol client) mutable {
             return client.collect_node_health_report(
-              get_node_health_request{.filter = node_report_filter{}},
+              get_node_health_request{
+                .filter = node_report_filter{},
+                .acked_version = acked_version,
+              },
               rpc::client_opts(timeout));
         })
-      .then(&rpc::get_ctx_data<get_node_health_reply>)
-      .then([this, id](result<get_node_health_reply> reply) {
-          return process_node_reply(id, std::move(reply));
+      .then(&rpc::get_ctx_data<get_node_health_reply>);
+}
+
+bool health_monitor_backend::apply_node_health_delta(
+  model::node_id id, get_node_health_reply& reply) {
+    auto it = _reports.find(id);
+    auto v_it = _report_versions.find(id);
+    if (
+      it == _reports.end() || v_it == _report_versions.end()
+      || v_it->second != *reply.base_version) {
+        vlog(
+          clusterlog.debug,
+          "unable to apply delta health report from {}, base version: {}",
+          id,
+          reply.base_version);
+        return false;
+    }
+
+    size_t partitions = 0;
+    for (const auto& t : reply.report->topics) {
+        partitions += t.partitions.size();
+    }
+    vlog(
+      clusterlog.trace,
+      "applying delta health report from {}, changed partitions: {}, removed "
+      "partitions: {}",
+      id,
+      partitions,
+      reply.removed_partitions.size());
+
+    // the cached report is still served while the other nodes are queried,
+    // the delta is applied to it when the refresh replaces the cache
+    _pending_deltas.insert_or_assign(
+      id,
+      node_health_delta{
+        .changed = std::move(reply.report->topics),
+        .removed = std::move(reply.removed_partitions),
       });
+
+    ++_received_stats.delta_reports;
+    _received_stats.partitions += partitions;
+    return true;
 }
 
 result<node_health_report>
@@ -567,6 +652,7 @@ ss::future<std::error_code> health_monitor_backend::collect_cluster_health() {
     vlog(clusterlog.debug, "collecting cluster health statistics");
     // collect all reports
     auto ids = _members.local().all_broker_ids();
+    _pending_deltas.clear();
     auto reports = co_await ssx::async_transform(
       ids.begin(), ids.end(), [this](model::node_id id) {
           if (id == _raft0->self().id()) {
@@ -580,9 +666,26 @@ ss::future<std::error_code> health_monitor_backend::collect_cluster_health() {
     // update nodes reports and cache cluster-level disk health
     storage::disk_space_alert cluster_disk_health
       = storage::disk_space_alert::ok;
+    auto deltas = std::exchange(_pending_deltas, {});
     for (auto& r : reports) {
         if (r) {
             const auto id = r.value().id;
+            auto old_i = old_reports.find(id);
+            if (auto d = deltas.extract(id); !d.empty()) {
+                if (old_i != old_reports.end()) {
+                    // the previous report passed to the node callbacks keeps
+                    // its node level state, its partitions are moved to the
+                    // new report
+                    apply_health_delta(
+                      old_i->second.topics, std::move(d.mapped()));
+                    r.value().topics = std::move(old_i->second.topics);
+                } else {
+                    // the base of the delta is gone, drop the incomplete
+                    // report and request the full one next time
+                    _report_versions.erase(id);
+                    continue;
+                }
+            }
             vlog(
               clusterlog.debug,
               "collected node {} health report: {}",
@@ -591,7 +694,7 @@ ss::future<std::error_code> health_monitor_backend::collect_cluster_health() {
 
             std::optional<std::reference_wrapper<const node_health_report>>
               old_report;
-            if (auto old_i = old_reports.find(id); old_i != old_reports.end()) {
+            if (old_i != old_reports.end()) {
                 vlog(
                   clusterlog.debug,
                   "(previous node report from {}: {})",
@@ -637,6 +740,58 @@ health_monitor_backend::collect_current_node_health(node_report_filter filter) {
 
     co_return ret;
 }
+
+ss::future<result<get_node_health_reply>>
+health_monitor_backend::collect_node_health_delta(
+  node_report_filter filter, std::optional<uint64_t> acked_version) {
+    // only the unfiltered reports requested by the controller leader are
+    // tracked
+    const bool tracked = filter.include_partitions
+                         && filter.ntp_filters.namespaces.empty();
+
+    auto res = co_await collect_current_node_health(std::move(filter));
+    if (!res) {
+        co_return res.error();
+    }
+    get_node_health_reply reply{
+      .error = errc::success,
+      .report = std::move(res.value()),
+    };
+    if (!tracked) {
+        co_return reply;
+    }
+
+    auto& topics = reply.report->topics;
+    const auto now = ss::lowres_clock::now();
+    const bool full = !acked_version.has_value()
+                      || *acked_version != _report_version
+                      || now - _last_full_report >= _full_report_interval();
+
+    size_t partitions = 0;
+    if (full) {
+        // periodic full reports repair any divergence of the leader state
+        _reported_partitions = index_partition_statuses(topics);
+        _last_full_report = now;
+        partitions = _reported_partitions.size();
+        ++_sent_stats.full_reports;
+    } else {
+        auto delta = make_health_delta(
+          _reported_partitions, topics, delta_report_tolerance);
+        for (const auto& t : delta.changed) {
+            partitions += t.partitions.size();
+        }
+        topics = std::move(delta.changed);
+        reply.removed_partitions = std::move(delta.removed);
+        reply.base_version = _report_version;
+        ++_sent_stats.delta_reports;
+    }
+    reply.report_version = ++_report_version;
+    _sent_stats.partitions += partitions;
+    _last_report_partitions = partitions;
+
+    co_return reply;
+}
+
 namespace {
 
 struct ntp_leader {
@@ -649,6 +804,7 @@ struct ntp_report {
     model::ntp ntp;
     ntp_leader leader;
     size_t size_bytes;
+    partition_load load;
 };
 
 partition_status to_partition_status(const ntp_report& ntpr) {
@@ -658,6 +814,8 @@ partition_status to_partition_status(const ntp_report& ntpr) {
       .leader_id = ntpr.leader.leader_id,
       .revision_id = ntpr.leader.revision_id,
       .size_bytes = ntpr.size_bytes,
+      .bytes_rate = ntpr.load.bytes_per_sec,
+      .request_rate = ntpr.load.requests_per_sec,
     };
 }
 
@@ -680,6 +838,7 @@ std::vector<ntp_report> collect_shard_local_reports(
                   .revision_id = p.second->get_revision_id(),
                 },
                 .size_bytes = p.second->size_bytes(),
+                .load = p.second->probe().load(),
               };
           });
     } else {
@@ -693,6 +852,7 @@ std::vector<ntp_report> collect_shard_local_reports(
                   .revision_id = partition->get_revision_id(),
                 },
                 .size_bytes = partition->size_bytes(),
+                .load = partition->probe().load(),
                 });
             }
         }
@@ -738,6 +898,48 @@ std::chrono::milliseconds health_monitor_backend::max_metadata_age() {
     return config::shard_local_cfg().health_monitor_max_metadata_age();
 }
 
+void health_monitor_backend::setup_metrics() {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+    namespace sm = ss::metrics;
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("cluster:health_monitor"),
+      {
+        sm::make_counter(
+          "full_reports_sent",
+          [this] { return _sent_stats.full_reports; },
+          sm::description("Number of full node health reports sent")),
+        sm::make_counter(
+          "delta_reports_sent",
+          [this] { return _sent_stats.delta_reports; },
+          sm::description("Number of delta node health reports sent")),
+        sm::make_counter(
+          "partitions_sent",
+          [this] { return _sent_stats.partitions; },
+          sm::description(
+            "Number of partition statuses sent in node health reports")),
+        sm::make_gauge(
+          "last_report_partitions",
+          [this] { return _last_report_partitions; },
+          sm::description(
+            "Number of partition statuses in the last node health report")),
+        sm::make_counter(
+          "full_reports_received",
+          [this] { return _received_stats.full_reports; },
+          sm::description("Number of full node health reports received")),
+        sm::make_counter(
+          "delta_reports_received",
+          [this] { return _received_stats.delta_reports; },
+          sm::description("Number of delta node health reports received")),
+        sm::make_counter(
+          "partitions_received",
+          [this] { return _received_stats.partitions; },
+          sm::description(
+            "Number of partition statuses received in node health reports")),
+      });
+}
+
 ss::future<result<std::optional<cluster::drain_manager::drain_status>>>
 health_monitor_backend::get_node_drain_status(
   model::node_id node_id, model::timeout_clock::time_point deadline) {
@@ -13,11 +13,13 @@
 #include "cluster/fwd.h"
 #include "cluster/health_monitor_types.h"
 #include "cluster/node/local_monitor.h"
+#include "config/property.h"
 #include "model/metadata.h"
 #include "raft/consensus.h"
 #include "rpc/fwd.h"
 #include "ssx/semaphore.h"
 
+#include <seastar/core/metrics_registration.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/shared_ptr.hh>
 
@@ -28,6 +30,8 @@
 #include <vector>
 namespace cluster {
 
+// Called with the new and the previous report of the node. The partitions of
+// the previous report may already be moved to the new one.
 using health_node_cb_t = ss::noncopyable_function<void(
   node_health_report const&,
   std::optional<std::reference_wrapper<const node_health_report>>)>;
@@ -71,6 +75,14 @@ public:
     ss::future<result<node_health_report>>
       collect_current_node_health(node_report_filter);
 
+    /**
+     * Collects current node health report. When the acked version matches the
+     * version of the last report sent by this node the reply contains only
+     * the partitions which status changed since then.
+     */
+    ss::future<result<get_node_health_reply>> collect_node_health_delta(
+      node_report_filter, std::optional<uint64_t> acked_version);
+
     cluster::notification_id_type register_node_callback(health_node_cb_t cb);
     void unregister_node_callback(cluster::notification_id_type id);
 
@@ -117,6 +129,9 @@ private:
     ss::future<std::error_code> collect_cluster_health();
     ss::future<result<node_health_report>>
       collect_remote_node_health(model::node_id);
+    ss::future<result<get_node_health_reply>>
+      dispatch_node_health_request(model::node_id, std::optional<uint64_t>);
+    bool apply_node_health_delta(model::node_id, get_node_health_reply&);
     ss::future<std::error_code> maybe_refresh_cluster_health(
       force_refresh, model::timeout_clock::time_point);
     ss::future<std::error_code> refresh_cluster_health_cache(force_refresh);
@@ -137,6 +152,7 @@ private:
       process_node_reply(model::node_id, result<get_node_health_reply>);
 
     std::chrono::milliseconds max_metadata_age();
+    void setup_metrics();
     void abort_current_refresh();
 
     void on_leadership_changed(
@@ -168,5 +184,36 @@ private:
     std::vector<std::pair<cluster::notification_id_type, health_node_cb_t>>
       _node_callbacks;
     cluster::notification_id_type _next_callback_id{0};
+
+    /**
+     * Relative change of partition size or rates below which the partition
+     * is not included in the delta report.
+     */
+    static constexpr double delta_report_tolerance = 0.1;
+
+    // state of the last report sent by this node, delta reports are built
+    // against it
+    uint64_t _report_version;
+    partition_status_index _reported_partitions;
+    ss::lowres_clock::time_point _last_full_report
+      = ss::lowres_clock::time_point::min();
+    config::binding<std::chrono::milliseconds> _full_report_interval;
+
+    // versions of the reports cached in _reports, sent back to the nodes as
+    // acked versions
+    absl::node_hash_map<model::node_id, uint64_t> _report_versions;
+    // delta reports received during the current refresh, applied to the
+    // cached reports in place once the refresh replaces them
+    absl::node_hash_map<model::node_id, node_health_delta> _pending_deltas;
+
+    struct report_stats {
+        uint64_t full_reports{0};
+        uint64_t delta_reports{0};
+        uint64_t partitions{0};
+    };
+    report_stats _sent_stats;
+    report_stats _received_stats;
+    size_t _last_report_partitions{0};
+    ss::metrics::metric_groups _metrics;
 };
 } // namespace cluster
@@ -64,6 +64,15 @@ health_monitor_frontend::collect_node_health(node_report_filter f) {
       });
 }
 
+ss::future<result<get_node_health_reply>>
+health_monitor_frontend::collect_node_health_delta(
+  node_report_filter f, std::optional<uint64_t> acked_version) {
+    return dispatch_to_backend(
+      [f = std::move(f), acked_version](health_monitor_backend& be) mutable {
+          return be.collect_node_health_delta(std::move(f), acked_version);
+      });
+}
+
 // Return status of single node
 ss::future<result<std::vector<node_state>>>
 health_monitor_frontend::get_nodes_status(
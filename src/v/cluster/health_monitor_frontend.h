@@ -58,6 +58,11 @@ public:
     ss::future<result<node_health_report>>
       collect_node_health(node_report_filter);
 
+    // Collects current node health report, the reply contains only the
+    // partitions changed since the acked report version when possible
+    ss::future<result<get_node_health_reply>>
+      collect_node_health_delta(node_report_filter, std::optional<uint64_t>);
+
     // Return status of all nodes
     ss::future<result<std::vector<node_state>>>
       get_nodes_status(model::timeout_clock::time_point);
@@ -18,7 +18,9 @@
 
 #include <fmt/ostream.h>
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 
 namespace cluster {
 
@@ -86,12 +88,15 @@ std::ostream& operator<<(std::ostream& o, const cluster_health_report& r) {
 std::ostream& operator<<(std::ostream& o, const partition_status& ps) {
     fmt::print(
       o,
-      "{{id: {}, term: {}, leader_id: {}, revision_id: {}, size_bytes: {}}}",
+      "{{id: {}, term: {}, leader_id: {}, revision_id: {}, size_bytes: {}, "
+      "bytes_rate: {}, request_rate: {}}}",
       ps.id,
       ps.term,
       ps.leader_id,
       ps.revision_id,
-      ps.size_bytes);
+      ps.size_bytes,
+      ps.bytes_rate,
+      ps.request_rate);
     return o;
 }
 
@@ -140,12 +145,24 @@ std::ostream& operator<<(std::ostream& o, const partitions_filter& filter) {
 
 std::ostream& operator<<(std::ostream& o, const get_node_health_request& r) {
     fmt::print(
-      o, "{{filter: {}, current_version: {}}}", r.filter, r.current_version);
+      o,
+      "{{filter: {}, acked_version: {}, current_version: {}}}",
+      r.filter,
+      r.acked_version,
+      r.current_version);
     return o;
 }
 
 std::ostream& operator<<(std::ostream& o, const get_node_health_reply& r) {
-    fmt::print(o, "{{error: {}, report: {}}}", r.error, r.report);
+    fmt::print(
+      o,
+      "{{error: {}, report: {}, report_version: {}, base_version: {}, "
+      "removed_partitions: {}}}",
+      r.error,
+      r.report,
+      r.report_version,
+      r.base_version,
+      r.removed_partitions);
     return o;
 }
 
@@ -164,6 +181,118 @@ std::ostream& operator<<(std::ostream& o, const get_cluster_health_reply& r) {
     return o;
 }
 
+partition_status_index
+index_partition_statuses(const std::vector<topic_status>& topics) {
+    partition_status_index index;
+    for (const auto& t : topics) {
+        for (const auto& p : t.partitions) {
+            index.emplace(model::ntp(t.tp_ns.ns, t.tp_ns.tp, p.id), p);
+        }
+    }
+    return index;
+}
+
+namespace {
+bool differs(uint64_t last, uint64_t current, double tolerance) {
+    if (last == current) {
+        return false;
+    }
+    auto diff = std::abs(
+      static_cast<double>(current) - static_cast<double>(last));
+    return diff > static_cast<double>(last) * tolerance;
+}
+
+bool changed(
+  const partition_status& last,
+  const partition_status& current,
+  double tolerance) {
+    if (
+      last.term != current.term || last.leader_id != current.leader_id
+      || last.revision_id != current.revision_id) {
+        return true;
+    }
+    return differs(last.size_bytes, current.size_bytes, tolerance)
+           || differs(last.bytes_rate, current.bytes_rate, tolerance)
+           || differs(last.request_rate, current.request_rate, tolerance);
+}
+} // namespace
+
+node_health_delta make_health_delta(
+  partition_status_index& last,
+  const std::vector<topic_status>& current,
+  double tolerance) {
+    node_health_delta delta;
+    absl::node_hash_set<model::ntp> present;
+    present.reserve(last.size());
+
+    for (const auto& t : current) {
+        topic_status changed_topic{.tp_ns = t.tp_ns};
+        for (const auto& p : t.partitions) {
+            model::ntp ntp(t.tp_ns.ns, t.tp_ns.tp, p.id);
+            auto it = last.find(ntp);
+            if (it == last.end()) {
+                last.emplace(ntp, p);
+                changed_topic.partitions.push_back(p);
+            } else if (changed(it->second, p, tolerance)) {
+                // statuses which didn't change are left untouched so that
+                // slowly changing values can't drift away from the reported
+                // ones
+                it->second = p;
+                changed_topic.partitions.push_back(p);
+            }
+            present.insert(std::move(ntp));
+        }
+        if (!changed_topic.partitions.empty()) {
+            delta.changed.push_back(std::move(changed_topic));
+        }
+    }
+
+    for (auto it = last.begin(); it != last.end();) {
+        if (!present.contains(it->first)) {
+            delta.removed.push_back(it->first);
+            last.erase(it++);
+        } else {
+            ++it;
+        }
+    }
+
+    return delta;
+}
+
+void apply_health_delta(
+  std::vector<topic_status>& topics, node_health_delta delta) {
+    auto index = index_partition_statuses(topics);
+    for (auto& t : delta.changed) {
+        for (auto& p : t.partitions) {
+            index.insert_or_assign(
+              model::ntp(t.tp_ns.ns, t.tp_ns.tp, p.id), std::move(p));
+        }
+    }
+    for (const auto& ntp : delta.removed) {
+        index.erase(ntp);
+    }
+
+    absl::node_hash_map<model::topic_namespace, std::vector<partition_status>>
+      by_topic;
+    for (auto& [ntp, status] : index) {
+        by_topic[model::topic_namespace(ntp.ns, ntp.tp.topic)].push_back(
+          std::move(status));
+    }
+
+    topics.clear();
+    topics.reserve(by_topic.size());
+    for (auto& [tp_ns, partitions] : by_topic) {
+        std::sort(
+          partitions.begin(),
+          partitions.end(),
+          [](const partition_status& a, const partition_status& b) {
+              return a.id < b.id;
+          });
+        topics.push_back(
+          topic_status{.tp_ns = tp_ns, .partitions = std::move(partitions)});
+    }
+}
+
 } // namespace cluster
 namespace reflection {
 
@@ -199,10 +328,10 @@ cluster::node_state adl<cluster::node_state>::from(iobuf_parser& p) {
 
 void adl<cluster::partition_status>::to(
   iobuf& out, cluster::partition_status&& s) {
-    // if revision or size is not set fallback to old version, we do it here to
-    // prevent old redpanda version from crashing, request handler will decode
-    // request version and base on that handle revision_id and size_bytes fields
-    // correctly.
+    // if revision, size or load is not set fallback to old version, we do it
+    // here to prevent old redpanda version from crashing, request handler will
+    // decode request version and base on that handle revision_id, size_bytes
+    // and load fields correctly.
     if (s.revision_id == model::revision_id{}) {
         serialize(
           out,
@@ -218,7 +347,7 @@ void adl<cluster::partition_status>::to(
           s.term,
           s.leader_id,
           s.revision_id);
-    } else {
+    } else if (s.bytes_rate == 0 && s.request_rate == 0) {
         serialize(
           out,
           cluster::partition_status::size_bytes_version,
@@ -227,6 +356,17 @@ void adl<cluster::partition_status>::to(
           s.leader_id,
           s.revision_id,
           s.size_bytes);
+    } else {
+        serialize(
+          out,
+          cluster::partition_status::load_version,
+          s.id,
+          s.term,
+          s.leader_id,
+          s.revision_id,
+          s.size_bytes,
+          s.bytes_rate,
+          s.request_rate);
     }
 }
 
@@ -248,6 +388,10 @@ adl<cluster::partition_status>::from(iobuf_parser& p) {
     if (version <= cluster::partition_status::size_bytes_version) {
         ret.size_bytes = adl<size_t>{}.from(p);
     }
+    if (version <= cluster::partition_status::load_version) {
+        ret.bytes_rate = adl<uint64_t>{}.from(p);
+        ret.request_rate = adl<uint64_t>{}.from(p);
+    }
     return ret;
 }
 
@@ -448,7 +592,9 @@ adl<cluster::cluster_report_filter>::from(iobuf_parser& p) {
 
 void adl<cluster::get_node_health_request>::to(
   iobuf& out, cluster::get_node_health_request&& req) {
-    reflection::serialize(out, req.current_version, std::move(req.filter));
+    // older versions ignore trailing acked_version
+    reflection::serialize(
+      out, req.current_version, std::move(req.filter), req.acked_version);
 }
 
 cluster::get_node_health_request
@@ -456,28 +602,52 @@ adl<cluster::get_node_health_request>::from(iobuf_parser& p) {
     auto version = adl<int8_t>{}.from(p);
 
     auto filter = adl<cluster::node_report_filter>{}.from(p);
+    std::optional<uint64_t> acked_version;
+    if (version <= cluster::get_node_health_request::delta_version) {
+        acked_version = adl<std::optional<uint64_t>>{}.from(p);
+    }
 
     return cluster::get_node_health_request{
       .filter = std::move(filter),
+      .acked_version = acked_version,
       .decoded_version = version,
     };
 }
 
 void adl<cluster::get_node_health_reply>::to(
   iobuf& out, cluster::get_node_health_reply&& reply) {
-    reflection::serialize(out, reply.current_version, std::move(reply.report));
+    // older versions ignore the trailing delta fields
+    reflection::serialize(
+      out,
+      reply.current_version,
+      std::move(reply.report),
+      reply.report_version,
+      reply.base_version,
+      std::move(reply.removed_partitions));
 }
 
 cluster::get_node_health_reply
 adl<cluster::get_node_health_reply>::from(iobuf_parser& p) {
-    read_and_assert_version<cluster::get_node_health_reply>(
-      "cluster::get_node_health_reply", p);
+    // versions are decreasing, old nodes reply with the initial version
+    auto version = adl<int8_t>{}.from(p);
+    vassert(
+      version <= cluster::get_node_health_reply::initial_version,
+      "unsupported version of cluster::get_node_health_reply, max_supported "
+      "version: {}, read version: {}",
+      cluster::get_node_health_reply::initial_version,
+      version);
 
     auto report = adl<std::optional<cluster::node_health_report>>{}.from(p);
-
-    return cluster::get_node_health_reply{
+    cluster::get_node_health_reply reply{
       .report = std::move(report),
     };
+    if (version <= cluster::get_node_health_reply::delta_version) {
+        reply.report_version = adl<uint64_t>{}.from(p);
+        reply.base_version = adl<std::optional<uint64_t>>{}.from(p);
+        reply.removed_partitions = adl<std::vector<model::ntp>>{}.from(p);
+    }
+
+    return reply;
 }
 
 void adl<cluster::get_cluster_health_request>::to(
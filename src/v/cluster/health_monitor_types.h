@@ -52,13 +52,18 @@ struct node_state : serde::envelope<node_state, serde::version<0>> {
     auto serde_fields() { return std::tie(id, membership_state, is_alive); }
 };
 
-struct partition_status : serde::envelope<partition_status, serde::version<0>> {
+struct partition_status
+  : serde::envelope<
+      partition_status,
+      serde::version<1>,
+      serde::compat_version<0>> {
     /**
      * We increase a version here 'backward' since incorrect assertion would
      * cause older redpanda versions to crash.
      *
      * Version: -1: added revision_id field
      * Version: -2: added size_bytes field
+     * Version: -3: added bytes_rate and request_rate fields
      *
      * Same versioning should also be supported in get_node_health_request
      */
@@ -66,8 +71,9 @@ struct partition_status : serde::envelope<partition_status, serde::version<0>> {
     static constexpr int8_t initial_version = 0;
     static constexpr int8_t revision_id_version = -1;
     static constexpr int8_t size_bytes_version = -2;
+    static constexpr int8_t load_version = -3;
 
-    static constexpr int8_t current_version = size_bytes_version;
+    static constexpr int8_t current_version = load_version;
 
     static constexpr size_t invalid_size_bytes = size_t(-1);
 
@@ -76,9 +82,14 @@ struct partition_status : serde::envelope<partition_status, serde::version<0>> {
     std::optional<model::node_id> leader_id;
     model::revision_id revision_id;
     size_t size_bytes;
+    // produce and fetch rate of the partition replica, only leaders have
+    // non zero rates
+    uint64_t bytes_rate{0};
+    uint64_t request_rate{0};
 
     auto serde_fields() {
-        return std::tie(id, term, leader_id, revision_id, size_bytes);
+        return std::tie(
+          id, term, leader_id, revision_id, size_bytes, bytes_rate, request_rate);
     }
 
     friend std::ostream& operator<<(std::ostream&, const partition_status&);
@@ -154,6 +165,42 @@ struct node_health_report
     }
 };
 
+/**
+ * Partition statuses of a node indexed by ntp. Used to compute delta node
+ * health reports on the reporting node and to apply them to the report cached
+ * by the controller leader.
+ */
+using partition_status_index
+  = absl::node_hash_map<model::ntp, partition_status>;
+
+/**
+ * Partitions which status changed since the last node health report.
+ */
+struct node_health_delta {
+    std::vector<topic_status> changed;
+    std::vector<model::ntp> removed;
+};
+
+partition_status_index
+index_partition_statuses(const std::vector<topic_status>&);
+
+/**
+ * Compute the partitions of the current report which changed since the last
+ * reported statuses and update the index accordingly. Term, leader and
+ * revision changes are always reported while sizes and rates are reported
+ * only when they differ by more than `tolerance` fraction of the last reported
+ * value, otherwise every active partition would be part of each delta.
+ */
+node_health_delta make_health_delta(
+  partition_status_index& last,
+  const std::vector<topic_status>& current,
+  double tolerance);
+
+/**
+ * Apply the delta to the topics of the base report.
+ */
+void apply_health_delta(std::vector<topic_status>& topics, node_health_delta);
+
 struct cluster_health_report
   : serde::envelope<cluster_health_report, serde::version<0>> {
     static constexpr int8_t current_version = 0;
@@ -257,16 +304,26 @@ using force_refresh = ss::bool_class<struct hm_force_refresh_tag>;
  */
 
 struct get_node_health_request
-  : serde::envelope<get_node_health_request, serde::version<0>> {
+  : serde::envelope<
+      get_node_health_request,
+      serde::version<1>,
+      serde::compat_version<0>> {
     static constexpr int8_t initial_version = 0;
     // version -1: included revision id in partition status
     static constexpr int8_t revision_id_version = -1;
     // version -2: included size_bytes in partition status
     static constexpr int8_t size_bytes_version = -2;
+    // version -3: included bytes_rate and request_rate in partition status
+    static constexpr int8_t load_version = -3;
+    // version -4: included acked_version, delta reports are supported
+    static constexpr int8_t delta_version = -4;
 
-    static constexpr int8_t current_version = size_bytes_version;
+    static constexpr int8_t current_version = delta_version;
 
     node_report_filter filter;
+    // version of the last report received from the node, when set the node
+    // may reply with a delta against that report
+    std::optional<uint64_t> acked_version;
     // this field is not serialized
     int8_t decoded_version = current_version;
 
@@ -277,15 +334,30 @@ struct get_node_health_request
     friend std::ostream&
     operator<<(std::ostream&, const get_node_health_request&);
 
-    auto serde_fields() { return std::tie(filter); }
+    auto serde_fields() { return std::tie(filter, acked_version); }
 };
 
 struct get_node_health_reply
-  : serde::envelope<get_node_health_reply, serde::version<0>> {
-    static constexpr int8_t current_version = 0;
+  : serde::envelope<
+      get_node_health_reply,
+      serde::version<1>,
+      serde::compat_version<0>> {
+    static constexpr int8_t initial_version = 0;
+    // version -1: included report_version, base_version and
+    // removed_partitions
+    static constexpr int8_t delta_version = -1;
+
+    static constexpr int8_t current_version = delta_version;
 
     errc error = cluster::errc::success;
     std::optional<node_health_report> report;
+    // version of the report, nodes send the version back as acked_version
+    uint64_t report_version{0};
+    // when set the report is a delta against the report with given version,
+    // it contains only the partitions which status changed
+    std::optional<uint64_t> base_version;
+    // partitions removed from the node since the base report
+    std::vector<model::ntp> removed_partitions;
 
     friend bool
     operator==(const get_node_health_reply&, const get_node_health_reply&)
@@ -294,7 +366,10 @@ struct get_node_health_reply
     friend std::ostream&
     operator<<(std::ostream&, const get_node_health_reply&);
 
-    auto serde_fields() { return std::tie(error, report); }
+    auto serde_fields() {
+        return std::tie(
+          error, report, report_version, base_version, removed_partitions);
+    }
 };
 
 struct get_cluster_health_request
@@ -304,8 +379,10 @@ struct get_cluster_health_request
     static constexpr int8_t revision_id_version = -1;
     // version -2: included size_bytes in partition status
     static constexpr int8_t size_bytes_version = -2;
+    // version -3: included bytes_rate and request_rate in partition status
+    static constexpr int8_t load_version = -3;
 
-    static constexpr int8_t current_version = size_bytes_version;
+    static constexpr int8_t current_version = load_version;
 
     cluster_report_filter filter;
     // if set to true will force node health metadata refresh
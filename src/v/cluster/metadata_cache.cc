@@ -207,6 +207,27 @@ metadata_cache::get_leaders() const {
     return _leaders.local().get_leaders();
 }
 
+notification_id_type
+metadata_cache::register_topic_delta_notification(topic_table::delta_cb_t cb) {
+    return _topics_state.local().register_delta_notification(std::move(cb));
+}
+
+void metadata_cache::unregister_topic_delta_notification(
+  notification_id_type id) {
+    _topics_state.local().unregister_delta_notification(id);
+}
+
+notification_id_type metadata_cache::register_leadership_update_notification(
+  const model::ns& ns, partition_leaders_table::leader_change_cb_t cb) {
+    return _leaders.local().register_leadership_update_notification(
+      ns, std::move(cb));
+}
+
+void metadata_cache::unregister_leadership_update_notification(
+  notification_id_type id) {
+    _leaders.local().unregister_leadership_update_notification(id);
+}
+
 /**
  * hard coded defaults
  */
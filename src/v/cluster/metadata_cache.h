@@ -156,6 +156,17 @@ public:
     void reset_leaders();
     cluster::partition_leaders_table::leaders_info_t get_leaders() const;
 
+    /// Register a callback for the topic table changes of the local shard
+    notification_id_type
+      register_topic_delta_notification(topic_table::delta_cb_t);
+    void unregister_topic_delta_notification(notification_id_type);
+
+    /// Register a callback for every partition leader metadata update of the
+    /// local shard, see partition_leaders_table for details
+    notification_id_type register_leadership_update_notification(
+      const model::ns&, partition_leaders_table::leader_change_cb_t);
+    void unregister_leadership_update_notification(notification_id_type);
+
     model::compression get_default_compression() const;
     model::cleanup_policy_bitflags get_default_cleanup_policy_bitflags() const;
     model::compaction_strategy get_default_compaction_strategy() const;
@@ -43,7 +43,8 @@ partition_balancer_backend::partition_balancer_backend(
   config::binding<unsigned>&& max_disk_usage_percent,
   config::binding<unsigned>&& storage_space_alert_free_threshold_percent,
   config::binding<std::chrono::milliseconds>&& tick_interval,
-  config::binding<size_t>&& movement_batch_size_bytes)
+  config::binding<size_t>&& movement_batch_size_bytes,
+  config::binding<std::optional<unsigned>>&& throughput_skew_percent)
   : _raft0(std::move(raft0))
   , _controller_stm(controller_stm.local())
   , _topic_table(topic_table.local())
@@ -58,6 +59,7 @@ partition_balancer_backend::partition_balancer_backend(
       std::move(storage_space_alert_free_threshold_percent))
   , _tick_interval(std::move(tick_interval))
   , _movement_batch_size_bytes(std::move(movement_batch_size_bytes))
+  , _throughput_skew_percent(std::move(throughput_skew_percent))
   , _timer([this] { tick(); }) {}
 
 void partition_balancer_backend::start() {
@@ -67,6 +69,7 @@ void partition_balancer_backend::start() {
     }
 
     _mode.watch([this] { on_mode_changed(); });
+    _throughput_skew_percent.watch([this] { maybe_reset_node_loads(); });
 }
 
 void partition_balancer_backend::tick() {
@@ -95,6 +98,15 @@ void partition_balancer_backend::on_mode_changed() {
         vlog(clusterlog.info, "partition autobalancing disabled");
         _timer.cancel();
     }
+    maybe_reset_node_loads();
+}
+
+void partition_balancer_backend::maybe_reset_node_loads() {
+    if (
+      (!is_enabled() || !_throughput_skew_percent().has_value())
+      && !_partition_allocator.node_loads().empty()) {
+        _partition_allocator.update_node_loads({});
+    }
 }
 
 ss::future<> partition_balancer_backend::stop() {
@@ -152,18 +164,29 @@ ss::future<> partition_balancer_backend::do_tick() {
     double soft_max_disk_usage_ratio = _max_disk_usage_percent() / 100.0;
     double hard_max_disk_usage_ratio
       = (100 - _storage_space_alert_free_threshold_percent()) / 100.0;
-    auto plan_data
-      = partition_balancer_planner(
-          planner_config{
-            .soft_max_disk_usage_ratio = soft_max_disk_usage_ratio,
-            .hard_max_disk_usage_ratio = hard_max_disk_usage_ratio,
-            .movement_disk_size_batch = _movement_batch_size_bytes(),
-            .node_availability_timeout_sec = _availability_timeout(),
-          },
-          _topic_table,
-          _members_table,
-          _partition_allocator)
-          .plan_reassignments(health_report.value(), follower_metrics);
+    std::optional<double> throughput_skew_ratio;
+    if (auto skew = _throughput_skew_percent(); skew.has_value()) {
+        throughput_skew_ratio = *skew / 100.0;
+    }
+    auto planner = partition_balancer_planner(
+      planner_config{
+        .soft_max_disk_usage_ratio = soft_max_disk_usage_ratio,
+        .hard_max_disk_usage_ratio = hard_max_disk_usage_ratio,
+        .movement_disk_size_batch = _movement_batch_size_bytes(),
+        .node_availability_timeout_sec = _availability_timeout(),
+        .throughput_skew_ratio = throughput_skew_ratio,
+      },
+      _topic_table,
+      _members_table,
+      _partition_allocator);
+    auto plan_data = planner.plan_reassignments(
+      health_report.value(), follower_metrics);
+
+    if (throughput_skew_ratio.has_value()) {
+        // refresh the loads used to place new partitions
+        _partition_allocator.update_node_loads(
+          planner.compute_node_loads(health_report.value()));
+    }
 
     _last_leader_term = _raft0->term();
     _last_tick_time = ss::lowres_clock::now();
@@ -39,7 +39,8 @@ public:
       config::binding<unsigned>&& max_disk_usage_percent,
       config::binding<unsigned>&& storage_space_alert_free_threshold_percent,
       config::binding<std::chrono::milliseconds>&& tick_interval,
-      config::binding<size_t>&& movement_batch_size_bytes);
+      config::binding<size_t>&& movement_batch_size_bytes,
+      config::binding<std::optional<unsigned>>&& throughput_skew_percent);
 
     void start();
     ss::future<> stop();
@@ -66,6 +67,10 @@ private:
 
     void on_mode_changed();
 
+    /// Load aware placement of new partitions is only active together with
+    /// throughput balancing, drop the stale loads otherwise.
+    void maybe_reset_node_loads();
+
 private:
     consensus_ptr _raft0;
 
@@ -82,6 +87,7 @@ private:
     config::binding<unsigned> _storage_space_alert_free_threshold_percent;
     config::binding<std::chrono::milliseconds> _tick_interval;
     config::binding<size_t> _movement_batch_size_bytes;
+    config::binding<std::optional<unsigned>> _throughput_skew_percent;
 
     model::term_id _last_leader_term;
     ss::lowres_clock::time_point _last_tick_time;
@@ -199,6 +199,75 @@ std::optional<size_t> partition_balancer_planner::get_partition_size(
     return std::nullopt;
 }
 
+partition_balancer_planner::partition_loads_t
+partition_balancer_planner::collect_partition_loads(
+  const cluster_health_report& health_report) {
+    partition_loads_t loads;
+    for (const auto& node_report : health_report.node_reports) {
+        for (const auto& tp_ns : node_report.topics) {
+            auto& topic_loads = loads[tp_ns.tp_ns];
+            for (const auto& partition : tp_ns.partitions) {
+                auto weight = partition_load_weight(
+                  partition.bytes_rate, partition.request_rate);
+                if (weight <= 0) {
+                    continue;
+                }
+                // only the leader reports the rates, use the highest value
+                // in case the leadership moved between the reports
+                auto& load = topic_loads[partition.id];
+                load = std::max(load, weight);
+            }
+        }
+    }
+    return loads;
+}
+
+absl::flat_hash_map<model::node_id, node_load>
+partition_balancer_planner::compute_node_loads(
+  const partition_loads_t& partition_loads) const {
+    absl::flat_hash_map<model::node_id, node_load> node_loads;
+    for (const auto& [id, node] :
+         _partition_allocator.state().allocation_nodes()) {
+        node_loads.emplace(id, node_load(id, node->cpus()));
+    }
+
+    for (const auto& [tp_ns, topic] : _topic_table.topics_map()) {
+        auto topic_it = partition_loads.find(tp_ns);
+        for (const auto& a : topic.get_assignments()) {
+            double weight = 0;
+            if (topic_it != partition_loads.end()) {
+                auto p_it = topic_it->second.find(a.id);
+                if (p_it != topic_it->second.end()) {
+                    weight = p_it->second;
+                }
+            }
+            for (const auto& bs : a.replicas) {
+                auto it = node_loads.find(bs.node_id);
+                if (it != node_loads.end()) {
+                    it->second.add_replica(bs.shard, weight);
+                }
+            }
+        }
+    }
+    return node_loads;
+}
+
+absl::flat_hash_map<model::node_id, node_load>
+partition_balancer_planner::compute_node_loads(
+  const cluster_health_report& health_report) const {
+    return compute_node_loads(collect_partition_loads(health_report));
+}
+
+double partition_balancer_planner::get_partition_load(
+  const model::ntp& ntp, const reallocation_request_state& rrs) {
+    auto topic_it = rrs.partition_loads.find(model::topic_namespace_view(ntp));
+    if (topic_it == rrs.partition_loads.end()) {
+        return 0;
+    }
+    auto it = topic_it->second.find(ntp.tp.partition);
+    return it == topic_it->second.end() ? 0 : it->second;
+}
+
 partition_constraints partition_balancer_planner::get_partition_constraints(
   const partition_assignment& assignments,
   const topic_metadata& topic_metadata,
@@ -269,6 +338,7 @@ result<allocation_units> partition_balancer_planner::get_reallocation(
 
     rrs.moving_partitions.insert(ntp);
     rrs.planned_moves_size += partition_size;
+    const auto partition_load = get_partition_load(ntp, rrs);
     for (const auto r :
          reallocation.value().get_assignments().front().replicas) {
         if (
@@ -278,6 +348,10 @@ result<allocation_units> partition_balancer_planner::get_reallocation(
             if (disk_it != rrs.node_disk_reports.end()) {
                 disk_it->second.assigned += partition_size;
             }
+            auto load_it = rrs.node_loads.find(r.node_id);
+            if (load_it != rrs.node_loads.end()) {
+                load_it->second.assigned += partition_load;
+            }
         }
     }
     for (const auto r : assignments.replicas) {
@@ -288,6 +362,10 @@ result<allocation_units> partition_balancer_planner::get_reallocation(
             if (disk_it != rrs.node_disk_reports.end()) {
                 disk_it->second.released += partition_size;
             }
+            auto load_it = rrs.node_loads.find(r.node_id);
+            if (load_it != rrs.node_loads.end()) {
+                load_it->second.released += partition_load;
+            }
         }
     }
 
@@ -337,7 +415,7 @@ void partition_balancer_planner::get_unavailable_nodes_reassignments(
 
             auto constraints = get_partition_constraints(
               a,
-              t.second.metadata,
+              t.second.get_metadata(),
               partition_size.value(),
               _config.hard_max_disk_usage_ratio,
               rrs);
@@ -524,6 +602,154 @@ void partition_balancer_planner::get_full_node_reassignments(
     }
 }
 
+/*
+ * Function is trying to even out produce and fetch throughput between nodes.
+ * Nodes which per core load exceeds the cluster average by more than
+ * throughput_skew_ratio are considered hot. For each hot node, starting from
+ * the most loaded one, partitions are moved away in descending order of their
+ * load until the node is no longer hot. Target nodes are chosen by the least
+ * throughput loaded constraint and are not allowed to become hot themselves.
+ * Replica placement on the target node prefers the least loaded core.
+ *
+ * Contrary to the violations handling, failing to find a move is not an error
+ * since the current placement is still valid.
+ */
+void partition_balancer_planner::get_throughput_reassignments(
+  plan_data& result, reallocation_request_state& rrs) {
+    double total_load = 0;
+    size_t total_cores = 0;
+    for (const auto& [id, load] : rrs.node_loads) {
+        if (
+          rrs.all_unavailable_nodes.contains(id)
+          || rrs.decommissioning_nodes.contains(id)) {
+            continue;
+        }
+        total_load += load.final_load();
+        total_cores += load.shard_loads.size();
+    }
+    if (total_cores == 0 || total_load <= 0) {
+        return;
+    }
+
+    const double avg_load_per_core = total_load / total_cores;
+    const double max_load_per_core = avg_load_per_core
+                                     * (1 + *_config.throughput_skew_ratio);
+
+    std::vector<const node_load*> hot_nodes;
+    for (const auto& [id, load] : rrs.node_loads) {
+        if (
+          !rrs.all_unavailable_nodes.contains(id)
+          && !rrs.decommissioning_nodes.contains(id)
+          && load.final_load_per_core() > max_load_per_core) {
+            hot_nodes.push_back(&load);
+        }
+    }
+    if (hot_nodes.empty()) {
+        return;
+    }
+    std::sort(
+      hot_nodes.begin(), hot_nodes.end(), [](const auto* lhs, const auto* rhs) {
+          return lhs->final_load_per_core() > rhs->final_load_per_core();
+      });
+
+    using load_ntp = std::pair<double, model::ntp>;
+    absl::flat_hash_map<model::node_id, std::vector<load_ntp>> ntp_on_hot_nodes;
+    for (const auto* node : hot_nodes) {
+        ntp_on_hot_nodes[node->node_id];
+    }
+    for (const auto& [tp_ns, topic] : _topic_table.topics_map()) {
+        auto topic_it = rrs.partition_loads.find(tp_ns);
+        if (topic_it == rrs.partition_loads.end()) {
+            continue;
+        }
+        for (const auto& a : topic.get_assignments()) {
+            auto load_it = topic_it->second.find(a.id);
+            if (load_it == topic_it->second.end()) {
+                continue;
+            }
+            for (const auto& r : a.replicas) {
+                auto it = ntp_on_hot_nodes.find(r.node_id);
+                if (it != ntp_on_hot_nodes.end()) {
+                    it->second.emplace_back(
+                      load_it->second, model::ntp(tp_ns.ns, tp_ns.tp, a.id));
+                }
+            }
+        }
+    }
+
+    for (const auto* node : hot_nodes) {
+        auto& partitions = ntp_on_hot_nodes[node->node_id];
+        std::sort(
+          partitions.begin(),
+          partitions.end(),
+          [](const auto& lhs, const auto& rhs) {
+              return lhs.first > rhs.first;
+          });
+
+        for (const auto& [partition_load, ntp] : partitions) {
+            if (node->final_load_per_core() <= max_load_per_core) {
+                break;
+            }
+            if (rrs.planned_moves_size >= _config.movement_disk_size_batch) {
+                return;
+            }
+            if (rrs.moving_partitions.contains(ntp)) {
+                continue;
+            }
+
+            const auto& topic_metadata = _topic_table.topics_map().at(
+              model::topic_namespace_view(ntp));
+            const auto& current_assignments
+              = topic_metadata.get_assignments().find(ntp.tp.partition);
+
+            auto partition_size = get_partition_size(ntp, rrs);
+            if (
+              !partition_size.has_value()
+              || !is_partition_movement_possible(
+                current_assignments->replicas, rrs)) {
+                continue;
+            }
+
+            std::vector<model::broker_shard> stable_replicas;
+            for (const auto& r : current_assignments->replicas) {
+                if (r.node_id != node->node_id) {
+                    stable_replicas.push_back(r);
+                }
+            }
+
+            auto constraints = get_partition_constraints(
+              *current_assignments,
+              topic_metadata.metadata,
+              partition_size.value(),
+              _config.soft_max_disk_usage_ratio,
+              rrs);
+            constraints.constraints.hard_constraints.push_back(
+              ss::make_lw_shared<hard_constraint_evaluator>(
+                distinct_from(rrs.all_unavailable_nodes)));
+            constraints.constraints.hard_constraints.push_back(
+              ss::make_lw_shared<hard_constraint_evaluator>(
+                load_not_overflowed_by_partition(
+                  max_load_per_core, partition_load, rrs.node_loads)));
+            constraints.constraints.soft_constraints.push_back(
+              ss::make_lw_shared<soft_constraint_evaluator>(
+                least_throughput_loaded(rrs.node_loads)));
+
+            auto new_allocation_units = get_reallocation(
+              ntp,
+              *current_assignments,
+              partition_size.value(),
+              std::move(constraints),
+              stable_replicas,
+              rrs);
+            if (new_allocation_units) {
+                result.reassignments.emplace_back(ntp_reassignments{
+                  .ntp = ntp,
+                  .allocation_units = std::move(new_allocation_units.value())});
+            }
+        }
+    }
+}
+
 /*
  * Cancel movement if new assignments contains unavailble node
  * and previous replica set doesn't contain this node
@@ -608,6 +834,16 @@ partition_balancer_planner::plan_reassignments(
         return result;
     }
 
+    if (_config.throughput_skew_ratio.has_value()) {
+        init_ntp_sizes_from_health_report(health_report, rrs);
+        rrs.partition_loads = collect_partition_loads(health_report);
+        rrs.node_loads = compute_node_loads(rrs.partition_loads);
+        get_throughput_reassignments(result, rrs);
+        if (!result.reassignments.empty()) {
+            result.status = status::movement_planned;
+        }
+    }
+
     return result;
 }
 
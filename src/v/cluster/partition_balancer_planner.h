@@ -34,6 +34,9 @@ struct planner_config {
     // Size of partitions that can be planned to move in one request
     size_t movement_disk_size_batch;
     std::chrono::seconds node_availability_timeout_sec;
+    // If set, planner moves partitions away from nodes which per core
+    // throughput exceeds the cluster average by more than this ratio.
+    std::optional<double> throughput_skew_ratio;
 };
 
 class partition_balancer_planner {
@@ -63,7 +66,18 @@ public:
     plan_data plan_reassignments(
       const cluster_health_report&, const std::vector<raft::follower_metrics>&);
 
+    /// Aggregates produce and fetch rates from the health report into the
+    /// load of every node and core known to the allocator.
+    absl::flat_hash_map<model::node_id, node_load>
+    compute_node_loads(const cluster_health_report&) const;
+
 private:
+    using partition_loads_t = absl::flat_hash_map<
+      model::topic_namespace,
+      absl::flat_hash_map<model::partition_id, double>,
+      model::topic_namespace_hash,
+      model::topic_namespace_eq>;
+
     struct reallocation_request_state {
         std::vector<model::node_id> all_nodes;
         absl::flat_hash_set<model::node_id> all_unavailable_nodes;
@@ -74,6 +88,10 @@ private:
 
         absl::flat_hash_map<model::ntp, size_t> ntp_sizes;
 
+        // Only filled when throughput balancing is enabled
+        partition_loads_t partition_loads;
+        absl::flat_hash_map<model::node_id, node_load> node_loads;
+
         // Partitions that are planned to move in current planner request
         absl::flat_hash_set<model::ntp> moving_partitions;
         uint64_t planned_moves_size = 0;
@@ -99,6 +117,17 @@ private:
 
     void get_full_node_reassignments(plan_data&, reallocation_request_state&);
 
+    void get_throughput_reassignments(plan_data&, reallocation_request_state&);
+
+    static partition_loads_t
+    collect_partition_loads(const cluster_health_report&);
+
+    absl::flat_hash_map<model::node_id, node_load>
+    compute_node_loads(const partition_loads_t&) const;
+
+    static double
+    get_partition_load(const model::ntp&, const reallocation_request_state&);
+
     void init_per_node_state(
       const cluster_health_report&,
       const std::vector<raft::follower_metrics>&,
@@ -17,6 +17,8 @@
 #include "model/timestamp.h"
 #include "serde/serde.h"
 
+#include <vector>
+
 namespace cluster {
 
 struct node_disk_space {
@@ -43,6 +45,57 @@ struct node_disk_space {
     }
 };
 
+/*
+ * Weight of the partition replica, computed from the produce and fetch rate of
+ * the partition. Each request is accounted as 1KiB of data so that the
+ * partitions serving many small requests are not treated as idle.
+ */
+inline double
+partition_load_weight(uint64_t bytes_rate, uint64_t request_rate) {
+    static constexpr double request_weight = 1024;
+    return static_cast<double>(bytes_rate)
+           + static_cast<double>(request_rate) * request_weight;
+}
+
+/*
+ * Observed load of the node built from the cluster health report. Every
+ * replica is charged with the load of its partition since followers
+ * replicate the same bytes the leader receives.
+ */
+struct node_load {
+    model::node_id node_id;
+    // load of each core of the node, indexed by shard id
+    std::vector<double> shard_loads;
+    // total load of the replicas hosted by the node
+    double load = 0;
+    // number of replicas contributing to the load
+    size_t replicas = 0;
+    // total load of partitions moved to this node
+    double assigned = 0;
+    // total load of partitions moved from this node
+    double released = 0;
+
+    node_load(model::node_id node_id, uint32_t cores)
+      : node_id(node_id)
+      , shard_loads(cores, 0) {}
+
+    void add_replica(ss::shard_id shard, double weight) {
+        if (shard < shard_loads.size()) {
+            shard_loads[shard] += weight;
+        }
+        load += weight;
+        ++replicas;
+    }
+
+    double final_load() const {
+        return std::max(0.0, load + assigned - released);
+    }
+
+    double final_load_per_core() const {
+        return shard_loads.empty() ? 0 : final_load() / shard_loads.size();
+    }
+};
+
 struct partition_balancer_violations
   : serde::envelope<partition_balancer_violations, serde::version<0>> {
     struct unavailable_node
@@ -92,6 +92,15 @@ std::optional<leader_term> partition_leaders_table::get_leader_term(
                 : std::nullopt;
 }
 
+void partition_leaders_table::reset() {
+    auto leaders = std::exchange(_leaders, {});
+    for (const auto& [key, _] : leaders) {
+        model::ntp ntp(key.tp_ns.ns, key.tp_ns.tp, key.pid);
+        _update_watchers.notify(
+          ntp, ntp, model::term_id{}, std::optional<model::node_id>{});
+    }
+}
+
 void partition_leaders_table::update_partition_leader(
   const model::ntp& ntp,
   model::term_id term,
@@ -158,6 +167,7 @@ void partition_leaders_table::update_partition_leader(
       it->second.current_leader,
       it->second.previous_leader,
       it->second.partition_revision);
+    _update_watchers.notify(ntp, ntp, term, leader_id);
     // notify waiters if update is setting the leader
     if (!leader_id) {
         return;
@@ -248,4 +258,15 @@ void partition_leaders_table::unregister_leadership_change_notification(
     return _watchers.unregister_notify(ntp, id);
 }
 
+notification_id_type
+partition_leaders_table::register_leadership_update_notification(
+  const model::ns& ns, leader_change_cb_t cb) {
+    return _update_watchers.register_notify(ns, std::move(cb));
+}
+
+void partition_leaders_table::unregister_leadership_update_notification(
+  notification_id_type id) {
+    return _update_watchers.unregister_notify(id);
+}
+
 } // namespace cluster
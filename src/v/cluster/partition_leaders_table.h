@@ -82,6 +82,8 @@ public:
         // ignore updates with old revision
         if (it != _leaders.end() && it->second.partition_revision <= revision) {
             _leaders.erase(it);
+            _update_watchers.notify(
+              ntp, ntp, model::term_id{}, std::optional<model::node_id>{});
         }
     }
 
@@ -94,7 +96,7 @@ public:
       model::term_id,
       std::optional<model::node_id>);
 
-    void reset() { _leaders.clear(); }
+    void reset();
 
     struct leader_info_t {
         model::topic_namespace tp_ns;
@@ -127,6 +129,15 @@ public:
     void unregister_leadership_change_notification(
       const model::ntp&, notification_id_type);
 
+    // Register a callback for every change of the partition leader metadata
+    // in a namespace. Contrary to the leadership change notifications this
+    // includes the updates changing only the term, clearing the leader and
+    // removing the partition.
+    notification_id_type register_leadership_update_notification(
+      const model::ns&, leader_change_cb_t);
+
+    void unregister_leadership_update_notification(notification_id_type);
+
 private:
     // optimized to reduce number of ntp copies
     struct leader_key {
@@ -222,6 +233,7 @@ private:
     ss::sharded<topic_table>& _topic_table;
 
     ntp_callbacks<leader_change_cb_t> _watchers;
+    ntp_callbacks<leader_change_cb_t> _update_watchers;
 };
 
 } // namespace cluster
@@ -24,6 +24,46 @@ replicated_partition_probe::replicated_partition_probe(
   : _partition(p)
   , _public_metrics(ssx::metrics::public_metrics_handle) {}
 
+void replicated_partition_probe::load_window::maybe_rotate(
+  clock_type::time_point now) {
+    auto elapsed = now - _current_start;
+    if (elapsed < window) {
+        return;
+    }
+    // the previous window is stale if more than one window passed without
+    // any requests
+    _previous = elapsed < 2 * window ? _current : counters{};
+    _current = {};
+    _current_start = now - elapsed % window;
+}
+
+void replicated_partition_probe::load_window::add(uint64_t bytes) {
+    maybe_rotate(clock_type::now());
+    _current.bytes += bytes;
+    _current.requests++;
+}
+
+partition_load replicated_partition_probe::load_window::rate() const {
+    auto now = clock_type::now();
+    auto elapsed = now - _current_start;
+    counters total{};
+    auto period = window;
+    if (elapsed < window) {
+        total.bytes = _previous.bytes + _current.bytes;
+        total.requests = _previous.requests + _current.requests;
+        period += elapsed;
+    } else if (elapsed < 2 * window) {
+        // the current window is complete but not rotated yet
+        total = _current;
+    }
+    auto seconds = std::max<int64_t>(
+      1, std::chrono::duration_cast<std::chrono::seconds>(period).count());
+    return partition_load{
+      .bytes_per_sec = total.bytes / seconds,
+      .requests_per_sec = total.requests / seconds,
+    };
+}
+
 void replicated_partition_probe::setup_metrics(const model::ntp& ntp) {
     setup_internal_metrics(ntp);
     setup_public_metrics(ntp);
@@ -223,6 +263,7 @@ partition_probe make_materialized_partition_probe() {
         void add_records_produced(uint64_t) final {}
         void add_bytes_fetched(uint64_t) final {}
         void add_bytes_produced(uint64_t) final {}
+        partition_load load() const final { return {}; }
     };
     return partition_probe(std::make_unique<impl>());
 }
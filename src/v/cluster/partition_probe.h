@@ -12,6 +12,7 @@
 #pragma once
 #include "model/fundamental.h"
 
+#include <seastar/core/lowres_clock.hh>
 #include <seastar/core/metrics_registration.hh>
 #include <seastar/core/shared_ptr.hh>
 
@@ -21,6 +22,12 @@ namespace cluster {
 
 class partition;
 
+/// Recent produce and fetch rate of the partition
+struct partition_load {
+    uint64_t bytes_per_sec{0};
+    uint64_t requests_per_sec{0};
+};
+
 class partition_probe {
 public:
     struct impl {
@@ -28,6 +35,7 @@ public:
         virtual void add_records_fetched(uint64_t) = 0;
         virtual void add_bytes_produced(uint64_t) = 0;
         virtual void add_bytes_fetched(uint64_t) = 0;
+        virtual partition_load load() const = 0;
         virtual void setup_metrics(const model::ntp&) = 0;
         virtual ~impl() noexcept = default;
     };
@@ -54,6 +62,9 @@ public:
         return _impl->add_bytes_fetched(bytes);
     }
 
+    /// Produce and fetch rate over the last minute or so
+    partition_load load() const { return _impl->load(); }
+
 private:
     std::unique_ptr<impl> _impl;
 };
@@ -65,19 +76,52 @@ public:
 
     void add_records_fetched(uint64_t cnt) final { _records_fetched += cnt; }
     void add_records_produced(uint64_t cnt) final { _records_produced += cnt; }
-    void add_bytes_fetched(uint64_t cnt) final { _bytes_fetched += cnt; }
-    void add_bytes_produced(uint64_t cnt) final { _bytes_produced += cnt; }
+    void add_bytes_fetched(uint64_t cnt) final {
+        _bytes_fetched += cnt;
+        _load.add(cnt);
+    }
+    void add_bytes_produced(uint64_t cnt) final {
+        _bytes_produced += cnt;
+        _load.add(cnt);
+    }
+    partition_load load() const final { return _load.rate(); }
 
 private:
     void setup_public_metrics(const model::ntp&);
     void setup_internal_metrics(const model::ntp&);
 
+    /*
+     * Tracks the produce and fetch rate using two consecutive fixed windows.
+     * The rate is estimated over the previous and the current window so
+     * it doesn't drop to zero when a new window starts.
+     */
+    class load_window {
+    public:
+        using clock_type = ss::lowres_clock;
+        static constexpr clock_type::duration window = std::chrono::seconds(60);
+
+        void add(uint64_t bytes);
+        partition_load rate() const;
+
+    private:
+        struct counters {
+            uint64_t bytes{0};
+            uint64_t requests{0};
+        };
+        void maybe_rotate(clock_type::time_point now);
+
+        counters _current;
+        counters _previous;
+        clock_type::time_point _current_start{clock_type::now()};
+    };
+
 private:
     const partition& _partition;
     uint64_t _records_produced{0};
     uint64_t _records_fetched{0};
     uint64_t _bytes_produced{0};
     uint64_t _bytes_fetched{0};
+    load_window _load;
     ss::metrics::metric_groups _metrics;
     ss::metrics::metric_groups _public_metrics;
 };
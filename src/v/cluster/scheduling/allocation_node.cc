@@ -11,6 +11,8 @@
 
 #include "cluster/scheduling/allocation_node.h"
 
+#include <numeric>
+
 namespace cluster {
 allocation_node::allocation_node(
   model::node_id id,
@@ -49,10 +51,56 @@ allocation_node::allocation_node(
 }
 
 ss::shard_id allocation_node::allocate() {
-    auto it = std::min_element(_weights.begin(), _weights.end());
+    auto it = _shard_loads.empty()
+                ? std::min_element(_weights.begin(), _weights.end())
+                : least_loaded_core();
     (*it)++; // increment the weights
     _allocated_partitions++;
-    return std::distance(_weights.begin(), it);
+    auto core = std::distance(_weights.begin(), it);
+    if (!_shard_loads.empty()) {
+        // account for the new replica until the next load update so that
+        // consecutive allocations are not all placed on the same core
+        _shard_loads[core] += _replica_load;
+    }
+    return core;
+}
+
+std::vector<uint32_t>::iterator allocation_node::least_loaded_core() {
+    // the load is only used to choose between the cores with similar number
+    // of partitions, otherwise cores with idle partitions would be
+    // overallocated
+    auto min_weight = *std::min_element(_weights.begin(), _weights.end());
+    auto max_weight = min_weight + std::max<uint32_t>(1, min_weight / 10);
+    auto best = _weights.end();
+    for (auto it = _weights.begin(); it != _weights.end(); ++it) {
+        if (*it > max_weight) {
+            continue;
+        }
+        if (best == _weights.end()) {
+            best = it;
+            continue;
+        }
+        auto load = _shard_loads[std::distance(_weights.begin(), it)];
+        auto best_load = _shard_loads[std::distance(_weights.begin(), best)];
+        if (load < best_load || (load == best_load && *it < *best)) {
+            best = it;
+        }
+    }
+    return best;
+}
+
+void allocation_node::update_shard_loads(std::vector<double> loads) {
+    if (loads.empty()) {
+        _shard_loads.clear();
+        _replica_load = 0;
+        return;
+    }
+    loads.resize(_weights.size(), 0);
+    _shard_loads = std::move(loads);
+    auto total = std::accumulate(_shard_loads.begin(), _shard_loads.end(), 0.0);
+    _replica_load = _allocated_partitions > allocation_capacity{0}
+                      ? total / _allocated_partitions()
+                      : 0;
 }
 
 void allocation_node::deallocate(ss::shard_id core) {
@@ -97,6 +145,9 @@ void allocation_node::update_core_count(uint32_t core_count) {
     for (auto i = current_cpus; i < core_count; ++i) {
         _weights.push_back(0);
     }
+    if (!_shard_loads.empty()) {
+        _shard_loads.resize(core_count, 0);
+    }
     _max_capacity = allocation_capacity(
       (core_count * _partitions_per_shard()) - _partitions_reserve_shard0());
 }
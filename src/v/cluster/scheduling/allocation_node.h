@@ -91,16 +91,27 @@ public:
     allocation_capacity max_capacity() const { return _max_capacity; }
     ss::shard_id allocate();
 
+    /// Updates observed load of the node cores. When the load is known new
+    /// replicas are placed on the least loaded core among the cores with
+    /// similar number of partitions. Empty vector resets the load.
+    void update_shard_loads(std::vector<double>);
+    const std::vector<double>& shard_loads() const { return _shard_loads; }
+
 private:
     friend allocation_state;
 
     void deallocate(ss::shard_id core);
     void allocate(ss::shard_id core);
     const absl::node_hash_map<ss::sstring, ss::sstring>& machine_labels() const;
+    std::vector<uint32_t>::iterator least_loaded_core();
 
     model::node_id _id;
     /// each index is a CPU. A weight is roughly the number of assignments
     std::vector<uint32_t> _weights;
+    /// observed load of each CPU, empty if unknown
+    std::vector<double> _shard_loads;
+    /// estimated load added to the core by a new replica
+    double _replica_load{0};
     allocation_capacity _max_capacity;
     allocation_capacity _allocated_partitions{0};
     /// generated by `rpk` usually in /etc/redpanda/machine_labels.json
@@ -180,6 +180,47 @@ hard_constraint_evaluator disk_not_overflowed_by_partition(
       max_disk_usage_ratio, partition_size, node_disk_reports));
 }
 
+hard_constraint_evaluator load_not_overflowed_by_partition(
+  const double max_load_per_core,
+  const double partition_load,
+  const absl::flat_hash_map<model::node_id, node_load>& node_loads) {
+    class impl : public hard_constraint_evaluator::impl {
+    public:
+        impl(
+          const double max_load_per_core,
+          const double partition_load,
+          const absl::flat_hash_map<model::node_id, node_load>& node_loads)
+          : _max_load_per_core(max_load_per_core)
+          , _partition_load(partition_load)
+          , _node_loads(node_loads) {}
+
+        bool evaluate(const allocation_node& node) const final {
+            auto it = _node_loads.find(node.id());
+            if (it == _node_loads.end()) {
+                return true;
+            }
+            const auto& load = it->second;
+            auto cores = std::max<size_t>(1, load.shard_loads.size());
+            auto peak_load = (load.final_load() + _partition_load) / cores;
+            return peak_load <= _max_load_per_core;
+        }
+
+        void print(std::ostream& o) const final {
+            fmt::print(
+              o,
+              "partition with load {} doesn't overload node",
+              _partition_load);
+        }
+
+        const double _max_load_per_core;
+        const double _partition_load;
+        const absl::flat_hash_map<model::node_id, node_load>& _node_loads;
+    };
+
+    return hard_constraint_evaluator(std::make_unique<impl>(
+      max_load_per_core, partition_load, node_loads));
+}
+
 soft_constraint_evaluator least_allocated() {
     class impl : public soft_constraint_evaluator::impl {
     public:
@@ -285,4 +326,45 @@ soft_constraint_evaluator least_disk_filled(
       std::make_unique<impl>(max_disk_usage_ratio, node_disk_reports));
 }
 
+soft_constraint_evaluator least_throughput_loaded(
+  const absl::flat_hash_map<model::node_id, node_load>& node_loads) {
+    class impl : public soft_constraint_evaluator::impl {
+    public:
+        explicit impl(
+          const absl::flat_hash_map<model::node_id, node_load>& node_loads)
+          : _node_loads(node_loads) {
+            for (const auto& [_, load] : _node_loads) {
+                _max_load_per_core = std::max(
+                  _max_load_per_core, load.final_load_per_core());
+            }
+        }
+
+        uint64_t score(const allocation_node& node) const final {
+            // we return 0 for the most loaded node and 10'000'000 for idle
+            // nodes
+            if (_max_load_per_core <= 0) {
+                return soft_constraint_evaluator::max_score;
+            }
+            auto it = _node_loads.find(node.id());
+            if (it == _node_loads.end()) {
+                return soft_constraint_evaluator::max_score;
+            }
+            auto load = std::min(
+              it->second.final_load_per_core(), _max_load_per_core);
+            return uint64_t(
+              soft_constraint_evaluator::max_score
+              * ((_max_load_per_core - load) / _max_load_per_core));
+        }
+
+        void print(std::ostream& o) const final {
+            fmt::print(o, "least throughput loaded");
+        }
+
+        const absl::flat_hash_map<model::node_id, node_load>& _node_loads;
+        double _max_load_per_core = 0;
+    };
+
+    return soft_constraint_evaluator(std::make_unique<impl>(node_loads));
+}
+
 } // namespace cluster
@@ -42,6 +42,16 @@ hard_constraint_evaluator disk_not_overflowed_by_partition(
   const absl::flat_hash_map<model::node_id, node_disk_space>&
     node_disk_reports);
 
+/*
+ * constraint checks that new partition won't increase per core load of the
+ * node above max_load_per_core. partition_load is the weight of partition
+ * that is going to be allocated. Nodes without load report are accepted.
+ */
+hard_constraint_evaluator load_not_overflowed_by_partition(
+  const double max_load_per_core,
+  const double partition_load,
+  const absl::flat_hash_map<model::node_id, node_load>& node_loads);
+
 soft_constraint_evaluator least_allocated();
 
 /*
@@ -54,6 +64,14 @@ soft_constraint_evaluator least_disk_filled(
   const absl::flat_hash_map<model::node_id, node_disk_space>&
     node_disk_reports);
 
+/*
+ * constraint scores nodes on observed produce and fetch throughput per core,
+ * the least loaded node gets the highest score. Nodes without load report
+ * are treated as idle.
+ */
+soft_constraint_evaluator least_throughput_loaded(
+  const absl::flat_hash_map<model::node_id, node_load>& node_loads);
+
 soft_constraint_evaluator
 distinct_rack(const std::vector<model::broker_shard>&, const allocation_state&);
 
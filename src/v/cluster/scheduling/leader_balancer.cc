@@ -10,6 +10,7 @@
  */
 #include "cluster/scheduling/leader_balancer.h"
 
+#include "cluster/health_monitor_frontend.h"
 #include "cluster/logger.h"
 #include "cluster/members_table.h"
 #include "cluster/partition_leaders_table.h"
@@ -43,24 +44,28 @@ leader_balancer::leader_balancer(
   raft::consensus_client_protocol client,
   ss::sharded<shard_table>& shard_table,
   ss::sharded<partition_manager>& partition_manager,
+  ss::sharded<health_monitor_frontend>& health_monitor,
   ss::sharded<ss::abort_source>& as,
   config::binding<bool>&& enabled,
   config::binding<std::chrono::milliseconds>&& idle_timeout,
   config::binding<std::chrono::milliseconds>&& mute_timeout,
   config::binding<std::chrono::milliseconds>&& node_mute_timeout,
   config::binding<size_t>&& transfer_limit_per_shard,
+  config::binding<model::leader_balancer_mode>&& mode,
   consensus_ptr raft0)
   : _enabled(std::move(enabled))
   , _idle_timeout(std::move(idle_timeout))
   , _mute_timeout(std::move(mute_timeout))
   , _node_mute_timeout(std::move(node_mute_timeout))
   , _transfer_limit_per_shard(std::move(transfer_limit_per_shard))
+  , _mode(std::move(mode))
   , _topics(topics)
   , _leaders(leaders)
   , _members(members)
   , _client(std::move(client))
   , _shard_table(shard_table)
   , _partition_manager(partition_manager)
+  , _health_monitor(health_monitor)
   , _as(as)
   , _raft0(std::move(raft0))
   , _timer([this] { trigger_balance(); }) {
@@ -362,8 +367,8 @@ ss::future<ss::stop_iteration> leader_balancer::balance() {
      * (e.g. on average little should change between ticks) and bounding the
      * search for leader moves.
      */
-    greedy_balanced_shards strategy(build_index(), muted_nodes());
-    auto cores = strategy.stats();
+    auto strategy = co_await make_strategy();
+    auto cores = strategy->stats();
 
     if (clusterlog.is_enabled(ss::log_level::trace)) {
         for (const auto& core : cores) {
@@ -420,8 +425,8 @@ ss::future<ss::stop_iteration> leader_balancer::balance() {
         co_return ss::stop_iteration::yes;
     }
 
-    auto error = strategy.error();
-    auto transfer = strategy.find_movement(muted_groups());
+    auto error = strategy->error();
+    auto transfer = strategy->find_movement(muted_groups());
     if (!transfer) {
         vlog(
           clusterlog.debug,
@@ -477,6 +482,66 @@ ss::future<ss::stop_iteration> leader_balancer::balance() {
     co_return ss::stop_iteration::no;
 }
 
+ss::future<std::unique_ptr<leader_balancer_strategy>>
+leader_balancer::make_strategy() {
+    if (_mode() == model::leader_balancer_mode::throughput_balanced_shards) {
+        co_await refresh_group_weights();
+        co_return std::make_unique<throughput_balanced_shards>(
+          build_index(), muted_nodes(), _group_weights);
+    }
+    co_return std::make_unique<greedy_balanced_shards>(
+      build_index(), muted_nodes());
+}
+
+/*
+ * computes the weights of the groups from the produce and fetch rates
+ * reported by the group leaders in the cluster health report. the report is
+ * cached by the health monitor on the controller leader so this doesn't
+ * normally require any rpc. if the report is not available the previous
+ * weights are used, the groups without a weight are balanced by count.
+ */
+ss::future<> leader_balancer::refresh_group_weights() {
+    const auto now = clock_type::now();
+    if (now < _group_weights_expiry) {
+        co_return;
+    }
+
+    auto report = co_await _health_monitor.local().get_cluster_health(
+      cluster_report_filter{},
+      force_refresh::no,
+      model::timeout_clock::now() + group_weights_timeout);
+    if (!report) {
+        vlog(
+          clusterlog.info,
+          "Leadership balancer: unable to get partition rates: {}",
+          report.error().message());
+        co_return;
+    }
+
+    throughput_balanced_shards::group_weights weights;
+    for (const auto& node : report.value().node_reports) {
+        for (const auto& topic : node.topics) {
+            for (const auto& partition : topic.partitions) {
+                // only leaders serve produce and fetch requests
+                if (partition.leader_id != node.id) {
+                    continue;
+                }
+                auto assignment = _topics.get_partition_assignment(model::ntp(
+                  topic.tp_ns.ns, topic.tp_ns.tp, partition.id));
+                if (!assignment) {
+                    continue;
+                }
+                weights.insert_or_assign(
+                  assignment->group,
+                  throughput_balanced_shards::group_weight(
+                    partition.bytes_rate, partition.request_rate));
+            }
+        }
+    }
+    _group_weights = std::move(weights);
+    _group_weights_expiry = now + group_weights_refresh_interval;
+}
+
 absl::flat_hash_set<model::node_id> leader_balancer::muted_nodes() const {
     absl::flat_hash_set<model::node_id> nodes;
     const auto now = raft::clock_type::now();
@@ -10,9 +10,11 @@
  */
 #pragma once
 #include "absl/container/flat_hash_map.h"
+#include "cluster/fwd.h"
 #include "cluster/partition_manager.h"
 #include "cluster/scheduling/leader_balancer_probe.h"
 #include "cluster/scheduling/leader_balancer_strategy.h"
+#include "cluster/scheduling/leader_balancer_throughput.h"
 #include "cluster/types.h"
 #include "raft/consensus.h"
 #include "raft/consensus_client_protocol.h"
@@ -69,6 +71,14 @@ class leader_balancer {
      */
     static constexpr clock_type::duration throttle_reactivation_delay = 5s;
 
+    /*
+     * the throughput strategy uses produce and fetch rates from the cluster
+     * health report. the rates are averaged over a minute so there is no
+     * point in refreshing them on every balancer tick.
+     */
+    static constexpr clock_type::duration group_weights_refresh_interval = 30s;
+    static constexpr clock_type::duration group_weights_timeout = 5s;
+
 public:
     leader_balancer(
       topic_table&,
@@ -77,12 +87,14 @@ public:
       raft::consensus_client_protocol,
       ss::sharded<shard_table>&,
       ss::sharded<partition_manager>&,
+      ss::sharded<health_monitor_frontend>&,
       ss::sharded<ss::abort_source>&,
       config::binding<bool>&&,
       config::binding<std::chrono::milliseconds>&&,
       config::binding<std::chrono::milliseconds>&&,
       config::binding<std::chrono::milliseconds>&&,
       config::binding<size_t>&&,
+      config::binding<model::leader_balancer_mode>&&,
       consensus_ptr);
 
     ss::future<> start();
@@ -93,6 +105,8 @@ private:
     using reassignment = leader_balancer_strategy::reassignment;
 
     index_type build_index();
+    ss::future<std::unique_ptr<leader_balancer_strategy>> make_strategy();
+    ss::future<> refresh_group_weights();
     absl::flat_hash_set<raft::group_id> muted_groups() const;
     absl::flat_hash_set<model::node_id> muted_nodes() const;
 
@@ -162,6 +176,19 @@ private:
      */
     config::binding<size_t> _transfer_limit_per_shard;
 
+    /*
+     * selects the balancing strategy: either the number of leaders or the
+     * produce and fetch load of the leaders is balanced across shards.
+     */
+    config::binding<model::leader_balancer_mode> _mode;
+
+    /*
+     * weights of the groups used by the throughput strategy, computed from
+     * the partition rates reported by the group leaders.
+     */
+    throughput_balanced_shards::group_weights _group_weights;
+    clock_type::time_point _group_weights_expiry;
+
     struct last_known_leader {
         model::broker_shard shard;
         clock_type::time_point expires;
@@ -182,6 +209,7 @@ private:
     raft::consensus_client_protocol _client;
     ss::sharded<shard_table>& _shard_table;
     ss::sharded<partition_manager>& _partition_manager;
+    ss::sharded<health_monitor_frontend>& _health_monitor;
     ss::sharded<ss::abort_source>& _as;
     consensus_ptr _raft0;
     ss::gate _gate;
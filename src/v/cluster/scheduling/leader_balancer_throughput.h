@@ -0,0 +1,215 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "cluster/scheduling/leader_balancer_strategy.h"
+#include "model/metadata.h"
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+/*
+ * Throughput balancer strategy weights every group by its recent produce and
+ * fetch load and moves leaders from the most loaded core to the replica core
+ * which minimizes the load of the two cores involved. Each leader also has a
+ * fixed base weight, so idle groups are still balanced by count.
+ */
+namespace cluster {
+
+class throughput_balanced_shards final : public leader_balancer_strategy {
+public:
+    /*
+     * the base weight of a leader and the weight of a single request per
+     * second, both expressed in bytes per second.
+     */
+    static constexpr double leader_weight = 1024;
+    static constexpr double request_weight = 1024;
+
+    /*
+     * moves that reduce the load of the most loaded core by less than this
+     * fraction are ignored. the rates are estimates and chasing small
+     * differences would only cause leadership churn.
+     */
+    static constexpr double min_improvement = 0.01;
+
+    /*
+     * Map a group to its weight. Groups missing from the map have the base
+     * leader weight.
+     */
+    using group_weights = absl::flat_hash_map<raft::group_id, double>;
+
+    /*
+     * Compute the weight of a group from its produce and fetch rate.
+     */
+    static double group_weight(uint64_t bytes_rate, uint64_t request_rate) {
+        return leader_weight + static_cast<double>(bytes_rate)
+               + static_cast<double>(request_rate) * request_weight;
+    }
+
+    throughput_balanced_shards(
+      index_type cores,
+      absl::flat_hash_set<model::node_id> muted_nodes,
+      group_weights weights)
+      : _cores(std::move(cores))
+      , _muted_nodes(std::move(muted_nodes))
+      , _weights(std::move(weights)) {
+        rebuild_load_index();
+    }
+
+    double calc_target_load() const {
+        double total = 0;
+        size_t num_cores = 0;
+        for (const auto& [shard, load] : _shard_load) {
+            if (_muted_nodes.contains(shard.node_id)) {
+                continue;
+            }
+            total += load;
+            ++num_cores;
+        }
+        return num_cores == 0 ? 0 : total / static_cast<double>(num_cores);
+    }
+
+    /*
+     * error = sum((shard.load - target)^2 for each shard)
+     *
+     * where the load of the shard is the sum of the weights of the groups led
+     * by the shard.
+     */
+    double error() const final {
+        auto target_load = calc_target_load();
+        double error = 0;
+        for (const auto& [shard, load] : _shard_load) {
+            if (_muted_nodes.contains(shard.node_id)) {
+                continue;
+            }
+            error += pow(load - target_load, 2);
+        }
+        return error;
+    }
+
+    /*
+     * Find a group reassignment that lowers the load of the most loaded core.
+     * For the most loaded core every group is considered for a move to each
+     * of its replicas and the move that gives the lowest load of the two
+     * cores involved wins. If the most loaded core can't be improved (e.g. it
+     * leads a single hot group) the next loaded core is considered. Every
+     * returned move also reduces the total error since the load of the
+     * target core stays below the original load of the source core.
+     *
+     * Muted nodes are treated the same way as in the greedy strategy: the
+     * leadership isn't moved to or from them.
+     */
+    std::optional<reassignment>
+    find_movement(const absl::flat_hash_set<raft::group_id>& skip) const final {
+        for (const auto& from : _load) {
+            if (_muted_nodes.contains(from->first.node_id)) {
+                continue;
+            }
+
+            const auto from_load = _shard_load.at(from->first);
+            const auto threshold = std::max(
+              leader_weight / 2, from_load * min_improvement);
+            auto best_load = from_load - threshold;
+            std::optional<reassignment> best;
+
+            for (const auto& [group, replicas] : from->second) {
+                if (skip.contains(group)) {
+                    continue;
+                }
+                const auto weight = weight_of(group);
+                for (const auto& to : replicas) {
+                    if (to == from->first) {
+                        continue;
+                    }
+                    if (_muted_nodes.contains(to.node_id)) {
+                        continue;
+                    }
+                    auto new_load = std::max(
+                      from_load - weight, load_of(to) + weight);
+                    if (new_load < best_load) {
+                        best_load = new_load;
+                        best = reassignment{group, from->first, to};
+                    }
+                }
+            }
+
+            if (best) {
+                return best;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    std::vector<shard_load> stats() const final {
+        std::vector<shard_load> ret;
+        ret.reserve(_load.size());
+        std::transform(
+          _load.cbegin(),
+          _load.cend(),
+          std::back_inserter(ret),
+          [](const auto& e) {
+              return shard_load{
+                e->first, static_cast<size_t>(e->second.size())};
+          });
+        return ret;
+    }
+
+    /*
+     * Total weight of the groups led by the shard.
+     */
+    double load_of(const model::broker_shard& shard) const {
+        auto it = _shard_load.find(shard);
+        return it == _shard_load.end() ? 0 : it->second;
+    }
+
+private:
+    double weight_of(raft::group_id group) const {
+        auto it = _weights.find(group);
+        return it == _weights.end() ? leader_weight : it->second;
+    }
+
+    /*
+     * build the load index, which is a vector of iterators to each element in
+     * the core index, where the iterators in the load index are sorted by the
+     * total weight of the groups having their leader on a given core, most
+     * loaded first.
+     */
+    void rebuild_load_index() {
+        _load.clear();
+        _load.reserve(_cores.size());
+        _shard_load.reserve(_cores.size());
+        for (auto it = _cores.cbegin(); it != _cores.cend(); ++it) {
+            _load.push_back(it);
+            double load = 0;
+            for (const auto& group : it->second) {
+                load += weight_of(group.first);
+            }
+            _shard_load.emplace(it->first, load);
+        }
+        std::sort(
+          _load.begin(), _load.end(), [this](const auto& a, const auto& b) {
+              return _shard_load.at(a->first) > _shard_load.at(b->first);
+          });
+    }
+
+    index_type _cores;
+    absl::flat_hash_set<model::node_id> _muted_nodes;
+    group_weights _weights;
+    std::vector<index_type::const_iterator> _load;
+    absl::flat_hash_map<model::broker_shard, double> _shard_load;
+};
+
+} // namespace cluster
@@ -276,10 +276,23 @@ partition_allocator::allocate(allocation_request request) {
 
     for (auto& p_constraints : request.partitions) {
         auto const partition_id = p_constraints.partition_id;
+        if (!_node_loads.empty()) {
+            p_constraints.constraints.soft_constraints.push_back(
+              ss::make_lw_shared<soft_constraint_evaluator>(
+                least_throughput_loaded(_node_loads)));
+        }
         auto replicas = allocate_partition(std::move(p_constraints));
         if (!replicas) {
             return replicas.error();
         }
+        // account for the new replicas until the next load update, otherwise
+        // all partitions of the request would land on the least loaded node
+        for (const auto& bs : replicas.value()) {
+            if (auto it = _node_loads.find(bs.node_id);
+                it != _node_loads.end()) {
+                it->second.assigned += _replica_load;
+            }
+        }
         assignments.emplace_back(
           _state->next_group_id(), partition_id, std::move(replicas.value()));
     }
@@ -373,6 +386,26 @@ result<allocation_units> partition_allocator::reassign_decommissioned_replicas(
       {std::move(assignment)}, current_replicas, _state.get());
 }
 
+void partition_allocator::update_node_loads(
+  absl::flat_hash_map<model::node_id, node_load> loads) {
+    _node_loads = std::move(loads);
+    double total_load = 0;
+    size_t total_replicas = 0;
+    for (const auto& [_, load] : _node_loads) {
+        total_load += load.load;
+        total_replicas += load.replicas;
+    }
+    _replica_load = total_replicas > 0 ? total_load / total_replicas : 0;
+    for (const auto& [id, node] : _state->allocation_nodes()) {
+        auto it = _node_loads.find(id);
+        if (it == _node_loads.end()) {
+            node->update_shard_loads({});
+        } else {
+            node->update_shard_loads(it->second.shard_loads);
+        }
+    }
+}
+
 void partition_allocator::deallocate(
   const std::vector<model::broker_shard>& replicas) {
     for (auto& r : replicas) {
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "cluster/logger.h"
+#include "cluster/partition_balancer_types.h"
 #include "cluster/scheduling/allocation_node.h"
 #include "cluster/scheduling/allocation_state.h"
 #include "cluster/scheduling/allocation_strategy.h"
@@ -19,6 +20,8 @@
 #include "config/property.h"
 #include "vlog.h"
 
+#include <absl/container/flat_hash_map.h>
+
 namespace cluster {
 
 class partition_allocator {
@@ -70,6 +73,15 @@ public:
     void add_allocations(const std::vector<model::broker_shard>&);
     void remove_allocations(const std::vector<model::broker_shard>&);
 
+    /// updates the observed load of the nodes, new partitions are placed on
+    /// the least loaded nodes and cores. Empty map disables load aware
+    /// placement.
+    void update_node_loads(absl::flat_hash_map<model::node_id, node_load>);
+
+    const absl::flat_hash_map<model::node_id, node_load>& node_loads() const {
+        return _node_loads;
+    }
+
     allocation_state& state() { return *_state; }
 
 private:
@@ -124,5 +136,8 @@ private:
     config::binding<uint32_t> _partitions_per_shard;
     config::binding<uint32_t> _partitions_reserve_shard0;
     config::binding<bool> _enable_rack_awareness;
+    absl::flat_hash_map<model::node_id, node_load> _node_loads;
+    // average load of a replica, charged to the nodes of new replicas
+    double _replica_load{0};
 };
 } // namespace cluster
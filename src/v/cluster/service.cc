@@ -478,17 +478,28 @@ void clear_partition_sizes(node_health_report& report) {
         }
     }
 }
+
+void clear_partition_loads(node_health_report& report) {
+    for (auto& t : report.topics) {
+        for (auto& p : t.partitions) {
+            p.bytes_rate = 0;
+            p.request_rate = 0;
+        }
+    }
+}
 } // namespace
 
 ss::future<get_node_health_reply>
 service::do_collect_node_health_report(get_node_health_request req) {
-    auto res = co_await _hm_frontend.local().collect_node_health(
-      std::move(req.filter));
+    // nodes not supporting delta reports never send the acked version
+    auto res = co_await _hm_frontend.local().collect_node_health_delta(
+      std::move(req.filter), req.acked_version);
     if (res.has_error()) {
         co_return get_node_health_reply{
           .error = map_health_monitor_error_code(res.error())};
     }
-    auto report = std::move(res.value());
+    auto reply = std::move(res.value());
+    auto& report = *reply.report;
     // clear all revision ids to prevent sending them to old versioned redpanda
     // nodes
     if (req.decoded_version > get_node_health_request::revision_id_version) {
@@ -499,10 +510,12 @@ service::do_collect_node_health_report(get_node_health_request req) {
     if (req.decoded_version > get_node_health_request::size_bytes_version) {
         clear_partition_sizes(report);
     }
-    co_return get_node_health_reply{
-      .error = errc::success,
-      .report = std::move(report),
-    };
+    // clear all partition loads to prevent sending them to old versioned
+    // redpanda nodes
+    if (req.decoded_version > get_node_health_request::load_version) {
+        clear_partition_loads(report);
+    }
+    co_return reply;
 }
 
 ss::future<get_cluster_health_reply>
@@ -532,6 +545,14 @@ service::do_get_cluster_health_report(get_cluster_health_request req) {
             clear_partition_sizes(r);
         }
     }
+
+    // clear all partition loads to prevent sending them to old versioned
+    // redpanda nodes
+    if (req.decoded_version > get_cluster_health_request::load_version) {
+        for (auto& r : report.node_reports) {
+            clear_partition_loads(r);
+        }
+    }
     co_return get_cluster_health_reply{
       .error = errc::success,
       .report = std::move(report),
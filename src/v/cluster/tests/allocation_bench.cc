@@ -7,6 +7,7 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "cluster/partition_balancer_types.h"
 #include "cluster/tests/partition_allocator_fixture.h"
 #include "cluster/types.h"
 #include "raft/types.h"
@@ -65,3 +66,93 @@ PERF_TEST_F(partition_allocator_fixture, recovery) {
       replicas, raft::group_id(replicas.size() / 3));
     perf_tests::stop_measuring_time();
 }
+
+/*
+ * Allocator state of a cluster with 100k partitions. When the loads are
+ * enabled every replica has random produce and fetch throughput and new
+ * replicas are placed with load aware constraints.
+ */
+struct populated_allocator_fixture : partition_allocator_fixture {
+    static constexpr int partitions = 100'000;
+    static constexpr int nodes = 3;
+    static constexpr int cores = 24;
+
+    explicit populated_allocator_fixture(bool with_loads) {
+        absl::flat_hash_map<model::node_id, cluster::node_load> loads;
+        for (int n = 0; n < nodes; ++n) {
+            register_node(n, cores);
+            loads.emplace(
+              model::node_id(n), cluster::node_load(model::node_id(n), cores));
+        }
+        std::vector<model::broker_shard> replicas;
+        for (int p = 0; p < partitions; ++p) {
+            replicas.clear();
+            auto weight = cluster::partition_load_weight(
+              prng() % 1_MiB, prng() % 100);
+            for (int n = 0; n < nodes; ++n) {
+                auto shard = (p + n) % cores;
+                replicas.push_back(model::broker_shard{
+                  .node_id = model::node_id(n), .shard = uint32_t(shard)});
+                loads.at(model::node_id(n)).add_replica(shard, weight);
+            }
+            allocator.update_allocation_state(replicas, raft::group_id(p + 1));
+        }
+        if (with_loads) {
+            allocator.update_node_loads(std::move(loads));
+        }
+    }
+};
+
+struct count_allocator_fixture : populated_allocator_fixture {
+    count_allocator_fixture()
+      : populated_allocator_fixture(false) {}
+};
+
+struct load_aware_allocator_fixture : populated_allocator_fixture {
+    load_aware_allocator_fixture()
+      : populated_allocator_fixture(true) {}
+};
+
+PERF_TEST_F(count_allocator_fixture, allocation_3_100k) {
+    auto req = make_allocation_request(1, 3);
+
+    perf_tests::start_measuring_time();
+    auto vals = allocator.allocate(std::move(req));
+    perf_tests::do_not_optimize(vals);
+    perf_tests::stop_measuring_time();
+}
+
+PERF_TEST_F(load_aware_allocator_fixture, allocation_3_100k) {
+    auto req = make_allocation_request(1, 3);
+
+    perf_tests::start_measuring_time();
+    auto vals = allocator.allocate(std::move(req));
+    perf_tests::do_not_optimize(vals);
+    perf_tests::stop_measuring_time();
+}
+
+PERF_TEST_F(count_allocator_fixture, allocation_1000_100k) {
+    auto req = make_allocation_request(1000, 3);
+
+    perf_tests::start_measuring_time();
+    auto vals = allocator.allocate(std::move(req));
+    perf_tests::do_not_optimize(vals);
+    perf_tests::stop_measuring_time();
+}
+
+PERF_TEST_F(load_aware_allocator_fixture, allocation_1000_100k) {
+    auto req = make_allocation_request(1000, 3);
+
+    perf_tests::start_measuring_time();
+    auto vals = allocator.allocate(std::move(req));
+    perf_tests::do_not_optimize(vals);
+    perf_tests::stop_measuring_time();
+}
+
+PERF_TEST_F(load_aware_allocator_fixture, update_node_loads_100k) {
+    auto loads = allocator.node_loads();
+
+    perf_tests::start_measuring_time();
+    allocator.update_node_loads(std::move(loads));
+    perf_tests::stop_measuring_time();
+}
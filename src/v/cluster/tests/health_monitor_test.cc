@@ -354,3 +354,62 @@ FIXTURE_TEST(test_alive_status, cluster_test_fixture) {
           });
     }).get();
 }
+
+cluster::partition_status make_partition_status(int id, int64_t term) {
+    return cluster::partition_status{
+      .id = model::partition_id(id),
+      .term = model::term_id(term),
+      .leader_id = model::node_id(0),
+      .revision_id = model::revision_id(1),
+      .size_bytes = 1000,
+      .bytes_rate = 100,
+      .request_rate = 10,
+    };
+}
+
+SEASTAR_THREAD_TEST_CASE(test_health_report_delta) {
+    model::topic_namespace tp_a(model::kafka_namespace, model::topic("a"));
+    model::topic_namespace tp_b(model::kafka_namespace, model::topic("b"));
+    std::vector<cluster::topic_status> topics{
+      cluster::topic_status{
+        .tp_ns = tp_a,
+        .partitions = {make_partition_status(0, 1), make_partition_status(1, 1)}},
+      cluster::topic_status{
+        .tp_ns = tp_b, .partitions = {make_partition_status(0, 1)}},
+    };
+
+    auto reported = cluster::index_partition_statuses(topics);
+    // leader side copy of the report
+    auto cached = topics;
+
+    // nothing changed
+    auto delta = cluster::make_health_delta(reported, topics, 0.1);
+    BOOST_REQUIRE(delta.changed.empty());
+    BOOST_REQUIRE(delta.removed.empty());
+
+    // small rate changes are not reported, term change is
+    topics[0].partitions[0].bytes_rate = 105;
+    topics[0].partitions[1].term = model::term_id(2);
+    // topic b is deleted, topic c is created
+    model::topic_namespace tp_c(model::kafka_namespace, model::topic("c"));
+    topics[1] = cluster::topic_status{
+      .tp_ns = tp_c, .partitions = {make_partition_status(0, 1)}};
+
+    delta = cluster::make_health_delta(reported, topics, 0.1);
+    BOOST_REQUIRE_EQUAL(delta.changed.size(), 2);
+    BOOST_REQUIRE_EQUAL(delta.removed.size(), 1);
+    BOOST_REQUIRE_EQUAL(delta.removed[0], model::ntp(tp_b.ns, tp_b.tp, model::partition_id(0)));
+
+    cluster::apply_health_delta(cached, std::move(delta));
+    auto cached_index = cluster::index_partition_statuses(cached);
+    BOOST_REQUIRE_EQUAL(cached_index.size(), 3);
+    BOOST_REQUIRE(cached_index == reported);
+
+    // rate drifts by small steps are accumulated against the last reported
+    // value
+    topics[0].partitions[0].bytes_rate = 111;
+    delta = cluster::make_health_delta(reported, topics, 0.1);
+    BOOST_REQUIRE_EQUAL(delta.changed.size(), 1);
+    BOOST_REQUIRE_EQUAL(delta.changed[0].partitions.size(), 1);
+    BOOST_REQUIRE_EQUAL(delta.changed[0].partitions[0].bytes_rate, 111);
+}
@@ -9,7 +9,9 @@
  * by the Apache License, Version 2.0
  */
 #include "cluster/scheduling/leader_balancer_greedy.h"
+#include "cluster/scheduling/leader_balancer_throughput.h"
 #include "leader_balancer_test_utils.h"
+#include "units.h"
 
 #include <seastar/testing/perf_tests.hh>
 
@@ -45,8 +47,54 @@ void balancer_bench(bool measure_all) {
     perf_tests::stop_measuring_time();
 }
 
+void throughput_balancer_bench(bool measure_all) {
+    constexpr int node_count = 72;
+    constexpr int shards_per_node = 16;
+    constexpr int groups_per_shard = 80;
+    constexpr int replicas = 3;
+
+    cluster::leader_balancer_strategy::index_type index
+      = leader_balancer_test_utils::make_cluster_index(
+        node_count, shards_per_node, groups_per_shard, replicas, true);
+
+    // leader counts are balanced, but every 10th group is hot and the hot
+    // groups are unevenly spread between the shards
+    cluster::throughput_balanced_shards::group_weights weights;
+    for (const auto& [shard, groups] : index) {
+        for (const auto& [group, _] : groups) {
+            auto hot = group() % 10 == 0 || group() % 7 == 0;
+            weights[group] = cluster::throughput_balanced_shards::group_weight(
+              hot ? 10_MiB : 10_KiB, hot ? 100 : 1);
+        }
+    }
+
+    if (measure_all) {
+        perf_tests::start_measuring_time();
+    }
+
+    auto balancer = cluster::throughput_balanced_shards(
+      index, {}, std::move(weights));
+    vassert(balancer.error() > 0, "expected load imbalance");
+
+    if (!measure_all) {
+        perf_tests::start_measuring_time();
+    }
+    auto movement = balancer.find_movement({});
+    vassert(movement, "expected movement");
+    perf_tests::do_not_optimize(movement);
+    perf_tests::stop_measuring_time();
+}
+
 } // namespace
 
 PERF_TEST(leader_balancing, bench_movement) { balancer_bench(false); }
 
 PERF_TEST(leader_balancing, bench_all) { balancer_bench(true); }
+
+PERF_TEST(leader_balancing, bench_throughput_movement) {
+    throughput_balancer_bench(false);
+}
+
+PERF_TEST(leader_balancing, bench_throughput_all) {
+    throughput_balancer_bench(true);
+}
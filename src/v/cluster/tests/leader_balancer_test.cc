@@ -12,8 +12,10 @@
 
 #include "absl/container/flat_hash_map.h"
 #include "cluster/scheduling/leader_balancer_greedy.h"
+#include "cluster/scheduling/leader_balancer_throughput.h"
 #include "leader_balancer_test_utils.h"
 #include "model/metadata.h"
+#include "units.h"
 
 #include <absl/container/flat_hash_set.h>
 #include <boost/test/unit_test.hpp>
@@ -361,3 +363,132 @@ BOOST_AUTO_TEST_CASE(greedy_skip) {
       raft::group_id(5), raft::group_id(6)};
     BOOST_REQUIRE(no_movement(spec, {0}, skip));
 }
+
+using tbs = cluster::throughput_balanced_shards;
+
+/**
+ * @brief Create a throughput balancer from a cluster_spec, produce rates of
+ * the groups (bytes per second) and set of muted nodes.
+ */
+static auto from_spec_throughput(
+  const cluster_spec& spec,
+  const absl::flat_hash_map<int, uint64_t>& rates,
+  const absl::flat_hash_set<int>& muted = {}) {
+    auto [index, _] = from_spec(spec);
+
+    tbs::group_weights weights;
+    for (auto [group, rate] : rates) {
+        weights[raft::group_id(group)] = tbs::group_weight(rate, 0);
+    }
+
+    absl::flat_hash_set<model::node_id> muted_bs;
+    for (auto id : muted) {
+        muted_bs.insert(model::node_id{id});
+    }
+
+    return std::make_tuple(index, tbs{index, muted_bs, std::move(weights)});
+}
+
+BOOST_AUTO_TEST_CASE(throughput_idle_groups_balanced_by_count) {
+    // without any rates the strategy balances the number of leaders
+    auto [index, balancer] = from_spec_throughput(
+      {
+        // clang-format off
+        {{1, 2, 3, 4}, {-1}},
+        {{},           {-1}},
+        // clang-format on
+      },
+      {});
+    BOOST_REQUIRE_GT(balancer.error(), 0);
+
+    auto movement = balancer.find_movement({});
+    BOOST_REQUIRE(movement);
+    check_valid(index, *movement);
+    BOOST_REQUIRE(*movement == re(1, 0, 1));
+}
+
+BOOST_AUTO_TEST_CASE(throughput_moves_hot_groups) {
+    // leader counts are balanced as well as possible, so the greedy strategy
+    // doesn't move anything, but both hot groups are on node 0
+    cluster_spec spec{
+      // clang-format off
+      {{1, 2}, {-1}},
+      {{3},    {-1}},
+      // clang-format on
+    };
+    BOOST_REQUIRE(no_movement(spec));
+
+    auto [index, balancer] = from_spec_throughput(
+      spec, {{1, 100_KiB}, {2, 100_KiB}});
+    auto movement = balancer.find_movement({});
+    BOOST_REQUIRE(movement);
+    check_valid(index, *movement);
+    BOOST_REQUIRE(*movement == re(1, 0, 1));
+
+    // skipped hot group is not moved, the other one is
+    movement = balancer.find_movement({raft::group_id(1)});
+    BOOST_REQUIRE(movement);
+    BOOST_REQUIRE(*movement == re(2, 0, 1));
+}
+
+BOOST_AUTO_TEST_CASE(throughput_single_hot_group) {
+    // moving the only hot group would just overload the other node and
+    // moving the idle groups onto the hot node makes things worse
+    auto [index, balancer] = from_spec_throughput(
+      {
+        // clang-format off
+        {{1},    {-1}},
+        {{2, 3}, {-1}},
+        // clang-format on
+      },
+      {{1, 100_KiB}});
+    BOOST_REQUIRE(!balancer.find_movement({}));
+}
+
+BOOST_AUTO_TEST_CASE(throughput_ignores_small_improvements) {
+    // the nodes are loaded almost equally, no move lowers the max load
+    auto [index, balancer] = from_spec_throughput(
+      {
+        // clang-format off
+        {{1, 2}, {-1}},
+        {{3},    {-1}},
+        // clang-format on
+      },
+      {{1, 200_KiB}, {3, 200_KiB}});
+    BOOST_REQUIRE(!balancer.find_movement({}));
+}
+
+BOOST_AUTO_TEST_CASE(throughput_muted) {
+    cluster_spec spec{
+      // clang-format off
+      {{1, 2}, {-1}},
+      {{3},    {-1}},
+      {{},     {-1}},
+      // clang-format on
+    };
+    absl::flat_hash_map<int, uint64_t> rates{
+      {1, 100_KiB}, {2, 100_KiB}, {3, 50_KiB}};
+
+    // base case, hot group moves to the idle node
+    {
+        auto [index, balancer] = from_spec_throughput(spec, rates);
+        auto movement = balancer.find_movement({});
+        BOOST_REQUIRE(movement);
+        BOOST_REQUIRE(*movement == re(1, 0, 2));
+    }
+
+    // idle node muted, hot group moves to the less loaded node
+    {
+        auto [index, balancer] = from_spec_throughput(spec, rates, {2});
+        auto movement = balancer.find_movement({});
+        BOOST_REQUIRE(movement);
+        BOOST_REQUIRE(*movement == re(1, 0, 1));
+    }
+
+    // loaded node muted, moving the only group of node 1 to the idle node
+    // doesn't lower the max load
+    {
+        auto [index, balancer] = from_spec_throughput(spec, rates, {0});
+        BOOST_REQUIRE(!balancer.find_movement({}));
+    }
+}
@@ -15,13 +15,15 @@ namespace leader_balancer_test_utils {
 
 /**
  * @brief Create an artificial cluster index object with the given
- * number of nodes, shards, groups and replica count.
+ * number of nodes, shards, groups and replica count. Unless unique_groups
+ * is set, the group ids are reused across the shards.
  */
 static cluster::leader_balancer_strategy::index_type make_cluster_index(
   int node_count,
   int shards_per_node,
   int groups_per_shard,
-  int replica_count) {
+  int replica_count,
+  bool unique_groups = false) {
     cluster::leader_balancer_strategy::index_type index;
 
     std::vector<model::broker_shard> shards;
@@ -33,9 +35,10 @@ static cluster::leader_balancer_strategy::index_type make_cluster_index(
     }
 
     size_t replica = 0;
+    int group_base = 0;
     for (auto shard : shards) {
         for (auto g = 0U; g < groups_per_shard; g++) {
-            raft::group_id group(g);
+            raft::group_id group(unique_groups ? group_base + g : g);
             std::vector<model::broker_shard> replicas;
             replicas.push_back(shard); // the "leader"
             while (replicas.size() != replica_count) {
@@ -46,6 +49,7 @@ static cluster::leader_balancer_strategy::index_type make_cluster_index(
             }
             index[shard][group] = std::move(replicas);
         }
+        group_base += groups_per_shard;
     }
 
     return index;
@@ -613,3 +613,41 @@ FIXTURE_TEST(rack_aware_assignment_2, partition_allocator_fixture) {
     BOOST_REQUIRE(racks.contains("rack-a"));
     BOOST_REQUIRE(racks.contains("rack-b"));
 }
+
+FIXTURE_TEST(load_aware_assignment, partition_allocator_fixture) {
+    register_node(0, 3);
+    register_node(1, 3);
+    register_node(2, 3);
+
+    absl::flat_hash_map<model::node_id, cluster::node_load> loads;
+    for (int i = 0; i < 3; ++i) {
+        loads.emplace(
+          model::node_id(i), cluster::node_load(model::node_id(i), 3));
+    }
+    // node 0 is hot
+    loads.at(model::node_id(0)).add_replica(0, 100_MiB);
+    // node 1 has a hot core
+    loads.at(model::node_id(1)).add_replica(1, 1_MiB);
+    allocator.update_node_loads(std::move(loads));
+
+    auto units = allocator.allocate(make_allocation_request(1, 2)).value();
+    const auto& replicas = units.get_assignments().front().replicas;
+    BOOST_REQUIRE_EQUAL(replicas.size(), 2);
+    for (const auto& bs : replicas) {
+        // the hot node is avoided
+        BOOST_REQUIRE_NE(bs.node_id, model::node_id(0));
+        if (bs.node_id == model::node_id(1)) {
+            // core 0 holds reserved weight and core 1 is hot
+            BOOST_REQUIRE_EQUAL(bs.shard, 2);
+        }
+    }
+
+    // disabling load aware placement restores the default core choice
+    allocator.update_node_loads({});
+    auto units_2 = allocator.allocate(make_allocation_request(1, 3)).value();
+    for (const auto& bs : units_2.get_assignments().front().replicas) {
+        if (bs.node_id != model::node_id(2)) {
+            BOOST_REQUIRE_EQUAL(bs.shard, 1);
+        }
+    }
+}
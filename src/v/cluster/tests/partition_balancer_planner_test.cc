@@ -823,3 +823,90 @@ FIXTURE_TEST(
     BOOST_REQUIRE_EQUAL(plan_data.cancellations.size(), 0);
     BOOST_REQUIRE_EQUAL(plan_data.failed_reassignments_count, 1);
 }
+
+/*
+ * 2 nodes; 1 topic; throughput balancing enabled
+ * Actual
+ *   node_0: partitions: 4; throughput per partition: 1MiB/s;
+ *   node_1: partitions: 0;
+ * Expected
+ *   node_0: partitions: 2;
+ *   node_1: partitions: 2;
+ */
+FIXTURE_TEST(test_throughput_balancing, partition_balancer_planner_fixture) {
+    vlog(logger.debug, "test_throughput_balancing");
+    allocator_register_nodes(1);
+    create_topic("topic-1", 4, 1);
+    allocator_register_nodes(1);
+
+    auto hr = create_health_report();
+    for (auto& p : hr.node_reports[0].topics.front().partitions) {
+        p.bytes_rate = 1_MiB;
+    }
+    auto fm = create_follower_metrics();
+
+    // without throughput balancing the placement is valid
+    auto plan_data = planner.plan_reassignments(hr, fm);
+    check_violations(plan_data, {}, {});
+    BOOST_REQUIRE_EQUAL(plan_data.reassignments.size(), 0);
+
+    cluster::partition_balancer_planner throughput_planner(
+      cluster::planner_config{
+        .soft_max_disk_usage_ratio = 0.8,
+        .hard_max_disk_usage_ratio = 0.95,
+        .movement_disk_size_batch = reallocation_batch_size,
+        .node_availability_timeout_sec = std::chrono::minutes(1),
+        .throughput_skew_ratio = 0.2},
+      workers.table.local(),
+      workers.members.local(),
+      workers.allocator.local());
+
+    auto loads = throughput_planner.compute_node_loads(hr);
+    BOOST_REQUIRE_EQUAL(loads.at(model::node_id(0)).load, 4.0 * 1_MiB);
+    BOOST_REQUIRE_EQUAL(loads.at(model::node_id(0)).replicas, 4);
+    BOOST_REQUIRE_EQUAL(loads.at(model::node_id(1)).load, 0);
+
+    plan_data = throughput_planner.plan_reassignments(hr, fm);
+    check_violations(plan_data, {}, {});
+    BOOST_REQUIRE(
+      plan_data.status
+      == cluster::partition_balancer_planner::status::movement_planned);
+    BOOST_REQUIRE_EQUAL(plan_data.reassignments.size(), 2);
+    for (const auto& r : plan_data.reassignments) {
+        check_expected_assignments(
+          r.allocation_units.get_assignments().front().replicas,
+          {model::node_id(1)});
+    }
+}
+
+/*
+ * 3 nodes; 1 topic; throughput balancing enabled
+ * The only loaded partition is replicated to all nodes, there is no node
+ * it could be moved to.
+ */
+FIXTURE_TEST(
+  test_throughput_balancing_no_target, partition_balancer_planner_fixture) {
+    vlog(logger.debug, "test_throughput_balancing_no_target");
+    allocator_register_nodes(3);
+    create_topic("topic-1", 2, 3);
+
+    auto hr = create_health_report();
+    hr.node_reports[0].topics.front().partitions.front().bytes_rate = 1_MiB;
+    auto fm = create_follower_metrics();
+
+    cluster::partition_balancer_planner throughput_planner(
+      cluster::planner_config{
+        .soft_max_disk_usage_ratio = 0.8,
+        .hard_max_disk_usage_ratio = 0.95,
+        .movement_disk_size_batch = reallocation_batch_size,
+        .node_availability_timeout_sec = std::chrono::minutes(1),
+        .throughput_skew_ratio = 0.2},
+      workers.table.local(),
+      workers.members.local(),
+      workers.allocator.local());
+
+    auto plan_data = throughput_planner.plan_reassignments(hr, fm);
+    check_violations(plan_data, {}, {});
+    BOOST_REQUIRE_EQUAL(plan_data.reassignments.size(), 0);
+    BOOST_REQUIRE_EQUAL(plan_data.failed_reassignments_count, 0);
+}
@@ -57,7 +57,9 @@ inline partition_status random_partition_status() {
       tests::random_optional(
         [] { return tests::random_named_int<model::node_id>(); }),
       tests::random_named_int<model::revision_id>(),
-      random_generators::get_int<size_t>()};
+      random_generators::get_int<size_t>(),
+      random_generators::get_int<uint64_t>(),
+      random_generators::get_int<uint64_t>()};
 }
 
 inline topic_status random_topic_status() {
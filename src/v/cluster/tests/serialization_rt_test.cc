@@ -776,6 +776,8 @@ cluster::topic_status random_topic_status() {
           .leader_id = std::nullopt,
           .revision_id = tests::random_named_int<model::revision_id>(),
           .size_bytes = random_generators::get_int<size_t>(),
+          .bytes_rate = random_generators::get_int<uint64_t>(),
+          .request_rate = random_generators::get_int<uint64_t>(),
         });
     }
     cluster::topic_status data{
@@ -1652,6 +1654,7 @@ SEASTAR_THREAD_TEST_CASE(serde_reflection_roundtrip) {
           .filter = {
             .ntp_filters = random_partitions_filter(),
           },
+          .acked_version = random_generators::get_int<uint64_t>(),
         };
         roundtrip_test(data);
     }
@@ -1725,6 +1728,9 @@ SEASTAR_THREAD_TEST_CASE(serde_reflection_roundtrip) {
         report.include_drain_status = true; // so adl considers drain status
         cluster::get_node_health_reply data{
           .report = report,
+          .report_version = random_generators::get_int<uint64_t>(),
+          .base_version = random_generators::get_int<uint64_t>(),
+          .removed_partitions = {model::random_ntp(), model::random_ntp()},
         };
         roundtrip_test(data);
         // try serde with non-default error code. adl doesn't encode error so
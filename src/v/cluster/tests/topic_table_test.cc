@@ -177,11 +177,11 @@ void validate_brokers_revisions(
     auto tp_it = all_metadata.find(model::topic_namespace_view(ntp));
     BOOST_REQUIRE(tp_it != all_metadata.end());
 
-    auto p_it = tp_it->second.metadata.get_assignments().find(ntp.tp.partition);
-    BOOST_REQUIRE(p_it != tp_it->second.metadata.get_assignments().end());
+    auto p_it = tp_it->second.get_assignments().find(ntp.tp.partition);
+    BOOST_REQUIRE(p_it != tp_it->second.get_assignments().end());
 
-    auto rev_it = tp_it->second.replica_revisions.find(ntp.tp.partition);
-    BOOST_REQUIRE(rev_it != tp_it->second.replica_revisions.end());
+    auto rev_it = tp_it->second->replica_revisions.find(ntp.tp.partition);
+    BOOST_REQUIRE(rev_it != tp_it->second->replica_revisions.end());
 
     for (auto& bs : p_it->replicas) {
         fmt::print("replica: {}\n", bs);
@@ -397,3 +397,122 @@ FIXTURE_TEST(test_tracking_broker_revisions, topic_table_fixture) {
         {n_4, model::revision_id(13)},
         {n_3, model::revision_id(11)}});
 }
+
+FIXTURE_TEST(test_publish_to_other_shards, topic_table_fixture) {
+    struct shard_view {
+        size_t topics{0};
+        uintptr_t item{0};
+        std::optional<size_t> retention_bytes;
+        size_t deltas{0};
+    };
+    auto tp_1 = make_tp_ns("test_tp_1");
+    auto collect = [this, tp_1] {
+        return table
+          .map([tp_1](cluster::topic_table& t) {
+              return ss::do_with(
+                ss::abort_source{}, [&t, tp_1](ss::abort_source& as) {
+                    const auto& md = t.all_topics_metadata();
+                    const auto& item = md.at(tp_1);
+                    shard_view v{
+                      .topics = md.size(),
+                      .item = reinterpret_cast<uintptr_t>(&*item),
+                      .retention_bytes = item.get_configuration()
+                                           .properties.retention_bytes
+                                           .has_value()
+                                           ? std::make_optional(
+                                             item.get_configuration()
+                                               .properties.retention_bytes
+                                               .value())
+                                           : std::nullopt,
+                    };
+                    if (!t.has_pending_changes()) {
+                        return ss::make_ready_future<shard_view>(v);
+                    }
+                    return t.wait_for_changes(as).then(
+                      [v](std::vector<cluster::topic_table::delta> d) mutable {
+                          v.deltas = d.size();
+                          return v;
+                      });
+                });
+          })
+          .get0();
+    };
+
+    create_topics();
+    table.local().publish().get();
+
+    // every shard sees the same item and the deltas of the published commands
+    auto views = collect();
+    for (const auto& v : views) {
+        BOOST_REQUIRE_EQUAL(v.topics, 3);
+        BOOST_REQUIRE_EQUAL(v.item, views[0].item);
+        BOOST_REQUIRE(v.retention_bytes == 2_GiB);
+        BOOST_REQUIRE_EQUAL(v.deltas, 21);
+    }
+
+    cluster::incremental_topic_updates update;
+    update.retention_bytes.value = tristate<size_t>(1_GiB);
+    update.retention_bytes.op = cluster::incremental_update_operation::set;
+    auto ec = table.local()
+                .apply(
+                  cluster::update_topic_properties_cmd(tp_1, update),
+                  model::offset(10))
+                .get0();
+    BOOST_REQUIRE_EQUAL(ec, cluster::errc::success);
+
+    // the owner updated its own copy of the item, other shards keep the
+    // previously published one until the next publish
+    views = collect();
+    BOOST_REQUIRE(views[0].retention_bytes == 1_GiB);
+    BOOST_REQUIRE_EQUAL(views[0].deltas, 1);
+    for (size_t i = 1; i < views.size(); ++i) {
+        BOOST_REQUIRE_NE(views[i].item, views[0].item);
+        BOOST_REQUIRE(views[i].retention_bytes == 2_GiB);
+        BOOST_REQUIRE_EQUAL(views[i].deltas, 0);
+    }
+
+    table.local().publish().get();
+    views = collect();
+    for (size_t i = 1; i < views.size(); ++i) {
+        BOOST_REQUIRE_EQUAL(views[i].item, views[0].item);
+        BOOST_REQUIRE(views[i].retention_bytes == 1_GiB);
+        BOOST_REQUIRE_EQUAL(views[i].deltas, 1);
+    }
+}
+
+FIXTURE_TEST(test_metadata_memory_usage, topic_table_fixture) {
+    BOOST_REQUIRE_EQUAL(table.local().metadata_memory_usage(), 0);
+
+    create_topics();
+    table.local().publish().get();
+    const auto created = table.local().metadata_memory_usage();
+    BOOST_REQUIRE_GT(created, 0);
+
+    auto ec = table.local()
+                .apply(
+                  cluster::delete_topic_cmd(
+                    make_tp_ns("test_tp_2"), make_tp_ns("test_tp_2")),
+                  model::offset(0))
+                .get0();
+    BOOST_REQUIRE_EQUAL(ec, cluster::errc::success);
+    table.local().publish().get();
+    const auto deleted = table.local().metadata_memory_usage();
+    BOOST_REQUIRE_LT(deleted, created);
+
+    ec = table.local()
+           .apply(
+             cluster::delete_topic_cmd(
+               make_tp_ns("test_tp_1"), make_tp_ns("test_tp_1")),
+             model::offset(0))
+           .get0();
+    BOOST_REQUIRE_EQUAL(ec, cluster::errc::success);
+    ec = table.local()
+           .apply(
+             cluster::delete_topic_cmd(
+               make_tp_ns("test_tp_3"), make_tp_ns("test_tp_3")),
+             model::offset(0))
+           .get0();
+    BOOST_REQUIRE_EQUAL(ec, cluster::errc::success);
+    table.local().publish().get();
+    BOOST_REQUIRE_EQUAL(table.local().metadata_memory_usage(), 0);
+}
@@ -19,6 +19,7 @@
 #include "model/metadata.h"
 
 #include <seastar/core/coroutine.hh>
+#include <seastar/core/smp.hh>
 
 #include <optional>
 
@@ -33,9 +34,8 @@ topic_table::transform_topics(Func&& f) const {
       std::cbegin(_topics),
       std::cend(_topics),
       std::back_inserter(ret),
-      [f = std::forward<Func>(f)](
-        const std::pair<model::topic_namespace, topic_metadata_item>& p) {
-          return f(p.second);
+      [f = std::forward<Func>(f)](const underlying_t::value_type& p) {
+          return f(*p.second);
       });
     return ret;
 }
@@ -74,8 +74,9 @@ topic_table::apply(create_topic_cmd cmd, model::offset offset) {
 
     _topics.insert({
       cmd.key,
-      std::move(md),
+      shared_topic_metadata_item(std::move(md)),
     });
+    mark_topic_dirty(cmd.key);
     notify_waiters();
 
     _probe.handle_topic_creation(std::move(cmd.key));
@@ -106,6 +107,7 @@ topic_table::apply(delete_topic_cmd cmd, model::offset offset) {
               found->second.erase(cmd.value) > 0,
               "non_replicable_topic should exist in hierarchy: {}",
               tp_nsv);
+            mark_hierarchy_dirty(found->first);
         } else {
             /// Prevent deletion of source topics that have non_replicable
             /// topics. To delete this topic all of its non_replicable descedent
@@ -119,12 +121,15 @@ topic_table::apply(delete_topic_cmd cmd, model::offset offset) {
 
         for (auto& p_as : tp->second.get_assignments()) {
             auto ntp = model::ntp(cmd.key.ns, cmd.key.tp, p_as.id);
-            _updates_in_progress.erase(ntp);
+            if (_updates_in_progress.erase(ntp) > 0) {
+                mark_update_dirty(ntp);
+            }
             _pending_deltas.emplace_back(
               std::move(ntp), p_as, offset, delete_type);
         }
 
         _topics.erase(tp);
+        mark_topic_dirty(cmd.value);
         notify_waiters();
         _probe.handle_topic_deletion(cmd.key);
 
@@ -139,20 +144,22 @@ topic_table::apply(create_partition_cmd cmd, model::offset offset) {
         co_return errc::topic_not_exists;
     }
 
+    auto& md = tp->second.mutate();
+    mark_topic_dirty(tp->first);
     // add partitions
-    auto prev_partition_count = tp->second.get_configuration().partition_count;
+    auto prev_partition_count = md.get_configuration().partition_count;
     // update partitions count
-    tp->second.get_configuration().partition_count
+    md.get_configuration().partition_count
       = cmd.value.cfg.new_total_partition_count;
     // add assignments of newly created partitions
     for (auto& p_as : cmd.value.assignments) {
         p_as.id += model::partition_id(prev_partition_count);
-        tp->second.get_assignments().emplace(p_as);
+        md.get_assignments().emplace(p_as);
         // propagate deltas
         auto ntp = model::ntp(cmd.key.ns, cmd.key.tp, p_as.id);
         for (auto& bs : p_as.replicas) {
-            tp->second.replica_revisions[p_as.id][bs.node_id]
-              = model::revision_id(offset);
+            md.replica_revisions[p_as.id][bs.node_id] = model::revision_id(
+              offset);
         }
         _pending_deltas.emplace_back(
           std::move(ntp),
@@ -160,7 +167,7 @@ topic_table::apply(create_partition_cmd cmd, model::offset offset) {
           offset,
           delta::op_type::add,
           std::nullopt,
-          tp->second.replica_revisions[p_as.id]);
+          md.replica_revisions[p_as.id]);
     }
 
     notify_waiters();
@@ -178,10 +185,10 @@ topic_table::apply(move_partition_replicas_cmd cmd, model::offset o) {
           errc::topic_operation_error);
     }
 
-    auto current_assignment_it = tp->second.get_assignments().find(
+    auto assignment_it = tp->second.get_assignments().find(
       cmd.key.tp.partition);
 
-    if (current_assignment_it == tp->second.get_assignments().end()) {
+    if (assignment_it == tp->second.get_assignments().end()) {
         return ss::make_ready_future<std::error_code>(
           errc::partition_not_exists);
     }
@@ -193,15 +200,21 @@ topic_table::apply(move_partition_replicas_cmd cmd, model::offset o) {
     // assignment is already up to date, this operation is NOP do not propagate
     // delta
 
-    if (are_replica_sets_equal(current_assignment_it->replicas, cmd.value)) {
+    if (are_replica_sets_equal(assignment_it->replicas, cmd.value)) {
         return ss::make_ready_future<std::error_code>(errc::success);
     }
-    auto revisions_it = tp->second.replica_revisions.find(cmd.key.tp.partition);
+
+    auto& md = tp->second.mutate();
+    mark_topic_dirty(tp->first);
+    auto current_assignment_it = md.get_assignments().find(
+      cmd.key.tp.partition);
+    auto revisions_it = md.replica_revisions.find(cmd.key.tp.partition);
     vassert(
-      revisions_it != tp->second.replica_revisions.end(),
+      revisions_it != md.replica_revisions.end(),
       "partition {}, replica revisions map must exists as partition is present",
       cmd.key);
 
+    mark_update_dirty(cmd.key);
     _updates_in_progress.emplace(
       cmd.key,
       in_progress_update{
@@ -237,8 +250,10 @@ topic_table::apply(move_partition_replicas_cmd cmd, model::offset o) {
     if (found != _topics_hierarchy.end()) {
         for (const auto& cs : found->second) {
             /// Insert non-replicable topic into the 'updates_in_progress' set
+            model::ntp child_ntp(cs.ns, cs.tp, current_assignment_it->id);
+            mark_update_dirty(child_ntp);
             auto [_, success] = _updates_in_progress.emplace(
-              model::ntp(cs.ns, cs.tp, current_assignment_it->id),
+              std::move(child_ntp),
               in_progress_update{
                 .previous_replicas = current_assignment_it->replicas,
                 .state = in_progress_state::update_requested,
@@ -256,10 +271,12 @@ topic_table::apply(move_partition_replicas_cmd cmd, model::offset o) {
               sfound != _topics.end(),
               "Non replicable topic must exist: {}",
               cs);
-            auto assignment_it = sfound->second.get_assignments().find(
+            auto& child_md = sfound->second.mutate();
+            mark_topic_dirty(cs);
+            auto assignment_it = child_md.get_assignments().find(
               current_assignment_it->id);
             vassert(
-              assignment_it != sfound->second.get_assignments().end(),
+              assignment_it != child_md.get_assignments().end(),
               "Non replicable partition doesn't exist: {}-{}",
               cs,
               current_assignment_it->id);
@@ -315,6 +332,7 @@ topic_table::apply(finish_moving_partition_replicas_cmd cmd, model::offset o) {
     }
 
     _updates_in_progress.erase(it);
+    mark_update_dirty(cmd.key);
 
     partition_assignment delta_assignment{
       current_assignment_it->group,
@@ -326,9 +344,9 @@ topic_table::apply(finish_moving_partition_replicas_cmd cmd, model::offset o) {
     auto found = _topics_hierarchy.find(model::topic_namespace_view(cmd.key));
     if (found != _topics_hierarchy.end()) {
         for (const auto& cs : found->second) {
-            bool erased = _updates_in_progress.erase(
-                            model::ntp(cs.ns, cs.tp, cmd.key.tp.partition))
-                          > 0;
+            model::ntp child_ntp(cs.ns, cs.tp, cmd.key.tp.partition);
+            mark_update_dirty(child_ntp);
+            bool erased = _updates_in_progress.erase(child_ntp) > 0;
             if (!erased) {
                 vlog(
                   clusterlog.error,
@@ -370,10 +388,7 @@ topic_table::apply(cancel_moving_partition_replicas_cmd cmd, model::offset o) {
         co_return errc::topic_operation_error;
     }
 
-    auto current_assignment_it = tp->second.get_assignments().find(
-      cmd.key.tp.partition);
-
-    if (current_assignment_it == tp->second.get_assignments().end()) {
+    if (!tp->second.get_assignments().contains(cmd.key.tp.partition)) {
         co_return errc::partition_not_exists;
     }
 
@@ -400,13 +415,19 @@ topic_table::apply(cancel_moving_partition_replicas_cmd cmd, model::offset o) {
     in_progress_it->second.state = cmd.value.force
                                      ? in_progress_state::force_cancel_requested
                                      : in_progress_state::cancel_requested;
+    mark_update_dirty(cmd.key);
+
+    auto& md = tp->second.mutate();
+    mark_topic_dirty(tp->first);
+    auto current_assignment_it = md.get_assignments().find(
+      cmd.key.tp.partition);
 
     auto replicas = current_assignment_it->replicas;
     // replace replica set with set from in progress operation
     current_assignment_it->replicas = in_progress_it->second.previous_replicas;
-    auto revisions_it = tp->second.replica_revisions.find(cmd.key.tp.partition);
+    auto revisions_it = md.replica_revisions.find(cmd.key.tp.partition);
     vassert(
-      revisions_it != tp->second.replica_revisions.end(),
+      revisions_it != md.replica_revisions.end(),
       "partition {} replica revisions map must exists",
       cmd.key);
 
@@ -432,10 +453,12 @@ topic_table::apply(cancel_moving_partition_replicas_cmd cmd, model::offset o) {
               "Non replicable topic must exist: {} as it was found in "
               "hierarchy",
               cs);
-            auto assignment_it = sfound->second.get_assignments().find(
+            auto& child_md = sfound->second.mutate();
+            mark_topic_dirty(cs);
+            auto assignment_it = child_md.get_assignments().find(
               current_assignment_it->id);
             vassert(
-              assignment_it != sfound->second.get_assignments().end(),
+              assignment_it != child_md.get_assignments().end(),
               "Non replicable partition {}/{} assignment must exists",
               cs,
               current_assignment_it->id);
@@ -541,7 +564,9 @@ topic_table::apply(update_topic_properties_cmd cmd, model::offset o) {
     if (tp == _topics.end() || !tp->second.is_topic_replicable()) {
         co_return make_error_code(errc::topic_not_exists);
     }
-    auto& properties = tp->second.get_configuration().properties;
+    auto& md = tp->second.mutate();
+    mark_topic_dirty(tp->first);
+    auto& properties = md.get_configuration().properties;
     auto& overrides = cmd.value;
     /**
      * Update topic properties
@@ -561,8 +586,8 @@ topic_table::apply(update_topic_properties_cmd cmd, model::offset o) {
 
     // generate deltas for controller backend
     std::vector<topic_table_delta> deltas;
-    deltas.reserve(tp->second.get_assignments().size());
-    for (const auto& p_as : tp->second.get_assignments()) {
+    deltas.reserve(md.get_assignments().size());
+    for (const auto& p_as : md.get_assignments()) {
         deltas.emplace_back(
           model::ntp(cmd.key.ns, cmd.key.tp, p_as.id),
           p_as,
@@ -615,14 +640,16 @@ topic_table::apply(create_non_replicable_topic_cmd cmd, model::offset o) {
           success,
           "Duplicate non_replicable_topic detected when it shouldn't exist");
     }
+    mark_hierarchy_dirty(source);
     auto md = topic_metadata(
       std::move(cfg), std::move(p_as), model::revision_id(o()), source.tp);
 
     _topics.insert(
       {new_non_rep_topic,
-       topic_metadata_item{
+       shared_topic_metadata_item(topic_metadata_item{
          .metadata = std::move(md),
-       }});
+       })});
+    mark_topic_dirty(new_non_rep_topic);
     notify_waiters();
     co_return make_error_code(errc::success);
 }
@@ -643,11 +670,19 @@ void topic_table::notify_waiters() {
     if (!changes.empty()) {
         _last_consumed_by_notifier = changes.back().offset;
     }
+    if (ss::this_shard_id() == owner_shard && ss::smp::count > 1) {
+        std::copy(
+          std::next(_pending_deltas.begin(), _pending_deltas_recorded),
+          _pending_deltas.end(),
+          std::back_inserter(_unpublished_deltas));
+        _pending_deltas_recorded = _pending_deltas.size();
+    }
 
     /// Consume all pending deltas
     if (!_waiters.empty()) {
         changes.clear();
         changes.swap(_pending_deltas);
+        _pending_deltas_recorded = 0;
         std::vector<std::unique_ptr<waiter>> active_waiters;
         active_waiters.swap(_waiters);
         for (auto& w : active_waiters) {
@@ -656,12 +691,133 @@ void topic_table::notify_waiters() {
     }
 }
 
+void topic_table::mark_topic_dirty(const model::topic_namespace& tp_ns) {
+    // recorded even without other shards to keep the memory usage estimate
+    // up to date
+    if (ss::this_shard_id() == owner_shard) {
+        _dirty_topics.insert(tp_ns);
+    }
+}
+
+void topic_table::mark_hierarchy_dirty(const model::topic_namespace& tp_ns) {
+    if (ss::this_shard_id() == owner_shard && ss::smp::count > 1) {
+        _dirty_hierarchy.insert(tp_ns);
+    }
+}
+
+void topic_table::mark_update_dirty(const model::ntp& ntp) {
+    if (ss::this_shard_id() == owner_shard && ss::smp::count > 1) {
+        _dirty_updates.insert(ntp);
+    }
+}
+
+ss::future<> topic_table::publish() {
+    vassert(
+      ss::this_shard_id() == owner_shard,
+      "topic table changes can only be published from the owner shard");
+    if (
+      _dirty_topics.empty() && _dirty_hierarchy.empty()
+      && _dirty_updates.empty() && _unpublished_deltas.empty()) {
+        co_return;
+    }
+
+    published_update update;
+    update.topics.reserve(_dirty_topics.size());
+    for (auto& tp_ns : std::exchange(_dirty_topics, {})) {
+        update_memory_usage(tp_ns);
+        auto it = _topics.find(tp_ns);
+        update.topics.emplace_back(
+          tp_ns,
+          it == _topics.end() ? std::nullopt : std::make_optional(it->second));
+    }
+    update.hierarchy.reserve(_dirty_hierarchy.size());
+    for (auto& tp_ns : std::exchange(_dirty_hierarchy, {})) {
+        auto it = _topics_hierarchy.find(tp_ns);
+        update.hierarchy.emplace_back(
+          tp_ns,
+          it == _topics_hierarchy.end() ? std::nullopt
+                                        : std::make_optional(it->second));
+    }
+    update.updates.reserve(_dirty_updates.size());
+    for (auto& ntp : std::exchange(_dirty_updates, {})) {
+        auto it = _updates_in_progress.find(ntp);
+        update.updates.emplace_back(
+          ntp,
+          it == _updates_in_progress.end() ? std::nullopt
+                                           : std::make_optional(it->second));
+    }
+    update.deltas = std::exchange(_unpublished_deltas, {});
+    _probe.handle_publish(update.topics.size(), update.deltas.size());
+
+    // the update is copied on the destination shards, only the reference
+    // counts of the shared items are updated across shards
+    co_await container().invoke_on_others(
+      [&update](topic_table& table) { table.apply_published(update); });
+}
+
+void topic_table::apply_published(published_update update) {
+    for (auto& [tp_ns, item] : update.topics) {
+        if (item) {
+            _topics.insert_or_assign(tp_ns, std::move(*item));
+        } else {
+            _topics.erase(tp_ns);
+        }
+    }
+    for (auto& [tp_ns, children] : update.hierarchy) {
+        if (children) {
+            _topics_hierarchy.insert_or_assign(tp_ns, std::move(*children));
+        } else {
+            _topics_hierarchy.erase(tp_ns);
+        }
+    }
+    for (auto& [ntp, in_progress] : update.updates) {
+        if (in_progress) {
+            _updates_in_progress.insert_or_assign(ntp, std::move(*in_progress));
+        } else {
+            _updates_in_progress.erase(ntp);
+        }
+    }
+    std::move(
+      update.deltas.begin(),
+      update.deltas.end(),
+      std::back_inserter(_pending_deltas));
+    notify_waiters();
+}
+
+static size_t estimate_memory_usage(
+  const model::topic_namespace& tp_ns,
+  const topic_table::shared_topic_metadata_item& item) {
+    size_t total = sizeof(topic_metadata_item) + tp_ns.tp().size();
+    for (const auto& p_as : item.get_assignments()) {
+        total += sizeof(partition_assignment)
+                 + p_as.replicas.size() * sizeof(model::broker_shard);
+    }
+    for (const auto& [_, revisions] : item->replica_revisions) {
+        total += sizeof(replicas_revision_map)
+                 + revisions.size() * sizeof(replicas_revision_map::value_type);
+    }
+    return total;
+}
+
+void topic_table::update_memory_usage(const model::topic_namespace& tp_ns) {
+    if (auto it = _topics_memory.find(tp_ns); it != _topics_memory.end()) {
+        _metadata_memory -= it->second;
+        _topics_memory.erase(it);
+    }
+    if (auto it = _topics.find(tp_ns); it != _topics.end()) {
+        auto usage = estimate_memory_usage(tp_ns, it->second);
+        _topics_memory.emplace(tp_ns, usage);
+        _metadata_memory += usage;
+    }
+}
+
 ss::future<std::vector<topic_table::delta>>
 topic_table::wait_for_changes(ss::abort_source& as) {
     using ret_t = std::vector<topic_table::delta>;
     if (!_pending_deltas.empty()) {
         ret_t ret;
         ret.swap(_pending_deltas);
+        _pending_deltas_recorded = 0;
         return ss::make_ready_future<ret_t>(std::move(ret));
     }
     auto w = std::make_unique<waiter>(_waiter_id++);
@@ -700,14 +856,14 @@ size_t topic_table::all_topics_count() const { return _topics.size(); }
 std::optional<topic_metadata>
 topic_table::get_topic_metadata(model::topic_namespace_view tp) const {
     if (auto it = _topics.find(tp); it != _topics.end()) {
-        return it->second.metadata;
+        return it->second.get_metadata();
     }
     return {};
 }
 std::optional<std::reference_wrapper<const topic_metadata>>
 topic_table::get_topic_metadata_ref(model::topic_namespace_view tp) const {
     if (auto it = _topics.find(tp); it != _topics.end()) {
-        return it->second.metadata;
+        return it->second.get_metadata();
     }
     return {};
 }
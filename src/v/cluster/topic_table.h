@@ -20,23 +20,37 @@
 #include "model/metadata.h"
 #include "utils/expiring_promise.h"
 
+#include <seastar/core/sharded.hh>
+
 #include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
 #include <absl/container/node_hash_map.h>
 
+#include <memory>
+
 namespace cluster {
 
 /// Topic table represent all topics configuration and partition assignments.
-/// The topic table is copied on each core to minimize cross core communication
-/// when requesting topic information. The topics table provides an API for
-/// Kafka requests and delta API for controller backend. The delta API allows
-/// backend to wait for changes in topics table. Topics table is update directly
-/// from controller_stm. The table is always updated before any actions related
-/// with topic creation or deletion are executed. Topic table is also
-/// responsible for commiting or removing pending allocations
+/// The topic table is available on each core to minimize cross core
+/// communication when requesting topic information. The topics table provides
+/// an API for Kafka requests and delta API for controller backend. The delta
+/// API allows backend to wait for changes in topics table. Topics table is
+/// update directly from controller_stm. The table is always updated before any
+/// actions related with topic creation or deletion are executed. Topic table is
+/// also responsible for commiting or removing pending allocations
+///
+/// Controller commands are applied only by the instance on the owner shard,
+/// which then publishes the changes to the other shards (see \ref publish).
+/// Topic metadata is not copied when it is published, all shards share the
+/// same immutable items and the owner makes a copy of an item before
+/// modifying it (copy-on-write). Other shards never modify the items.
 ///
 
-class topic_table {
+class topic_table : public ss::peering_sharded_service<topic_table> {
 public:
+    /// Shard applying controller commands, same as the controller_stm shard
+    static constexpr ss::shard_id owner_shard{0};
+
     enum class in_progress_state {
         update_requested,
         cancel_requested,
@@ -91,11 +105,60 @@ public:
         }
     };
 
+    /**
+     * Topic metadata item shared between shards. Readers on all shards get
+     * the same instance, the owner shard replaces it with a modified copy
+     * when the item is already published.
+     */
+    class shared_topic_metadata_item {
+    public:
+        explicit shared_topic_metadata_item(topic_metadata_item item)
+          : _item(std::make_shared<topic_metadata_item>(std::move(item))) {}
+
+        const topic_metadata_item& operator*() const { return *_item; }
+        const topic_metadata_item* operator->() const { return _item.get(); }
+
+        const topic_metadata& get_metadata() const { return _item->metadata; }
+        bool is_topic_replicable() const {
+            return _item->is_topic_replicable();
+        }
+        const assignments_set& get_assignments() const {
+            return _item->get_assignments();
+        }
+        model::revision_id get_revision() const {
+            return _item->get_revision();
+        }
+        std::optional<model::initial_revision_id> get_remote_revision() const {
+            return _item->get_remote_revision();
+        }
+        const model::topic& get_source_topic() const {
+            return _item->get_source_topic();
+        }
+        const topic_configuration& get_configuration() const {
+            return _item->get_configuration();
+        }
+
+    private:
+        friend class topic_table;
+
+        /// Returns the item for modification, the item is copied first if it
+        /// is shared with other shards.
+        topic_metadata_item& mutate() {
+            if (_item.use_count() > 1) {
+                _item = std::make_shared<topic_metadata_item>(*_item);
+            }
+            return *_item;
+        }
+
+        // std::shared_ptr as the reference count is updated from many shards
+        std::shared_ptr<topic_metadata_item> _item;
+    };
+
     using delta = topic_table_delta;
 
     using underlying_t = absl::node_hash_map<
       model::topic_namespace,
-      topic_metadata_item,
+      shared_topic_metadata_item,
       model::topic_namespace_hash,
       model::topic_namespace_eq>;
     using hierarchy_t = absl::node_hash_map<
@@ -158,6 +221,15 @@ public:
       apply(cancel_moving_partition_replicas_cmd, model::offset);
     ss::future<> stop();
 
+    /// Publishes changes applied since the last call to the instances on
+    /// other shards. Called on the owner shard after each applied command.
+    ss::future<> publish();
+
+    /// Estimated memory used by the topic metadata, it is allocated once per
+    /// node since the metadata is shared between shards. Maintained on the
+    /// owner shard as changes are published.
+    size_t metadata_memory_usage() const { return _metadata_memory; }
+
     /// Delta API
     /// NOTE: This API should only be consumed by a single entity, unless
     /// careful consideration is taken. This is because once notifications are
@@ -278,6 +350,22 @@ public:
     std::vector<model::ntp> all_updates_in_progress() const;
 
 private:
+    /// Changes published by the owner shard, applied on other shards as is
+    struct published_update {
+        // nullopt if the topic was removed
+        std::vector<std::pair<
+          model::topic_namespace,
+          std::optional<shared_topic_metadata_item>>>
+          topics;
+        std::vector<std::pair<
+          model::topic_namespace,
+          std::optional<absl::flat_hash_set<model::topic_namespace>>>>
+          hierarchy;
+        std::vector<std::pair<model::ntp, std::optional<in_progress_update>>>
+          updates;
+        std::vector<delta> deltas;
+    };
+
     struct waiter {
         explicit waiter(uint64_t id)
           : id(id) {}
@@ -288,6 +376,14 @@ private:
     void deallocate_topic_partitions(const std::vector<partition_assignment>&);
 
     void notify_waiters();
+    void apply_published(published_update);
+
+    // record changes to be published to other shards
+    void mark_topic_dirty(const model::topic_namespace&);
+    void mark_hierarchy_dirty(const model::topic_namespace&);
+    void mark_update_dirty(const model::ntp&);
+    // refresh the memory usage estimate of a changed topic
+    void update_memory_usage(const model::topic_namespace&);
 
     template<typename Func>
     std::vector<std::invoke_result_t<Func, const topic_metadata_item&>>
@@ -306,6 +402,19 @@ private:
     uint64_t _waiter_id{0};
     model::offset _last_consumed_by_notifier{
       model::model_limits<model::offset>::min()};
+
+    // changes not yet published to other shards
+    absl::flat_hash_set<model::topic_namespace> _dirty_topics;
+    absl::flat_hash_set<model::topic_namespace> _dirty_hierarchy;
+    absl::flat_hash_set<model::ntp> _dirty_updates;
+    std::vector<delta> _unpublished_deltas;
+    // number of _pending_deltas already copied to _unpublished_deltas
+    size_t _pending_deltas_recorded{0};
+
+    // memory usage estimate by topic and in total, owner shard only
+    absl::flat_hash_map<model::topic_namespace, size_t> _topics_memory;
+    size_t _metadata_memory{0};
+
     topic_table_probe _probe;
 };
 
@@ -16,7 +16,49 @@
 namespace cluster {
 
 topic_table_probe::topic_table_probe(const topic_table& topic_table)
-  : _topic_table(topic_table) {}
+  : _topic_table(topic_table) {
+    setup_internal_metrics();
+}
+
+void topic_table_probe::setup_internal_metrics() {
+    // topic metadata is shared by all shards, it is reported only by the
+    // owner shard
+    if (
+      config::shard_local_cfg().disable_metrics()
+      || ss::this_shard_id() != topic_table::owner_shard) {
+        return;
+    }
+
+    namespace sm = ss::metrics;
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("cluster:topic_table"),
+      {
+        sm::make_gauge(
+          "topics",
+          [this] { return _topic_table.all_topics_count(); },
+          sm::description("Number of topics in the topic table")),
+        sm::make_gauge(
+          "metadata_memory_bytes",
+          [this] { return _topic_table.metadata_memory_usage(); },
+          sm::description(
+            "Estimated memory used by the topic metadata shared by all "
+            "shards")),
+        sm::make_counter(
+          "published_updates",
+          [this] { return _published_updates; },
+          sm::description(
+            "Number of topic table updates published to other shards")),
+        sm::make_counter(
+          "published_topics",
+          [this] { return _published_topics; },
+          sm::description(
+            "Number of topic metadata items published to other shards")),
+        sm::make_counter(
+          "published_deltas",
+          [this] { return _published_deltas; },
+          sm::description("Number of deltas published to other shards")),
+      });
+}
 
 void topic_table_probe::handle_topic_creation(
   create_topic_cmd::key_t topic_namespace) {
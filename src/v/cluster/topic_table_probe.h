@@ -23,11 +23,22 @@ public:
 
     void handle_topic_creation(create_topic_cmd::key_t);
     void handle_topic_deletion(const delete_topic_cmd::key_t&);
+    void handle_publish(size_t topics, size_t deltas) {
+        ++_published_updates;
+        _published_topics += topics;
+        _published_deltas += deltas;
+    }
 
 private:
+    void setup_internal_metrics();
+
     const topic_table& _topic_table;
     absl::flat_hash_map<model::topic_namespace, ss::metrics::metric_groups>
       _topics_metrics;
+    uint64_t _published_updates{0};
+    uint64_t _published_topics{0};
+    uint64_t _published_deltas{0};
+    ss::metrics::metric_groups _metrics;
 };
 
 } // namespace cluster
@@ -239,43 +239,17 @@ ss::future<> topic_updates_dispatcher::update_leaders_with_estimates(
       });
 }
 
-template<typename Cmd>
-ss::future<std::error_code> do_apply(
-  ss::shard_id shard,
-  Cmd cmd,
-  ss::sharded<topic_table>& table,
-  model::offset o) {
-    return table.invoke_on(
-      shard, [cmd = std::move(cmd), o](topic_table& local_table) mutable {
-          return local_table.apply(std::move(cmd), o);
-      });
-}
-
 template<typename Cmd>
 ss::future<std::error_code>
 topic_updates_dispatcher::dispatch_updates_to_cores(Cmd cmd, model::offset o) {
-    using ret_t = std::vector<std::error_code>;
-    return ss::do_with(
-      ret_t{}, [this, cmd = std::move(cmd), o](ret_t& ret) mutable {
-          ret.reserve(ss::smp::count);
-          return ss::parallel_for_each(
-                   boost::irange(0, (int)ss::smp::count),
-                   [this, &ret, cmd = std::move(cmd), o](int shard) mutable {
-                       return do_apply(shard, cmd, _topic_table, o)
-                         .then([&ret](std::error_code r) { ret.push_back(r); });
-                   })
-            .then([&ret] { return std::move(ret); })
-            .then([](std::vector<std::error_code> results) mutable {
-                auto ret = results.front();
-                for (auto& r : results) {
-                    vassert(
-                      ret == r,
-                      "State inconsistency across shards detected, expected "
-                      "result: {}, have: {}",
-                      ret,
-                      r);
-                }
-                return ret;
+    // the command is applied by the owner shard only, other shards receive
+    // the resulting state when it is published
+    return _topic_table.invoke_on(
+      topic_table::owner_shard,
+      [cmd = std::move(cmd), o](topic_table& table) mutable {
+          return table.apply(std::move(cmd), o)
+            .then([&table](std::error_code ec) {
+                return table.publish().then([ec] { return ec; });
             });
       });
 }
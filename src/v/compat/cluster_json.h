@@ -299,6 +299,10 @@ inline void rjson_serialize(
     rjson_serialize(w, f.revision_id);
     w.Key("size_bytes");
     rjson_serialize(w, f.size_bytes);
+    w.Key("bytes_rate");
+    rjson_serialize(w, f.bytes_rate);
+    w.Key("request_rate");
+    rjson_serialize(w, f.request_rate);
     w.EndObject();
 }
 
@@ -403,14 +407,25 @@ inline void read_value(json::Value const& rd, cluster::partition_status& obj) {
     std::optional<model::node_id> leader_id;
     model::revision_id revision_id;
     size_t size_bytes;
+    uint64_t bytes_rate;
+    uint64_t request_rate;
 
     read_member(rd, "id", id);
     read_member(rd, "term", term);
     read_member(rd, "leader_id", leader_id);
     read_member(rd, "revision_id", revision_id);
     read_member(rd, "size_bytes", size_bytes);
+    read_member(rd, "bytes_rate", bytes_rate);
+    read_member(rd, "request_rate", request_rate);
     obj = cluster::partition_status{
-      {}, id, term, leader_id, revision_id, size_bytes};
+      {},
+      id,
+      term,
+      leader_id,
+      revision_id,
+      size_bytes,
+      bytes_rate,
+      request_rate};
 }
 
 inline void read_value(json::Value const& rd, cluster::topic_status& obj) {
@@ -20,8 +20,14 @@ namespace compat {
 
 GEN_COMPAT_CHECK(
   cluster::get_node_health_request,
-  { json_write(filter); },
-  { json_read(filter); });
+  {
+      json_write(filter);
+      json_write(acked_version);
+  },
+  {
+      json_read(filter);
+      json_read(acked_version);
+  });
 
 template<>
 struct compat_check<cluster::get_node_health_reply> {
@@ -36,12 +42,18 @@ struct compat_check<cluster::get_node_health_reply> {
       json::Writer<json::StringBuffer>& wr) {
         json_write(error);
         json_write(report);
+        json_write(report_version);
+        json_write(base_version);
+        json_write(removed_partitions);
     }
 
     static cluster::get_node_health_reply from_json(json::Value& rd) {
         cluster::get_node_health_reply obj;
         json_read(error);
         json_read(report);
+        json_read(report_version);
+        json_read(base_version);
+        json_read(removed_partitions);
         return obj;
     }
 
@@ -57,12 +69,14 @@ struct compat_check<cluster::get_node_health_reply> {
           std::move(test));
 
         /*
-         * adl encoding doesn't consider the error so we need to ignore that and
-         * only consider the report. serde encodes both error and report.
+         * adl encoding doesn't consider the error so we need to ignore that.
+         * serde encodes all the fields.
          */
         vassert(name == "serde" || name == "adl", "unexpected name {}", name);
-        const auto equal = name == "serde" ? expected == decoded
-                                           : expected.report == decoded.report;
+        if (name == "adl") {
+            decoded.error = expected.error;
+        }
+        const auto equal = expected == decoded;
         if (!equal) {
             throw compat_error(fmt::format(
               "Verify of {{{}}} decoding failed:\nExpected: {}\nDecoded: {}",
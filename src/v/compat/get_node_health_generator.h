@@ -24,6 +24,8 @@ struct instance_generator<cluster::get_node_health_request> {
         return cluster::get_node_health_request{
           {},
           cluster::random_node_report_filter(),
+          tests::random_optional(
+            [] { return random_generators::get_int<uint64_t>(); }),
           random_generators::get_int<int8_t>()};
     }
     static std::vector<cluster::get_node_health_request> limits() { return {}; }
@@ -36,6 +38,11 @@ struct instance_generator<cluster::get_node_health_reply> {
           .error = instance_generator<cluster::errc>::random(),
           .report = tests::random_optional(
             [] { return cluster::random_node_health_report(); }),
+          .report_version = random_generators::get_int<uint64_t>(),
+          .base_version = tests::random_optional(
+            [] { return random_generators::get_int<uint64_t>(); }),
+          .removed_partitions = tests::random_vector(
+            [] { return model::random_ntp(); }),
         };
     }
     static std::vector<cluster::get_node_health_reply> limits() { return {}; }
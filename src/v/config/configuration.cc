@@ -157,6 +157,14 @@ configuration::configuration()
       "headers",
       {.needs_restart = needs_restart::no, .visibility = visibility::user},
       false)
+  , admin_api_max_concurrent_password_checks(
+      *this,
+      "admin_api_max_concurrent_password_checks",
+      "Maximum number of HTTP Basic authentication passwords validated "
+      "concurrently on each core. Validation derives the password with "
+      "PBKDF2, requests above the limit wait in a queue.",
+      {.visibility = visibility::tunable},
+      4)
   , seed_server_meta_topic_partitions(
       *this, "seed_server_meta_topic_partitions")
   , raft_heartbeat_interval_ms(
@@ -222,6 +230,13 @@ configuration::configuration()
       "Quota manager GC frequency in milliseconds",
       {.visibility = visibility::tunable},
       std::chrono::milliseconds(30000))
+  , quota_manager_balance_interval(
+      *this,
+      "quota_manager_balance_interval",
+      "How often the byte rate quota of each client is split between the "
+      "cores based on their recent usage",
+      {.visibility = visibility::tunable},
+      std::chrono::milliseconds(1000))
   , target_quota_byte_rate(
       *this,
       "target_quota_byte_rate",
@@ -231,6 +246,13 @@ configuration::configuration()
        .visibility = visibility::user},
       2_GiB,
       {.min = 1_MiB})
+  , kafka_quota_dimensions(
+      *this,
+      "kafka_quota_dimensions",
+      "Dimensions of the byte rate quota key, any of 'client_id' and 'user'. "
+      "An empty list shares a single quota between all clients",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      {"client_id"})
   , cluster_id(
       *this,
       "cluster_id",
@@ -356,7 +378,7 @@ configuration::configuration()
       *this,
       "fetch_reads_debounce_timeout",
       "Time to wait for next read in fetch request when requested min bytes "
-      "wasn't reached",
+      "wasn't reached and new records of the partitions can't be waited for",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       1ms)
   , alter_topic_cfg_timeout_ms(
@@ -650,6 +672,28 @@ configuration::configuration()
       "Key-value maximum segment size (bytes)",
       {.visibility = visibility::tunable},
       16_MiB)
+  , kvstore_flush_threshold(
+      *this,
+      "kvstore_flush_threshold",
+      "Number of pending key-value store operations which are flushed "
+      "without waiting for the flush interval, larger backlogs are flushed in "
+      "batches of this size",
+      {.visibility = visibility::tunable},
+      512)
+  , iobuf_fragment_pool_high_watermark(
+      *this,
+      "iobuf_fragment_pool_high_watermark",
+      "Bytes of released iobuf fragments each core keeps for reuse, 0 "
+      "disables the pool",
+      {.visibility = visibility::tunable},
+      0)
+  , iobuf_fragment_pool_low_watermark(
+      *this,
+      "iobuf_fragment_pool_low_watermark",
+      "Bytes of released iobuf fragments each core keeps for reuse under "
+      "memory pressure",
+      {.visibility = visibility::tunable},
+      0)
   , max_kafka_throttle_delay_ms(
       *this,
       "max_kafka_throttle_delay_ms",
@@ -663,6 +707,22 @@ configuration::configuration()
       "bytes limits is higher",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       64_MiB)
+  , kafka_out_of_order_execution(
+      *this,
+      "kafka_out_of_order_execution",
+      "Execute read-only requests (e.g. fetch and metadata) in the background "
+      "so that the connection reads the next request right away. Responses "
+      "are still sent in request order",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      true)
+  , kafka_out_of_order_max_requests(
+      *this,
+      "kafka_out_of_order_max_requests",
+      "Maximum number of read-only requests of a connection executing out of "
+      "order at once. The connection doesn't read further requests until one "
+      "of them completes.",
+      {.visibility = visibility::tunable},
+      4)
   , raft_io_timeout_ms(
       *this,
       "raft_io_timeout_ms",
@@ -1047,6 +1107,42 @@ configuration::configuration()
       "Manifest upload timeout (ms)",
       {.visibility = visibility::tunable},
       10s)
+  , cloud_storage_multipart_upload_threshold(
+      *this,
+      "cloud_storage_multipart_upload_threshold",
+      "Segments larger than this are uploaded using S3 multipart upload. "
+      "Zero disables multipart uploads",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      128_MiB)
+  , cloud_storage_multipart_upload_part_size(
+      *this,
+      "cloud_storage_multipart_upload_part_size",
+      "Size of the individual part of the multipart upload. S3 requires "
+      "every part except the last one to be at least 5MiB",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      16_MiB)
+  , cloud_storage_multipart_upload_concurrency(
+      *this,
+      "cloud_storage_multipart_upload_concurrency",
+      "Max number of parts of a single segment uploaded in parallel",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      4)
+  , cloud_storage_max_concurrent_uploads(
+      *this,
+      "cloud_storage_max_concurrent_uploads",
+      "Max number of segment uploads running in parallel on the node. The "
+      "limit is split evenly between shards. If not set, every shard can run "
+      "as many uploads as it has connections to S3",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      std::nullopt)
+  , cloud_storage_upload_bandwidth_limit(
+      *this,
+      "cloud_storage_upload_bandwidth_limit",
+      "Max rate of the archival uploads on the node (bytes per second). The "
+      "limit is split evenly between shards. If not set, the upload rate is "
+      "not limited",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      std::nullopt)
   , cloud_storage_max_connection_idle_time_ms(
       *this,
       "cloud_storage_max_connection_idle_time_ms",
@@ -1115,6 +1211,22 @@ configuration::configuration()
       "Timeout to check if cache eviction should be triggered",
       {.visibility = visibility::tunable},
       30s)
+  , cloud_storage_hydration_chunk_size(
+      *this,
+      "cloud_storage_hydration_chunk_size",
+      "Size of the byte ranges in which remote segments are hydrated. The "
+      "segment index uploaded alongside the segment is used to locate the "
+      "chunk containing the requested offset, segments without the index are "
+      "hydrated as a whole. Zero hydrates whole segments",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
+  , cloud_storage_hydration_prefetch_chunks(
+      *this,
+      "cloud_storage_hydration_prefetch_chunks",
+      "Number of chunks hydrated ahead of a sequential reader when chunked "
+      "hydration is enabled",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      1)
   , superusers(
       *this,
       "superusers",
@@ -1181,6 +1293,13 @@ configuration::configuration()
       "Update frequency for kafka queue depth control.",
       {.visibility = visibility::tunable},
       7s)
+  , kafka_sasl_max_concurrent_authentications(
+      *this,
+      "kafka_sasl_max_concurrent_authentications",
+      "Maximum number of SASL authentication steps processed concurrently "
+      "on each core. Handshakes above the limit wait in a queue.",
+      {.visibility = visibility::tunable},
+      16)
   , zstd_decompress_workspace_bytes(
       *this,
       "zstd_decompress_workspace_bytes",
@@ -1241,6 +1360,16 @@ configuration::configuration()
       "batch",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       5_GiB)
+  , partition_autobalancing_throughput_skew_percent(
+      *this,
+      "partition_autobalancing_throughput_skew_percent",
+      "If set, autobalancer moves partitions away from the nodes which "
+      "per-core produce and fetch throughput exceeds the cluster average by "
+      "more than this percentage. New partitions are also placed on the least "
+      "loaded nodes and cores.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      std::nullopt,
+      {.min = 5})
 
   , enable_leader_balancer(
       *this,
@@ -1273,6 +1402,20 @@ configuration::configuration()
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       512,
       {.min = 1, .max = 2048})
+  , leader_balancer_mode(
+      *this,
+      "leader_balancer_mode",
+      "Leadership rebalancing strategy: greedy_balanced_shards balances the "
+      "number of leaders per shard, throughput_balanced_shards balances the "
+      "recent produce and fetch load of the leaders per shard",
+      {.needs_restart = needs_restart::no,
+       .example = "throughput_balanced_shards",
+       .visibility = visibility::user},
+      model::leader_balancer_mode::greedy_balanced_shards,
+      {
+        model::leader_balancer_mode::greedy_balanced_shards,
+        model::leader_balancer_mode::throughput_balanced_shards,
+      })
   , internal_topic_replication_factor(
       *this,
       "internal_topic_replication_factor",
@@ -1298,6 +1441,13 @@ configuration::configuration()
       "Max age of metadata cached in the health monitor of non controller node",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       10s)
+  , health_monitor_full_report_interval(
+      *this,
+      "health_monitor_full_report_interval",
+      "Max time between full node health reports, in between nodes send only "
+      "partitions which status changed since the last report",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      5min)
   , storage_space_alert_free_threshold_percent(
       *this,
       "storage_space_alert_free_threshold_percent",
@@ -63,6 +63,7 @@ struct configuration final : public config_store {
 
     // Admin API
     property<bool> admin_api_require_auth;
+    property<size_t> admin_api_max_concurrent_password_checks;
 
     // Raft
     deprecated_property seed_server_meta_topic_partitions;
@@ -79,7 +80,9 @@ struct configuration final : public config_store {
     bounded_property<int16_t> default_num_windows;
     bounded_property<std::chrono::milliseconds> default_window_sec;
     property<std::chrono::milliseconds> quota_manager_gc_sec;
+    property<std::chrono::milliseconds> quota_manager_balance_interval;
     bounded_property<uint32_t> target_quota_byte_rate;
+    property<std::vector<ss::sstring>> kafka_quota_dimensions;
     property<std::optional<ss::sstring>> cluster_id;
     property<bool> disable_metrics;
     property<bool> disable_public_metrics;
@@ -151,8 +154,13 @@ struct configuration final : public config_store {
     property<bool> enable_pid_file;
     property<std::chrono::milliseconds> kvstore_flush_interval;
     property<size_t> kvstore_max_segment_size;
+    property<size_t> kvstore_flush_threshold;
+    property<size_t> iobuf_fragment_pool_high_watermark;
+    property<size_t> iobuf_fragment_pool_low_watermark;
     property<std::chrono::milliseconds> max_kafka_throttle_delay_ms;
     property<size_t> kafka_max_bytes_per_fetch;
+    property<bool> kafka_out_of_order_execution;
+    property<size_t> kafka_out_of_order_max_requests;
     property<std::chrono::milliseconds> raft_io_timeout_ms;
     property<std::chrono::milliseconds> join_retry_timeout_ms;
     property<std::chrono::milliseconds> raft_timeout_now_timeout_ms;
@@ -218,6 +226,11 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> cloud_storage_segment_upload_timeout_ms;
     property<std::chrono::milliseconds>
       cloud_storage_manifest_upload_timeout_ms;
+    property<size_t> cloud_storage_multipart_upload_threshold;
+    property<size_t> cloud_storage_multipart_upload_part_size;
+    property<size_t> cloud_storage_multipart_upload_concurrency;
+    property<std::optional<size_t>> cloud_storage_max_concurrent_uploads;
+    property<std::optional<size_t>> cloud_storage_upload_bandwidth_limit;
     property<std::chrono::milliseconds>
       cloud_storage_max_connection_idle_time_ms;
     property<std::optional<std::chrono::seconds>>
@@ -237,6 +250,8 @@ struct configuration final : public config_store {
     // Archival cache
     property<size_t> cloud_storage_cache_size;
     property<std::chrono::milliseconds> cloud_storage_cache_check_interval_ms;
+    property<size_t> cloud_storage_hydration_chunk_size;
+    property<size_t> cloud_storage_hydration_prefetch_chunks;
 
     one_or_many_property<ss::sstring> superusers;
 
@@ -253,6 +268,7 @@ struct configuration final : public config_store {
     property<size_t> kafka_qdc_min_depth;
     property<size_t> kafka_qdc_max_depth;
     property<std::chrono::milliseconds> kafka_qdc_depth_update_ms;
+    property<size_t> kafka_sasl_max_concurrent_authentications;
     property<size_t> zstd_decompress_workspace_bytes;
     one_or_many_property<ss::sstring> full_raft_configuration_recovery_pattern;
     property<bool> enable_auto_rebalance_on_node_add;
@@ -265,18 +281,22 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds>
       partition_autobalancing_tick_interval_ms;
     property<size_t> partition_autobalancing_movement_batch_size_bytes;
+    bounded_property<std::optional<unsigned>>
+      partition_autobalancing_throughput_skew_percent;
 
     property<bool> enable_leader_balancer;
     property<std::chrono::milliseconds> leader_balancer_idle_timeout;
     property<std::chrono::milliseconds> leader_balancer_mute_timeout;
     property<std::chrono::milliseconds> leader_balancer_node_mute_timeout;
     bounded_property<size_t> leader_balancer_transfer_limit_per_shard;
+    enum_property<model::leader_balancer_mode> leader_balancer_mode;
     property<int> internal_topic_replication_factor;
     property<std::chrono::milliseconds> health_manager_tick_interval;
 
     // health monitor
     property<std::chrono::milliseconds> health_monitor_tick_interval;
     property<std::chrono::milliseconds> health_monitor_max_metadata_age;
+    property<std::chrono::milliseconds> health_monitor_full_report_interval;
     bounded_property<unsigned> storage_space_alert_free_threshold_percent;
     bounded_property<size_t> storage_space_alert_free_threshold_bytes;
     bounded_property<size_t> storage_min_free_bytes;
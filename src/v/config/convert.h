@@ -314,4 +314,23 @@ struct convert<model::partition_autobalancing_mode> {
     }
 };
 
+template<>
+struct convert<model::leader_balancer_mode> {
+    using type = model::leader_balancer_mode;
+    static Node encode(const type& rhs) { return Node(fmt::format("{}", rhs)); }
+    static bool decode(const Node& node, type& rhs) {
+        auto value = node.as<std::string>();
+
+        if (value == "greedy_balanced_shards") {
+            rhs = model::leader_balancer_mode::greedy_balanced_shards;
+        } else if (value == "throughput_balanced_shards") {
+            rhs = model::leader_balancer_mode::throughput_balanced_shards;
+        } else {
+            return false;
+        }
+
+        return true;
+    }
+};
+
 } // namespace YAML
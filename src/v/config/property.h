@@ -421,6 +421,8 @@ consteval std::string_view property_type_name() {
                            type,
                            model::partition_autobalancing_mode>) {
         return "partition_autobalancing_mode";
+    } else if constexpr (std::is_same_v<type, model::leader_balancer_mode>) {
+        return "leader_balancer_mode";
     } else if constexpr (std::is_floating_point_v<type>) {
         return "number";
     } else if constexpr (std::is_integral_v<type>) {
@@ -156,4 +156,9 @@ void rjson_serialize(
     stringize(w, v);
 }
 
+void rjson_serialize(
+  json::Writer<json::StringBuffer>& w, const model::leader_balancer_mode& v) {
+    stringize(w, v);
+}
+
 } // namespace json
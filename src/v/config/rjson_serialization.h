@@ -72,4 +72,7 @@ void rjson_serialize(
   json::Writer<json::StringBuffer>& w,
   const model::partition_autobalancing_mode& v);
 
+void rjson_serialize(
+  json::Writer<json::StringBuffer>& w, const model::leader_balancer_mode& v);
+
 } // namespace json
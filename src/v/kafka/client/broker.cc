@@ -19,10 +19,28 @@
 
 namespace kafka::client {
 
+static bool use_local_transport(
+  model::node_id node_id,
+  const configuration& config,
+  const kafka::local_dispatcher* local) {
+    // Neither SASL credentials nor a TLS client certificate can be carried
+    // in-process, such clients must authenticate over TCP so that requests
+    // are authorized as their own principal rather than the anonymous one.
+    return local != nullptr && config.in_process_dispatch()
+           && config.sasl_mechanism().empty()
+           && !config.broker_tls().is_enabled() && node_id == local->node_id();
+}
+
 ss::future<shared_broker_t> make_broker(
   model::node_id node_id,
   net::unresolved_address addr,
-  const configuration& config) {
+  const configuration& config,
+  kafka::local_dispatcher* local) {
+    if (use_local_transport(node_id, config, local)) {
+        vlog(kclog.info, "using in-process dispatch to broker:{}", node_id);
+        return ss::make_ready_future<shared_broker_t>(
+          ss::make_lw_shared<broker>(node_id, local_transport(*local)));
+    }
     return cluster::maybe_build_reloadable_certificate_credentials(
              config.broker_tls())
       .then([addr](ss::shared_ptr<ss::tls::certificate_credentials> creds) {
@@ -13,6 +13,7 @@
 
 #include "kafka/client/configuration.h"
 #include "kafka/client/exceptions.h"
+#include "kafka/client/local_transport.h"
 #include "kafka/client/logger.h"
 #include "kafka/client/transport.h"
 #include "model/metadata.h"
@@ -23,6 +24,8 @@
 
 #include <absl/container/flat_hash_set.h>
 
+#include <variant>
+
 namespace kafka::client {
 
 struct gated_mutex {
@@ -55,16 +58,27 @@ public:
       , _client(std::move(client))
       , _gated_mutex{} {}
 
+    broker(model::node_id node_id, local_transport&& client)
+      : _node_id(node_id)
+      , _client(std::move(client))
+      , _gated_mutex{} {}
+
     template<typename T, typename Ret = typename T::api_type::response_type>
     requires(KafkaApi<typename T::api_type>) ss::future<Ret> dispatch(T r) {
         using api_t = typename T::api_type;
         return _gated_mutex
           .with([this, r{std::move(r)}]() mutable {
               vlog(kclog.debug, "Dispatch: {} req: {}", api_t::name, r);
-              return _client.dispatch(std::move(r)).then([](Ret res) {
-                  vlog(kclog.debug, "Dispatch: {} res: {}", api_t::name, res);
-                  return res;
-              });
+              return std::visit(
+                       [&r](auto& client) {
+                           return client.dispatch(std::move(r));
+                       },
+                       _client)
+                .then([](Ret res) {
+                    vlog(
+                      kclog.debug, "Dispatch: {} res: {}", api_t::name, res);
+                    return res;
+                });
           })
           .handle_exception_type(
             [this](const kafka_request_disconnected_exception&) {
@@ -76,25 +90,37 @@ public:
     }
 
     model::node_id id() const { return _node_id; }
+    bool is_local() const {
+        return std::holds_alternative<local_transport>(_client);
+    }
     ss::future<> stop() {
         return _gated_mutex.close()
-          .then([this]() { return _client.stop(); })
+          .then([this]() {
+              return std::visit(
+                [](auto& client) { return client.stop(); }, _client);
+          })
           .finally([b = shared_from_this()]() {});
     }
 
 private:
     model::node_id _node_id;
-    transport _client;
+    std::variant<transport, local_transport> _client;
     // TODO(Ben): allow overlapped requests
     gated_mutex _gated_mutex;
 };
 
 using shared_broker_t = ss::lw_shared_ptr<broker>;
 
+/// \brief Create a broker connected to addr.
+///
+/// If a local dispatcher is given, in-process dispatch is enabled and node_id
+/// names the broker running in this process, the broker is served in-process
+/// and addr is not connected to.
 ss::future<shared_broker_t> make_broker(
   model::node_id node_id,
   net::unresolved_address addr,
-  const configuration& config);
+  const configuration& config,
+  kafka::local_dispatcher* local = nullptr);
 
 struct broker_hash {
     using is_transparent = void;
@@ -60,12 +60,20 @@ public:
     /// \brief Returns true if there are no connected brokers
     ss::future<bool> empty() const;
 
+    /// \brief Serve the broker running in this process through dispatcher.
+    void set_local_dispatcher(kafka::local_dispatcher* dispatcher) {
+        _local = dispatcher;
+    }
+    kafka::local_dispatcher* local() const { return _local; }
+
 private:
     const configuration& _config;
     /// \brief Brokers map a model::node_id to a client.
     brokers_t _brokers;
     /// \brief Next broker to select with round-robin
     size_t _next_broker{0};
+    /// \brief In-process dispatch to the local broker, if available.
+    kafka::local_dispatcher* _local{nullptr};
 };
 
 } // namespace kafka::client
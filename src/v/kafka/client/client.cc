@@ -22,6 +22,7 @@
 #include "kafka/protocol/find_coordinator.h"
 #include "kafka/protocol/leave_group.h"
 #include "kafka/protocol/list_offsets.h"
+#include "kafka/server/local_dispatcher.h"
 #include "kafka/types.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
@@ -40,6 +41,7 @@
 
 #include <absl/container/node_hash_map.h>
 
+#include <algorithm>
 #include <cstdlib>
 #include <exception>
 
@@ -57,9 +59,25 @@ client::client(const YAML::Node& cfg)
                   return mitigate_error(std::move(ex));
               }} {}
 
+void client::set_local_dispatcher(kafka::local_dispatcher* dispatcher) {
+    const auto& seeds = _config.brokers();
+    if (std::any_of(
+          seeds.begin(), seeds.end(), [dispatcher](const auto& addr) {
+              return dispatcher->is_local_address(addr);
+          })) {
+        _brokers.set_local_dispatcher(dispatcher);
+    }
+}
+
 ss::future<> client::do_connect(net::unresolved_address addr) {
     return ss::try_with_gate(_gate, [this, addr]() {
-        return make_broker(unknown_node_id, addr, _config)
+        // bootstrap through the local broker when it is served in-process,
+        // there's no need for its listener to be reachable.
+        auto* local = _brokers.local();
+        auto node_id = local && _config.in_process_dispatch()
+                         ? local->node_id()
+                         : unknown_node_id;
+        return make_broker(node_id, addr, _config, local)
           .then([this](shared_broker_t broker) {
               return broker->dispatch(metadata_request{.list_all_topics = true})
                 .then([this, broker](metadata_response res) {
@@ -161,6 +161,13 @@ public:
 
     configuration& config() { return _config; }
 
+    /// \brief Dispatch requests for the local broker in-process.
+    ///
+    /// Must be called before connect(). Ignored unless the configured brokers
+    /// include a listener of the local broker. Disabled by the
+    /// in_process_dispatch configuration property, in which case TCP is used.
+    void set_local_dispatcher(kafka::local_dispatcher* dispatcher);
+
 private:
     /// \brief Connect and update metdata.
     ss::future<> do_connect(net::unresolved_address addr);
@@ -107,6 +107,14 @@ configuration::configuration()
       "scram_password",
       "Password to use for SCRAM authentication mechanisms",
       {.secret = config::is_secret::yes},
-      "") {}
+      "")
+  , in_process_dispatch(
+      *this,
+      "in_process_dispatch",
+      "Dispatch requests for the broker running in the same process directly "
+      "to its request handlers instead of connecting over TCP. Ignored when "
+      "broker_tls or a sasl_mechanism is configured",
+      {},
+      true) {}
 
 } // namespace kafka::client
@@ -0,0 +1,65 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "kafka/client/transport.h"
+#include "kafka/protocol/response_writer.h"
+#include "kafka/server/local_dispatcher.h"
+#include "seastarx.h"
+
+#include <seastar/core/future.hh>
+
+namespace kafka::client {
+
+/**
+ * \brief In-process counterpart of \ref transport.
+ *
+ * Requests are handed to the kafka request handlers of the broker running in
+ * this process through a kafka::local_dispatcher, skipping the loopback
+ * socket, size framing and request/response headers.
+ */
+class local_transport {
+public:
+    explicit local_transport(kafka::local_dispatcher& dispatcher)
+      : _dispatcher(&dispatcher) {}
+
+    template<typename T>
+    requires(KafkaApi<typename T::api_type>)
+      ss::future<typename T::api_type::response_type> dispatch(T r) {
+        using response_type = typename T::api_type::response_type;
+        const auto version = client_request_version<T>();
+
+        iobuf buf;
+        response_writer wr(buf);
+        r.encode(wr, version);
+
+        return _dispatcher->dispatch(T::api_type::key, version, std::move(buf))
+          .then([version](iobuf buf) {
+              response_type r;
+              r.decode(std::move(buf), version);
+              return r;
+          })
+          .handle_exception_type(
+            [](const kafka::local_dispatch_unavailable& e) {
+                // surfaces as broker_not_available, which the client retries
+                return ss::make_exception_future<response_type>(
+                  kafka_request_disconnected_exception(e.what()));
+            });
+    }
+
+    ss::future<> stop() { return ss::now(); }
+
+private:
+    kafka::local_dispatcher* _dispatcher;
+};
+
+} // namespace kafka::client
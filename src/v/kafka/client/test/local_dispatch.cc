@@ -0,0 +1,63 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/client/client.h"
+#include "kafka/client/configuration.h"
+#include "kafka/client/test/fixture.h"
+#include "kafka/client/test/utils.h"
+#include "kafka/protocol/errors.h"
+#include "kafka/protocol/metadata.h"
+#include "kafka/protocol/produce.h"
+#include "kafka/server/local_dispatcher.h"
+#include "model/fundamental.h"
+#include "units.h"
+
+#include <seastar/util/defer.hh>
+
+#include <chrono>
+
+namespace kc = kafka::client;
+
+FIXTURE_TEST(local_dispatch_produce_fetch, kafka_client_fixture) {
+    using namespace std::chrono_literals;
+
+    info("Waiting for leadership");
+    wait_for_controller_leadership().get();
+
+    auto tp = model::topic_partition(model::topic("t"), model::partition_id(0));
+    auto ntp = make_default_ntp(tp.topic, tp.partition);
+    add_topic(model::topic_namespace_view(ntp)).get();
+
+    auto client = make_client();
+    client.config().retry_base_backoff.set_value(10ms);
+    client.config().produce_batch_delay.set_value(0ms);
+    client.set_local_dispatcher(&app.kafka_local_dispatcher.local());
+
+    info("Connecting client in-process");
+    client.connect().get();
+    auto stop_client = ss::defer([&client]() { client.stop().get(); });
+
+    info("Client.dispatch metadata");
+    auto res = client.dispatch(make_list_topics_req()).get();
+    BOOST_REQUIRE_EQUAL(res.data.topics.size(), 1);
+    BOOST_REQUIRE_EQUAL(res.data.topics[0].name(), "t");
+
+    info("Producing in-process");
+    auto bat = make_batch(model::offset(0), 2);
+    auto p_res = client.produce_record_batch(tp, std::move(bat)).get();
+    BOOST_REQUIRE_EQUAL(p_res.error_code, kafka::error_code::none);
+    BOOST_REQUIRE_EQUAL(p_res.base_offset, model::offset(0));
+
+    info("Fetching in-process");
+    auto f_res = client.fetch_partition(tp, model::offset(0), 1_MiB, 1s).get();
+    BOOST_REQUIRE_EQUAL(f_res.data.error_code, kafka::error_code::none);
+    BOOST_REQUIRE_EQUAL(f_res.data.topics.size(), 1);
+    BOOST_REQUIRE_EQUAL(f_res.data.topics[0].partitions.size(), 1);
+    BOOST_REQUIRE(f_res.data.topics[0].partitions[0].records.has_value());
+}
@@ -33,6 +33,62 @@ public:
       : std::runtime_error(msg) {}
 };
 
+namespace detail {
+template<typename T>
+struct dependent_false : std::false_type {};
+} // namespace detail
+
+/*
+ * The version at which a request type is sent, the max supported level of the
+ * redpanda kafka server.
+ *
+ * TODO: this will go away once the kafka client implements version
+ * negotiation and can track on a per-broker basis the supported version
+ * range.
+ */
+template<typename T>
+requires(KafkaApi<typename T::api_type>)
+api_version client_request_version() {
+    using type = std::remove_reference_t<std::decay_t<T>>;
+    if constexpr (std::is_same_v<type, offset_fetch_request>) {
+        return api_version(4);
+    } else if constexpr (std::is_same_v<type, fetch_request>) {
+        return api_version(10);
+    } else if constexpr (std::is_same_v<type, list_offsets_request>) {
+        return api_version(3);
+    } else if constexpr (std::is_same_v<type, produce_request>) {
+        return api_version(7);
+    } else if constexpr (std::is_same_v<type, offset_commit_request>) {
+        return api_version(7);
+    } else if constexpr (std::is_same_v<type, describe_groups_request>) {
+        return api_version(2);
+    } else if constexpr (std::is_same_v<type, heartbeat_request>) {
+        return api_version(3);
+    } else if constexpr (std::is_same_v<type, join_group_request>) {
+        return api_version(4);
+    } else if constexpr (std::is_same_v<type, sync_group_request>) {
+        return api_version(3);
+    } else if constexpr (std::is_same_v<type, leave_group_request>) {
+        return api_version(2);
+    } else if constexpr (std::is_same_v<type, metadata_request>) {
+        return api_version(7);
+    } else if constexpr (std::is_same_v<type, find_coordinator_request>) {
+        return api_version(2);
+    } else if constexpr (std::is_same_v<type, list_groups_request>) {
+        return api_version(2);
+    } else if constexpr (std::is_same_v<type, create_topics_request>) {
+        return api_version(4);
+    } else if constexpr (std::is_same_v<type, sasl_handshake_request>) {
+        return api_version(1);
+    } else if constexpr (std::is_same_v<type, sasl_authenticate_request>) {
+        return api_version(1);
+    } else {
+        static_assert(
+          detail::dependent_false<type>::value,
+          "No client version for request type");
+    }
+}
+
 /**
  * \brief Kafka client.
  *
@@ -157,48 +213,11 @@ public:
     /*
      * Invokes dispatch with the given request type at the max supported level
      * of the redpanda kafka server.
-     *
-     * TODO: this will go away once the kafka client implements version
-     * negotiation and can track on a per-broker basis the supported version
-     * range.
      */
     template<typename T>
     requires(KafkaApi<typename T::api_type>)
       ss::future<typename T::api_type::response_type> dispatch(T r) {
-        using type = std::remove_reference_t<std::decay_t<T>>;
-        if constexpr (std::is_same_v<type, offset_fetch_request>) {
-            return dispatch(std::move(r), api_version(4));
-        } else if constexpr (std::is_same_v<type, fetch_request>) {
-            return dispatch(std::move(r), api_version(10));
-        } else if constexpr (std::is_same_v<type, list_offsets_request>) {
-            return dispatch(std::move(r), api_version(3));
-        } else if constexpr (std::is_same_v<type, produce_request>) {
-            return dispatch(std::move(r), api_version(7));
-        } else if constexpr (std::is_same_v<type, offset_commit_request>) {
-            return dispatch(std::move(r), api_version(7));
-        } else if constexpr (std::is_same_v<type, describe_groups_request>) {
-            return dispatch(std::move(r), api_version(2));
-        } else if constexpr (std::is_same_v<type, heartbeat_request>) {
-            return dispatch(std::move(r), api_version(3));
-        } else if constexpr (std::is_same_v<type, join_group_request>) {
-            return dispatch(std::move(r), api_version(4));
-        } else if constexpr (std::is_same_v<type, sync_group_request>) {
-            return dispatch(std::move(r), api_version(3));
-        } else if constexpr (std::is_same_v<type, leave_group_request>) {
-            return dispatch(std::move(r), api_version(2));
-        } else if constexpr (std::is_same_v<type, metadata_request>) {
-            return dispatch(std::move(r), api_version(7));
-        } else if constexpr (std::is_same_v<type, find_coordinator_request>) {
-            return dispatch(std::move(r), api_version(2));
-        } else if constexpr (std::is_same_v<type, list_groups_request>) {
-            return dispatch(std::move(r), api_version(2));
-        } else if constexpr (std::is_same_v<type, create_topics_request>) {
-            return dispatch(std::move(r), api_version(4));
-        } else if constexpr (std::is_same_v<type, sasl_handshake_request>) {
-            return dispatch(std::move(r), api_version(1));
-        } else if constexpr (std::is_same_v<type, sasl_authenticate_request>) {
-            return dispatch(std::move(r), api_version(1));
-        }
+        return dispatch(std::move(r), client_request_version<T>());
     }
 
 private:
@@ -45,6 +45,31 @@ public:
              sm::description("Produce Latency"),
              labels,
              [this] { return _produce_latency.seastar_histogram_logform(); })
+             .aggregate(aggregate_labels),
+           sm::make_histogram(
+             "sasl_authenticate_latency_us",
+             sm::description(
+               "SASL authentication step latency, including the time spent "
+               "waiting for the concurrency limit"),
+             labels,
+             [this] {
+                 return _sasl_authenticate_latency.seastar_histogram_logform();
+             })
+             .aggregate(aggregate_labels),
+           sm::make_histogram(
+             "response_hol_wait_us",
+             sm::description(
+               "Time a ready response waits for the responses of earlier "
+               "requests on the same connection to be sent"),
+             labels,
+             [this] { return _response_hol_wait.seastar_histogram_logform(); })
+             .aggregate(aggregate_labels),
+           sm::make_counter(
+             "out_of_order_requests",
+             [this] { return _out_of_order_requests; },
+             sm::description(
+               "Number of requests executed concurrently with the requests "
+               "following them on the same connection"))
              .aggregate(aggregate_labels)});
     }
 
@@ -80,13 +105,28 @@ public:
     std::unique_ptr<hdr_hist::measurement> auto_produce_measurement() {
         return _produce_latency.auto_measure();
     }
+    void record_produce_latency(std::chrono::microseconds d) {
+        _produce_latency.record(d.count());
+    }
     std::unique_ptr<hdr_hist::measurement> auto_fetch_measurement() {
         return _fetch_latency.auto_measure();
     }
+    std::unique_ptr<hdr_hist::measurement>
+    auto_sasl_authenticate_measurement() {
+        return _sasl_authenticate_latency.auto_measure();
+    }
+    std::unique_ptr<hdr_hist::measurement> auto_response_hol_measurement() {
+        return _response_hol_wait.auto_measure();
+    }
+
+    void request_out_of_order() { ++_out_of_order_requests; }
 
 private:
     hdr_hist _produce_latency;
     hdr_hist _fetch_latency;
+    hdr_hist _sasl_authenticate_latency;
+    hdr_hist _response_hol_wait;
+    uint64_t _out_of_order_requests{0};
     ss::metrics::metric_groups _metrics;
     ss::metrics::metric_groups _public_metrics{
       ssx::metrics::public_metrics_handle};
@@ -188,8 +188,17 @@ ss::future<session_resources> connection_context::throttle_request(
     // distinguish throttling delays from real delays. delays
     // applied to subsequent messages allow backpressure to take
     // affect.
-    auto delay = _proto.quota_mgr().record_tp_and_throttle(
-      hdr.client_id, request_size);
+    auto& quota_mgr = _proto.quota_mgr();
+    std::string_view user;
+    if (quota_mgr.keyed_by_user()) {
+        if (_mtls_state) {
+            user = _mtls_state->principal();
+        } else if (_sasl && _sasl->complete()) {
+            user = _sasl->principal();
+        }
+    }
+    auto delay = quota_mgr.record_tp_and_throttle(
+      hdr.client_id, user, request_size);
     auto tracker = std::make_unique<request_tracker>(_rs.probe());
     auto fut = ss::now();
     if (!delay.first_violation) {
@@ -220,9 +229,64 @@ ss::future<session_resources> connection_context::throttle_request(
                 }
                 return r;
             });
+      })
+      .then([this, key = hdr.key](session_resources r) mutable {
+          return reserve_out_of_order_units(key).then(
+            [r = std::move(r)](
+              std::optional<ssx::semaphore_units> units) mutable {
+                r.out_of_order_units = std::move(units);
+                return std::move(r);
+            });
+      });
+}
+
+ss::future<std::optional<ssx::semaphore_units>>
+connection_context::reserve_out_of_order_units(api_key key) {
+    /*
+     * nothing is reordered until the authentication completed, the requests
+     * of the sasl flow depend on each other.
+     */
+    if (
+      !config::shard_local_cfg().kafka_out_of_order_execution()
+      || !can_execute_out_of_order(key) || (_sasl && !_sasl->complete())) {
+        return ss::make_ready_future<std::optional<ssx::semaphore_units>>(
+          std::nullopt);
+    }
+    return ss::get_units(_out_of_order, 1)
+      .then([](ssx::semaphore_units units) {
+          return std::make_optional(std::move(units));
       });
 }
 
+namespace {
+/*
+ * Complete the dispatch stage of a request executing out of order right away
+ * and move the rest of its execution into the response stage. The units are
+ * released once the execution completed.
+ */
+process_result_stages
+execute_out_of_order(process_result_stages stages, ssx::semaphore_units units) {
+    auto response = std::move(stages.dispatched)
+                      .then_wrapped(
+                        [f = std::move(stages.response)](
+                          ss::future<> d) mutable {
+                            if (!d.failed()) {
+                                return std::move(f);
+                            }
+                            // the response stage must be consumed
+                            return f.then_wrapped(
+                              [d = std::move(d)](
+                                ss::future<response_ptr> r) mutable {
+                                  r.ignore_ready_future();
+                                  return ss::make_exception_future<
+                                    response_ptr>(d.get_exception());
+                              });
+                        })
+                      .finally([units = std::move(units)] {});
+    return process_result_stages(ss::now(), std::move(response));
+}
+} // namespace
+
 ss::future<ssx::semaphore_units>
 connection_context::reserve_request_units(api_key key, size_t size) {
     // Defer to the handler for the request type for the memory estimate, but
@@ -289,6 +353,10 @@ connection_context::dispatch_method_once(request_header hdr, size_t size) {
                * behavior easier to understand and avoids misbehaving clients
                * creating server-side errors that will appear as a corrupted
                * stream at best and at worst some odd behavior.
+               *
+               * once authenticated, read-only requests are only dispatched in
+               * order and then execute out of order in the background, see
+               * reserve_out_of_order_units.
                */
 
               const auto correlation = rctx.header().correlation;
@@ -296,6 +364,12 @@ connection_context::dispatch_method_once(request_header hdr, size_t size) {
               _seq_idx = _seq_idx + sequence_id(1);
               auto res = kafka::process_request(
                 std::move(rctx), _proto.smp_group(), *sres);
+              if (sres->out_of_order_units) {
+                  _proto.probe().request_out_of_order();
+                  res = execute_out_of_order(
+                    std::move(res), std::move(*sres->out_of_order_units));
+                  sres->out_of_order_units.reset();
+              }
               /**
                * first stage processed in a foreground.
                */
@@ -346,7 +420,10 @@ connection_context::dispatch_method_once(request_header hdr, size_t size) {
                                  correlation](response_ptr r) mutable {
                                     r->set_correlation(correlation);
                                     response_and_resources randr{
-                                      std::move(r), std::move(sres)};
+                                      std::move(r),
+                                      std::move(sres),
+                                      _proto.probe()
+                                        .auto_response_hol_measurement()};
                                     _responses.insert({seq, std::move(randr)});
                                     return maybe_process_responses();
                                 });
@@ -416,6 +493,7 @@ ss::future<> connection_context::maybe_process_responses() {
         auto resp_and_res = std::move(it->second);
 
         _responses.erase(it);
+        resp_and_res.hol_wait.reset();
 
         if (resp_and_res.response->is_noop()) {
             return ss::make_ready_future<ss::stop_iteration>(
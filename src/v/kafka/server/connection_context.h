@@ -9,6 +9,7 @@
  * by the Apache License, Version 2.0
  */
 #pragma once
+#include "config/configuration.h"
 #include "kafka/server/protocol.h"
 #include "kafka/server/response.h"
 #include "kafka/types.h"
@@ -78,6 +79,9 @@ struct session_resources {
     ssx::semaphore_units queue_units;
     std::unique_ptr<hdr_hist::measurement> method_latency;
     std::unique_ptr<request_tracker> tracker;
+    // held while a request is executed out of order, see
+    // connection_context::reserve_out_of_order_units
+    std::optional<ssx::semaphore_units> out_of_order_units;
 };
 
 class connection_context final
@@ -91,6 +95,9 @@ public:
       std::optional<security::tls::mtls_state> mtls_state) noexcept
       : _proto(p)
       , _rs(std::move(r))
+      , _out_of_order(
+          config::shard_local_cfg().kafka_out_of_order_max_requests(),
+          "k/out-of-order")
       , _sasl(std::move(sasl))
       // tests may build a context without a live connection
       , _client_addr(_rs.conn ? _rs.conn->addr.addr() : ss::net::inet_address{})
@@ -98,6 +105,20 @@ public:
       , _authlog(_client_addr, client_port())
       , _mtls_state(std::move(mtls_state)) {}
 
+    /// In-process connection used by the local dispatcher. There is no socket
+    /// behind it: requests are handed over already parsed and responses are
+    /// returned to the caller rather than written out.
+    connection_context(
+      protocol& p, ss::sstring listener, bool enable_authorizer) noexcept
+      : connection_context(
+        p,
+        net::server::resources(nullptr, nullptr),
+        std::nullopt,
+        enable_authorizer,
+        std::nullopt) {
+        _local_listener = std::move(listener);
+    }
+
     ~connection_context() noexcept = default;
     connection_context(const connection_context&) = delete;
     connection_context(connection_context&&) = delete;
@@ -105,7 +126,9 @@ public:
     connection_context& operator=(connection_context&&) = delete;
 
     protocol& server() { return _proto; }
-    const ss::sstring& listener() const { return _rs.conn->name(); }
+    const ss::sstring& listener() const {
+        return _rs.conn ? _rs.conn->name() : _local_listener;
+    }
     std::optional<security::sasl_server>& sasl() { return _sasl; }
 
     template<typename T>
@@ -210,6 +233,17 @@ private:
     ss::future<session_resources>
     throttle_request(const request_header&, size_t sz);
 
+    // Requests which can execute out of order (see can_execute_out_of_order)
+    // run in the background, and the connection moves on to the next request
+    // as soon as they are dispatched. Up to kafka_out_of_order_max_requests
+    // of them execute at once, a further one waits for one of them to
+    // complete. Requests executing in order, such as produce, don't wait for
+    // them: only the responses are sent in request order.
+    //
+    // Returns std::nullopt when the request must execute in order.
+    ss::future<std::optional<ssx::semaphore_units>>
+    reserve_out_of_order_units(api_key key);
+
     ss::future<> dispatch_method_once(request_header, size_t sz);
 
     /**
@@ -236,6 +270,8 @@ private:
     struct response_and_resources {
         response_ptr response;
         session_resources::pointer resources;
+        // time spent waiting for the responses of earlier requests
+        std::unique_ptr<hdr_hist::measurement> hol_wait;
     };
 
     using sequence_id = named_type<uint64_t, struct kafka_protocol_sequence>;
@@ -296,11 +332,13 @@ private:
     sequence_id _next_response;
     sequence_id _seq_idx;
     map_t _responses;
+    ssx::semaphore _out_of_order;
     std::optional<security::sasl_server> _sasl;
     const ss::net::inet_address _client_addr;
     const bool _enable_authorizer;
     ctx_log _authlog;
     std::optional<security::tls::mtls_state> _mtls_state;
+    ss::sstring _local_listener;
 };
 
 } // namespace kafka
@@ -19,6 +19,8 @@ class coordinator_ntp_mapper;
 class fetch_session_cache;
 class group_manager;
 class group_router;
+class local_dispatcher;
+class metadata_response_cache;
 class quota_manager;
 class request_context;
 class rm_group_frontend;
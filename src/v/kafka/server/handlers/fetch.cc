@@ -10,6 +10,7 @@
 #include "kafka/server/handlers/fetch.h"
 
 #include "cluster/metadata_cache.h"
+#include "cluster/partition.h"
 #include "cluster/partition_manager.h"
 #include "cluster/shard_table.h"
 #include "config/configuration.h"
@@ -30,9 +31,12 @@
 #include "model/timeout_clock.h"
 #include "random/generators.h"
 #include "resource_mgmt/io_priority.h"
+#include "ssx/future-util.h"
 #include "storage/parser_utils.h"
 #include "utils/to_string.h"
 
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/coroutine.hh>
 #include <seastar/core/do_with.hh>
 #include <seastar/core/future.hh>
 #include <seastar/core/sleep.hh>
@@ -495,6 +499,193 @@ class simple_fetch_planner final : public fetch_planner::impl {
     }
 };
 
+/**
+ * Resolves with the result of the first future to complete. The remaining
+ * futures complete in the background and their results are dropped.
+ */
+template<typename T>
+static ss::future<T> first_of(std::vector<ss::future<T>> futures) {
+    vassert(!futures.empty(), "no futures to wait for");
+    auto pr = ss::make_lw_shared<std::optional<ss::promise<T>>>(
+      ss::promise<T>());
+    auto ret = (*pr)->get_future();
+    for (auto& f : futures) {
+        ssx::background = std::move(f).then_wrapped(
+          [pr](ss::future<T> r) mutable {
+              if (!*pr) {
+                  r.ignore_ready_future();
+                  return;
+              }
+              r.forward_to(std::move(**pr));
+              pr->reset();
+          });
+    }
+    return ret;
+}
+
+struct visible_offset_wait {
+    model::ntp ntp;
+    // kafka offset of the first record to wait for
+    model::offset offset;
+};
+
+/**
+ * Wait on the home core of the partitions until a record at or past the given
+ * offset becomes visible in any of them, the deadline expires or `as` is
+ * aborted. `as` is only used on this core.
+ *
+ * Returns true without waiting if one of the partitions isn't found or
+ * already has such a record, the caller then falls back to re-reading the
+ * partitions after the debounce timeout.
+ */
+static ss::future<bool> wait_for_visible_offsets(
+  cluster::partition_manager& mgr,
+  std::vector<visible_offset_wait> waits,
+  model::timeout_clock::time_point deadline,
+  ss::abort_source& as) {
+    std::vector<ss::lw_shared_ptr<cluster::partition>> partitions;
+    std::vector<model::offset> log_offsets;
+    partitions.reserve(waits.size());
+    log_offsets.reserve(waits.size());
+    for (const auto& w : waits) {
+        auto partition = mgr.get(w.ntp);
+        if (!partition) {
+            co_return true;
+        }
+        // the monitor is notified of log offsets, which include the batches
+        // filtered out of the kafka offsets
+        auto translator = partition->get_offset_translator_state();
+        auto high_watermark = translator->from_log_offset(
+          partition->high_watermark());
+        if (high_watermark > w.offset) {
+            co_return true;
+        }
+        log_offsets.push_back(translator->to_log_offset(w.offset));
+        partitions.push_back(std::move(partition));
+    }
+
+    std::vector<ss::future<>> appends;
+    appends.reserve(partitions.size());
+    for (size_t i = 0; i < partitions.size(); ++i) {
+        appends.push_back(partitions[i]->raft()->visible_offset_monitor().wait(
+          log_offsets[i], deadline, as));
+    }
+    try {
+        co_await first_of(std::move(appends));
+    } catch (const raft::offset_monitor::wait_aborted&) {
+        // the deadline expired, the partition is shutting down or another
+        // core woke up first
+    }
+    // remove the waiters of the other partitions
+    if (!as.abort_requested()) {
+        as.request_abort();
+    }
+    co_return false;
+}
+
+/**
+ * Wait for new records in the partitions of the fetch before reading them
+ * again, instead of polling all of them every debounce timeout. Idle long
+ * polling consumers then only cost a waiter per partition, and consumers are
+ * woken up as soon as a record becomes visible.
+ *
+ * A partition is woken up by records past the high watermark seen by the
+ * previous read, or past the fetch offset if it wasn't read.
+ */
+static ss::future<> wait_for_appends(op_context& octx) {
+    std::vector<std::vector<visible_offset_wait>> waits(ss::smp::count);
+    auto resp_it = octx.response_begin();
+    octx.for_each_fetch_partition(
+      [&resp_it, &octx, &waits](const fetch_session_partition& fp) {
+          auto& resp = *resp_it;
+          ++resp_it;
+          if (resp.has_error()) {
+              return;
+          }
+          auto ntp = model::ntp(model::kafka_namespace, fp.topic, fp.partition);
+          auto shard = octx.rctx.shards().shard_for(ntp);
+          if (!shard) {
+              return;
+          }
+          waits[*shard].push_back(visible_offset_wait{
+            .ntp = std::move(ntp),
+            .offset = std::max(fp.fetch_offset, resp.high_watermark()),
+          });
+      });
+
+    /*
+     * the first core to wake up cancels the waiters on the other cores
+     * through their abort source. each abort source lives here but is only
+     * used on its core. the state is shared with the continuations of the
+     * waiters so that it outlives them whatever happens to this coroutine.
+     */
+    struct wait_state {
+        std::vector<ss::shard_id> shards;
+        std::vector<std::unique_ptr<ss::abort_source>> aborts;
+        std::optional<bool> first_woken;
+        ss::promise<> woken;
+    };
+    auto state = ss::make_lw_shared<wait_state>();
+    std::vector<ss::future<>> waiting;
+    for (ss::shard_id shard = 0; shard < waits.size(); ++shard) {
+        if (waits[shard].empty()) {
+            continue;
+        }
+        state->shards.push_back(shard);
+        auto& as = *state->aborts.emplace_back(
+          std::make_unique<ss::abort_source>());
+        waiting.push_back(
+          octx.rctx.partition_manager()
+            .invoke_on(
+              shard,
+              octx.ssg,
+              [waits = std::move(waits[shard]),
+               deadline = octx.deadline.value_or(model::no_timeout),
+               &as](cluster::partition_manager& mgr) mutable {
+                  return wait_for_visible_offsets(
+                    mgr, std::move(waits), deadline, as);
+              })
+            .handle_exception([](const std::exception_ptr& e) {
+                vlog(klog.debug, "Error waiting for fetch appends: {}", e);
+                return true;
+            })
+            .then([state](bool debounce) {
+                if (!state->first_woken) {
+                    state->first_woken = debounce;
+                    state->woken.set_value();
+                }
+            }));
+    }
+
+    bool debounce = true;
+    if (!waiting.empty()) {
+        co_await state->woken.get_future();
+        debounce = *state->first_woken;
+        co_await ss::parallel_for_each(
+          boost::irange<size_t>(0, state->shards.size()),
+          [&state = *state, &octx](size_t i) {
+              return ss::smp::submit_to(
+                state.shards[i], octx.ssg, [&as = *state.aborts[i]] {
+                    if (!as.abort_requested()) {
+                        as.request_abort();
+                    }
+                });
+          })
+          .handle_exception([](const std::exception_ptr& e) {
+              // the remaining waiters then complete at the deadline
+              vlog(klog.debug, "Error cancelling fetch append waiters: {}", e);
+          });
+        // the waiters can't fail, none of them is left running in the
+        // background
+        co_await ss::when_all_succeed(waiting.begin(), waiting.end());
+    }
+    if (debounce) {
+        co_await ss::sleep(std::min(
+          config::shard_local_cfg().fetch_reads_debounce_timeout(),
+          octx.request.data.max_wait_ms));
+    }
+}
+
 /**
  * Process partition fetch requests.
  *
@@ -533,10 +724,7 @@ static ss::future<> fetch_topic_partitions(op_context& octx) {
     }
 
     octx.reset_context();
-    // debounce next read retry
-    co_await ss::sleep(std::min(
-      config::shard_local_cfg().fetch_reads_debounce_timeout(),
-      octx.request.data.max_wait_ms));
+    co_await wait_for_appends(octx);
 }
 
 template<>
@@ -38,6 +38,9 @@ struct op_context {
         bool has_error() {
             return _it->partition_response->error_code != error_code::none;
         }
+        model::offset high_watermark() {
+            return _it->partition_response->high_watermark;
+        }
         void move_to_end() {
             _ctx->iteration_order.erase(
               _ctx->iteration_order.iterator_to(*this));
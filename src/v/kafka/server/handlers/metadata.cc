@@ -14,12 +14,14 @@
 #include "cluster/types.h"
 #include "config/configuration.h"
 #include "config/node_config.h"
+#include "kafka/protocol/response_writer.h"
 #include "kafka/protocol/schemata/metadata_response.h"
 #include "kafka/server/errors.h"
 #include "kafka/server/fwd.h"
 #include "kafka/server/handlers/details/leader_epoch.h"
 #include "kafka/server/handlers/details/security.h"
 #include "kafka/server/handlers/topics/topic_utils.h"
+#include "kafka/server/metadata_response_cache.h"
 #include "kafka/server/response.h"
 #include "kafka/types.h"
 #include "likely.h"
@@ -69,13 +71,20 @@ static constexpr model::node_id no_leader(-1);
  *
  * With those heuristics we will always force the client to communicate with the
  * nodes that may not be partitioned.
+ *
+ * When provided, leader_known is cleared if the current leader is unknown and
+ * the returned leader comes from the heuristics above.
  */
 std::optional<cluster::leader_term> get_leader_term(
   model::topic_namespace_view tp_ns,
   model::partition_id p_id,
   const cluster::metadata_cache& md_cache,
-  const std::vector<model::node_id>& replicas) {
+  const std::vector<model::node_id>& replicas,
+  bool* leader_known = nullptr) {
     auto leader_term = md_cache.get_leader_term(tp_ns, p_id);
+    if (leader_known && (!leader_term || !leader_term->leader.has_value())) {
+        *leader_known = false;
+    }
     if (!leader_term) {
         return std::nullopt;
     }
@@ -99,20 +108,27 @@ bool is_internal(const model::topic_namespace& tp_ns) {
 
 } // namespace
 
+/**
+ * Build the topic of the metadata response. When provided, all_leaders_known
+ * is cleared if the leader of any of the topic partitions is unknown.
+ */
 metadata_response::topic make_topic_response_from_topic_metadata(
-  const cluster::metadata_cache& md_cache, cluster::topic_metadata&& tp_md) {
+  const cluster::metadata_cache& md_cache,
+  const cluster::topic_metadata& tp_md,
+  bool* all_leaders_known = nullptr) {
     metadata_response::topic tp;
     tp.error_code = error_code::none;
-    auto tp_ns = tp_md.get_configuration().tp_ns;
-    tp.name = std::move(tp_md.get_configuration().tp_ns.tp);
+    const auto& tp_ns = tp_md.get_configuration().tp_ns;
+    tp.name = tp_ns.tp;
 
     tp.is_internal = is_internal(tp_ns);
+    tp.partitions.reserve(tp_md.get_assignments().size());
     std::transform(
       tp_md.get_assignments().begin(),
       tp_md.get_assignments().end(),
       std::back_inserter(tp.partitions),
-      [tp_ns = std::move(tp_ns),
-       &md_cache](cluster::partition_assignment& p_md) {
+      [&tp_ns, &md_cache, all_leaders_known](
+        const cluster::partition_assignment& p_md) {
           std::vector<model::node_id> replicas{};
           replicas.reserve(p_md.replicas.size());
           std::transform(
@@ -124,7 +140,8 @@ metadata_response::topic make_topic_response_from_topic_metadata(
           p.error_code = error_code::none;
           p.partition_index = p_md.id;
           p.leader_id = no_leader;
-          auto lt = get_leader_term(tp_ns, p_md.id, md_cache, replicas);
+          auto lt = get_leader_term(
+            tp_ns, p_md.id, md_cache, replicas, all_leaders_known);
           if (lt) {
               p.leader_id = lt->leader.value_or(no_leader);
               p.leader_epoch = leader_epoch_from_term(lt->term);
@@ -175,7 +192,7 @@ create_topic(request_context& ctx, model::topic&& topic) {
                    tout + model::timeout_clock::now())
             .then([&ctx, tp_md = std::move(tp_md)]() mutable {
                 return make_topic_response_from_topic_metadata(
-                  ctx.metadata_cache(), std::move(tp_md.value()));
+                  ctx.metadata_cache(), tp_md.value());
             });
       })
       .handle_exception([topic = std::move(topic)](
@@ -193,7 +210,9 @@ make_error_topic_response(model::topic tp, error_code ec) {
 }
 
 static metadata_response::topic make_topic_response(
-  request_context& ctx, metadata_request& rq, cluster::topic_metadata md) {
+  request_context& ctx,
+  metadata_request& rq,
+  const cluster::topic_metadata& md) {
     int32_t auth_operations = 0;
     /**
      * if requested include topic authorized operations
@@ -204,15 +223,100 @@ static metadata_response::topic make_topic_response(
     }
 
     auto res = make_topic_response_from_topic_metadata(
-      ctx.metadata_cache(), std::move(md));
+      ctx.metadata_cache(), md);
     res.topic_authorized_operations = auth_operations;
     return res;
 }
 
-static ss::future<std::vector<metadata_response::topic>>
-get_topic_metadata(request_context& ctx, metadata_request& request) {
-    std::vector<metadata_response::topic> res;
+namespace {
+/**
+ * Topics of the metadata response. For the versions supported by the metadata
+ * response cache the topics are encoded as they are added and the existing
+ * topics are served from the cache.
+ */
+class response_topics {
+public:
+    response_topics(request_context& ctx, metadata_request& rq)
+      : _ctx(ctx)
+      , _rq(rq)
+      , _version(ctx.header().version)
+      , _encode(metadata_response_cache::is_cacheable(_version)) {}
+
+    bool is_encoded() const { return _encode; }
+
+    void add(metadata_response::topic t) {
+        if (!_encode) {
+            _topics.push_back(std::move(t));
+            return;
+        }
+        iobuf buf;
+        response_writer writer(buf);
+        encode_metadata_response_topic(writer, t, _version);
+        _encoded.push_back(std::move(buf));
+    }
+
+    void add(
+      const model::topic_namespace& tp_ns, const cluster::topic_metadata& md) {
+        if (!_encode) {
+            add(make_topic_response(_ctx, _rq, md));
+            return;
+        }
+        auto& cache = _ctx.get_metadata_response_cache();
+        if (auto cached = cache.get(tp_ns, _version); cached) {
+            _encoded.push_back(std::move(*cached));
+            return;
+        }
+        bool all_leaders_known = true;
+        auto t = make_topic_response_from_topic_metadata(
+          _ctx.metadata_cache(), md, &all_leaders_known);
+        iobuf buf;
+        response_writer writer(buf);
+        encode_metadata_response_topic(writer, t, _version);
+        if (all_leaders_known) {
+            cache.put(tp_ns, _version, buf);
+        }
+        _encoded.push_back(std::move(buf));
+    }
+
+    std::vector<metadata_response::topic> release() && {
+        return std::move(_topics);
+    }
+    std::vector<iobuf> release_encoded() && { return std::move(_encoded); }
+
+private:
+    request_context& _ctx;
+    metadata_request& _rq;
+    api_version _version;
+    bool _encode;
+    std::vector<metadata_response::topic> _topics;
+    std::vector<iobuf> _encoded;
+};
+
+/**
+ * Metadata response with the topics already encoded
+ */
+struct encoded_metadata_response {
+    using api_type = metadata_api;
 
+    metadata_response_data data;
+    std::vector<iobuf> topics;
+
+    void encode(response_writer& writer, api_version version) {
+        encode_metadata_response(writer, data, std::move(topics), version);
+    }
+
+    friend std::ostream&
+    operator<<(std::ostream& os, const encoded_metadata_response& r) {
+        fmt::print(
+          os, "{{data: {}, encoded topics: {}}}", r.data, r.topics.size());
+        return os;
+    }
+};
+
+} // namespace
+
+static ss::future<> get_topic_metadata(
+  request_context& ctx, metadata_request& request, response_topics& res) {
     // request can be served from whatever happens to be in the cache
     if (request.list_all_topics) {
         auto& topics_md = ctx.metadata_cache().all_topics_metadata();
@@ -232,11 +336,10 @@ get_topic_metadata(request_context& ctx, metadata_request& request) {
                   authz_quiet{true})) {
                 continue;
             }
-            res.push_back(make_topic_response(ctx, request, md.metadata));
+            res.add(tp_ns, md.get_metadata());
         }
 
-        return ss::make_ready_future<std::vector<metadata_response::topic>>(
-          std::move(res));
+        return ss::now();
     }
 
     std::vector<ss::future<metadata_response::topic>> new_topics;
@@ -247,24 +350,21 @@ get_topic_metadata(request_context& ctx, metadata_request& request) {
          */
         if (!ctx.authorized(security::acl_operation::describe, topic.name)) {
             // not authorized, return authorization error
-            res.push_back(make_error_topic_response(
+            res.add(make_error_topic_response(
               std::move(topic.name), error_code::topic_authorization_failed));
             continue;
         }
-        if (auto md = ctx.metadata_cache().get_topic_metadata(
+        if (auto md = ctx.metadata_cache().get_topic_metadata_ref(
               model::topic_namespace_view(model::kafka_namespace, topic.name));
             md) {
-            auto src_topic_response = make_topic_response(
-              ctx, request, std::move(*md));
-            src_topic_response.name = std::move(topic.name);
-            res.push_back(std::move(src_topic_response));
+            res.add(md->get().get_configuration().tp_ns, md->get());
             continue;
         }
 
         if (
           !config::shard_local_cfg().auto_create_topics_enabled
           || !request.data.allow_auto_topic_creation) {
-            res.push_back(make_error_topic_response(
+            res.add(make_error_topic_response(
               std::move(topic.name), error_code::unknown_topic_or_partition));
             continue;
         }
@@ -272,7 +372,7 @@ get_topic_metadata(request_context& ctx, metadata_request& request) {
          * check if authorized to create
          */
         if (!ctx.authorized(security::acl_operation::create, topic.name)) {
-            res.push_back(make_error_topic_response(
+            res.add(make_error_topic_response(
               std::move(topic.name), error_code::topic_authorization_failed));
             continue;
         }
@@ -280,10 +380,10 @@ get_topic_metadata(request_context& ctx, metadata_request& request) {
     }
 
     return ss::when_all_succeed(new_topics.begin(), new_topics.end())
-      .then([res = std::move(res)](
-              std::vector<metadata_response::topic> topics) mutable {
-          res.insert(res.end(), topics.begin(), topics.end());
-          return res;
+      .then([&res](std::vector<metadata_response::topic> topics) {
+          for (auto& t : topics) {
+              res.add(std::move(t));
+          }
       });
 }
 
@@ -412,7 +512,8 @@ ss::future<response_ptr> metadata_handler::handle(
     metadata_request request;
     request.decode(ctx.reader(), ctx.header().version);
 
-    reply.data.topics = co_await get_topic_metadata(ctx, request);
+    response_topics topics(ctx, request);
+    co_await get_topic_metadata(ctx, request, topics);
 
     if (
       request.data.include_cluster_authorized_operations
@@ -422,6 +523,12 @@ ss::future<response_ptr> metadata_handler::handle(
           details::authorized_operations(ctx, security::default_cluster_name));
     }
 
+    if (topics.is_encoded()) {
+        co_return co_await ctx.respond(encoded_metadata_response{
+          .data = std::move(reply.data),
+          .topics = std::move(topics).release_encoded()});
+    }
+    reply.data.topics = std::move(topics).release();
     co_return co_await ctx.respond(std::move(reply));
 }
 
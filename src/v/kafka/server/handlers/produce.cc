@@ -95,9 +95,9 @@ struct partition_produce_stages {
     ss::future<produce_response::partition> produced;
 };
 
-struct topic_produce_stages {
+struct produce_stages {
     ss::future<> dispatched;
-    ss::future<produce_response::topic> produced;
+    ss::future<> produced;
 };
 
 partition_produce_stages make_ready_stage(produce_response::partition p) {
@@ -210,29 +210,246 @@ static partition_produce_stages partition_append(
     };
 }
 
-ss::future<produce_response::partition> finalize_request_with_error_code(
-  error_code ec,
+/**
+ * Single partition write, prepared on the shard handling the request and
+ * replicated on the shard owning the partition.
+ */
+struct partition_produce {
+    model::ntp ntp;
+    model::record_batch_reader reader;
+    model::batch_identity bid;
+    int32_t num_records;
+    int64_t batch_size;
+};
+
+/**
+ * Partition writes of a request owned by a single shard. They are sent to the
+ * shard in one message and the results are placed back into the response
+ * placeholders.
+ */
+struct shard_produce {
+    void push_back(
+      partition_produce req,
+      produce_response::partition* resp,
+      std::chrono::steady_clock::time_point start) {
+        requests.push_back(std::move(req));
+        responses.push_back(resp);
+        started.push_back(start);
+    }
+
+    bool empty() const { return requests.empty(); }
+
+    std::vector<partition_produce> requests;
+    std::vector<produce_response::partition*> responses;
+    std::vector<std::chrono::steady_clock::time_point> started;
+};
+
+/**
+ * Result of a partition write together with the time it completed on the
+ * shard owning the partition, so that the latency of every partition is
+ * accounted independently of the other writes sent in the same batch.
+ */
+struct partition_produce_result {
+    produce_response::partition response;
+    std::chrono::steady_clock::time_point completed;
+};
+
+/**
+ * Produce plan, the partition writes of the request grouped by the shard
+ * owning the partition. Like the fetch plan it allows to dispatch a single
+ * cross core task per shard instead of one per partition.
+ */
+struct produce_plan {
+    explicit produce_plan(size_t shards)
+      : produces_per_shard(shards) {}
+
+    std::vector<shard_produce> produces_per_shard;
+};
+
+/**
+ * \brief handle writing to a single topic partition on its home shard.
+ */
+static partition_produce_stages produce_topic_partition(
+  cluster::partition_manager& mgr, partition_produce& req, int16_t acks) {
+    auto error_stage = [&req](error_code ec) {
+        return make_ready_stage(produce_response::partition{
+          .partition_index = req.ntp.tp.partition, .error_code = ec});
+    };
+
+    auto partition = mgr.get(req.ntp);
+    if (!partition) {
+        return error_stage(error_code::unknown_topic_or_partition);
+    }
+    if (unlikely(!partition->is_leader())) {
+        return error_stage(error_code::not_leader_for_partition);
+    }
+    if (partition->is_read_replica_mode_enabled()) {
+        return error_stage(error_code::invalid_topic_exception);
+    }
+    try {
+        return partition_append(
+          req.ntp.tp.partition,
+          ss::make_lw_shared<replicated_partition>(std::move(partition)),
+          req.bid,
+          std::move(req.reader),
+          acks,
+          req.num_records,
+          req.batch_size);
+    } catch (...) {
+        return partition_produce_stages{
+          .dispatched = ss::current_exception_as_future(),
+          .produced = ss::make_ready_future<produce_response::partition>(
+            produce_response::partition{
+              .partition_index = req.ntp.tp.partition,
+              .error_code = error_code::request_timed_out}),
+        };
+    }
+}
+
+/**
+ * Writes all of the partitions of a shard, runs on the shard owning them. The
+ * dispatch promise is resolved on the source shard with a single message once
+ * every write is enqueued.
+ */
+static ss::future<std::vector<partition_produce_result>>
+produce_shard_partitions(
+  cluster::partition_manager& mgr,
+  std::vector<partition_produce> requests,
+  int16_t acks,
   std::unique_ptr<ss::promise<>> dispatch,
-  model::ntp ntp,
   ss::shard_id source_shard) {
-    // submit back to promise source shard
-    ssx::background = ss::smp::submit_to(
-      source_shard, [dispatch = std::move(dispatch)]() mutable {
-          dispatch->set_value();
-          dispatch.reset();
+    std::vector<ss::future<>> dispatched;
+    std::vector<ss::future<partition_produce_result>> produced;
+    dispatched.reserve(requests.size());
+    produced.reserve(requests.size());
+
+    for (auto& req : requests) {
+        auto stages = produce_topic_partition(mgr, req, acks);
+        dispatched.push_back(std::move(stages.dispatched));
+        produced.push_back(std::move(stages.produced)
+                             .then([](produce_response::partition p) {
+                                 return partition_produce_result{
+                                   .response = std::move(p),
+                                   .completed
+                                   = std::chrono::steady_clock::now()};
+                             }));
+    }
+
+    return ss::when_all_succeed(dispatched.begin(), dispatched.end())
+      .then_wrapped(
+        [source_shard, dispatch = std::move(dispatch)](ss::future<> f) mutable {
+            std::exception_ptr e;
+            if (f.failed()) {
+                e = f.get_exception();
+            }
+            ssx::background = ss::smp::submit_to(
+              source_shard, [dispatch = std::move(dispatch), e]() mutable {
+                  if (e) {
+                      dispatch->set_exception(e);
+                  } else {
+                      dispatch->set_value();
+                  }
+                  dispatch.reset();
+              });
+        })
+      .then([produced = std::move(produced)]() mutable {
+          return ss::when_all_succeed(produced.begin(), produced.end());
       });
-    return ss::make_ready_future<produce_response::partition>(
-      produce_response::partition{
-        .partition_index = ntp.tp.partition, .error_code = ec});
 }
 
 /**
- * \brief handle writing to a single topic partition.
+ * \brief Dispatch the partition writes of a shard and fill their responses
  */
-static partition_produce_stages produce_topic_partition(
+static produce_stages
+produce_on_shard(produce_ctx& octx, ss::shard_id shard, shard_produce produce) {
+    auto dispatch = std::make_unique<ss::promise<>>();
+    auto dispatch_f = dispatch->get_future();
+    auto f
+      = octx.rctx.partition_manager()
+          .invoke_on(
+            shard,
+            octx.ssg,
+            [requests = std::move(produce.requests),
+             dispatch = std::move(dispatch),
+             acks = octx.request.data.acks,
+             source_shard = ss::this_shard_id()](
+              cluster::partition_manager& mgr) mutable {
+                return produce_shard_partitions(
+                  mgr,
+                  std::move(requests),
+                  acks,
+                  std::move(dispatch),
+                  source_shard);
+            })
+          .then([&octx,
+                 responses = std::move(produce.responses),
+                 started = std::move(produce.started)](
+                  std::vector<partition_produce_result> results) {
+              for (size_t i = 0; i < results.size(); ++i) {
+                  auto& r = results[i];
+                  if (r.response.error_code == error_code::none) {
+                      auto dur = r.completed - started[i];
+                      octx.rctx.connection()->server().update_produce_latency(
+                        dur);
+                      octx.rctx.probe().record_produce_latency(
+                        std::chrono::duration_cast<std::chrono::microseconds>(
+                          dur));
+                  }
+                  *responses[i] = std::move(r.response);
+              }
+          });
+    return produce_stages{
+      .dispatched = std::move(dispatch_f),
+      .produced = std::move(f),
+    };
+}
+
+/**
+ * \brief Validate the partition write and add it to the plan. Returns the
+ * error of the partition if it is rejected before being dispatched.
+ */
+static error_code plan_topic_partition(
   produce_ctx& octx,
+  produce_plan& plan,
   produce_request::topic& topic,
-  produce_request::partition& part) {
+  produce_request::partition& part,
+  produce_response::partition* resp) {
+    if (!octx.rctx.authorized(security::acl_operation::write, topic.name)) {
+        return error_code::topic_authorization_failed;
+    }
+
+    if (!octx.rctx.metadata_cache().contains(
+          model::topic_namespace_view(model::kafka_namespace, topic.name),
+          part.partition_index)) {
+        return error_code::unknown_topic_or_partition;
+    }
+
+    // the record data on the wire was null value
+    if (unlikely(!part.records)) {
+        return error_code::invalid_record;
+    }
+
+    // an error occured handling legacy messages (magic 0 or 1)
+    if (unlikely(part.records->adapter.legacy_error)) {
+        return error_code::invalid_record;
+    }
+
+    if (unlikely(!part.records->adapter.valid_crc)) {
+        return error_code::corrupt_message;
+    }
+
+    // produce version >= 3 (enforced for all produce requests)
+    // requires exactly one record batch per request and it must use
+    // the v2 format.
+    //
+    // NOTE: for produce version 0 and 1 the adapter transparently converts
+    // the batch into an v2 batch and sets the v2_format flag. conversion
+    // also produces a single record batch by accumulating legacy messages.
+    if (unlikely(
+          !part.records->adapter.v2_format || !part.records->adapter.batch)) {
+        return error_code::invalid_record;
+    }
+
     auto ntp = model::ntp(
       model::kafka_namespace, topic.name, part.partition_index);
 
@@ -241,11 +458,8 @@ static partition_produce_stages produce_topic_partition(
      * different partitions that are managed different cores.
      */
     auto shard = octx.rctx.shards().shard_for(ntp);
-
     if (!shard) {
-        return make_ready_stage(produce_response::partition{
-          .partition_index = ntp.tp.partition,
-          .error_code = error_code::unknown_topic_or_partition});
+        return error_code::unknown_topic_or_partition;
     }
 
     // steal the batch from the adapter
@@ -271,215 +485,70 @@ static partition_produce_stages produce_topic_partition(
     auto bid = model::batch_identity::from(hdr);
     auto batch_size = batch.size_bytes();
     auto num_records = batch.record_count();
-    auto reader = reader_from_lcore_batch(std::move(batch));
-    auto start = std::chrono::steady_clock::now();
 
-    auto dispatch = std::make_unique<ss::promise<>>();
-    auto dispatch_f = dispatch->get_future();
-    auto m = octx.rctx.probe().auto_produce_measurement();
-    auto f
-      = octx.rctx.partition_manager()
-          .invoke_on(
-            *shard,
-            octx.ssg,
-            [reader = std::move(reader),
-             ntp = std::move(ntp),
-             dispatch = std::move(dispatch),
-             num_records,
-             batch_size,
-             bid,
-             acks = octx.request.data.acks,
-             source_shard = ss::this_shard_id()](
-              cluster::partition_manager& mgr) mutable {
-                auto partition = mgr.get(ntp);
-                if (!partition) {
-                    return finalize_request_with_error_code(
-                      error_code::unknown_topic_or_partition,
-                      std::move(dispatch),
-                      ntp,
-                      source_shard);
-                }
-                if (unlikely(!partition->is_leader())) {
-                    return finalize_request_with_error_code(
-                      error_code::not_leader_for_partition,
-                      std::move(dispatch),
-                      ntp,
-                      source_shard);
-                }
-                if (partition->is_read_replica_mode_enabled()) {
-                    return finalize_request_with_error_code(
-                      error_code::invalid_topic_exception,
-                      std::move(dispatch),
-                      ntp,
-                      source_shard);
-                }
-                auto stages = partition_append(
-                  ntp.tp.partition,
-                  ss::make_lw_shared<replicated_partition>(
-                    std::move(partition)),
-                  bid,
-                  std::move(reader),
-                  acks,
-                  num_records,
-                  batch_size);
-                return stages.dispatched
-                  .then_wrapped([source_shard, dispatch = std::move(dispatch)](
-                                  ss::future<> f) mutable {
-                      if (f.failed()) {
-                          (void)ss::smp::submit_to(
-                            source_shard,
-                            [dispatch = std::move(dispatch),
-                             e = f.get_exception()]() mutable {
-                                dispatch->set_exception(e);
-                                dispatch.reset();
-                            });
-                          return;
-                      }
-                      (void)ss::smp::submit_to(
-                        source_shard,
-                        [dispatch = std::move(dispatch)]() mutable {
-                            dispatch->set_value();
-                            dispatch.reset();
-                        });
-                  })
-                  .then([f = std::move(stages.produced)]() mutable {
-                      return std::move(f);
-                  });
-            })
-          .then([&octx, start, m = std::move(m)](
-                  produce_response::partition p) {
-              if (p.error_code == error_code::none) {
-                  auto dur = std::chrono::steady_clock::now() - start;
-                  octx.rctx.connection()->server().update_produce_latency(dur);
-              } else {
-                  m->set_trace(false);
-              }
-              return p;
-          });
-    return partition_produce_stages{
-      .dispatched = std::move(dispatch_f),
-      .produced = std::move(f),
-    };
+    plan.produces_per_shard[*shard].push_back(
+      partition_produce{
+        .ntp = std::move(ntp),
+        .reader = reader_from_lcore_batch(std::move(batch)),
+        .bid = bid,
+        .num_records = num_records,
+        .batch_size = batch_size,
+      },
+      resp,
+      std::chrono::steady_clock::now());
+    return error_code::none;
 }
 
 /**
- * \brief Dispatch and collect topic partition produce responses
+ * \brief Create the produce plan. The response is built upfront, the
+ * partitions rejected on this shard get their error immediately and the
+ * others are filled by the plan execution.
  */
-static topic_produce_stages
-produce_topic(produce_ctx& octx, produce_request::topic& topic) {
-    std::vector<ss::future<produce_response::partition>> partitions_produced;
-    std::vector<ss::future<>> partitions_dispatched;
-    partitions_produced.reserve(topic.partitions.size());
-    partitions_dispatched.reserve(topic.partitions.size());
-
-    for (auto& part : topic.partitions) {
-        if (!octx.rctx.authorized(security::acl_operation::write, topic.name)) {
-            partitions_dispatched.push_back(ss::now());
-            partitions_produced.push_back(
-              ss::make_ready_future<produce_response::partition>(
-                produce_response::partition{
-                  .partition_index = part.partition_index,
-                  .error_code = error_code::topic_authorization_failed}));
-            continue;
-        }
+static produce_plan create_produce_plan(produce_ctx& octx) {
+    produce_plan plan(ss::smp::count);
+    auto& responses = octx.response.data.responses;
+    responses.reserve(octx.request.data.topics.size());
 
-        if (!octx.rctx.metadata_cache().contains(
-              model::topic_namespace_view(model::kafka_namespace, topic.name),
-              part.partition_index)) {
-            partitions_dispatched.push_back(ss::now());
-            partitions_produced.push_back(
-              ss::make_ready_future<produce_response::partition>(
-                produce_response::partition{
-                  .partition_index = part.partition_index,
-                  .error_code = error_code::unknown_topic_or_partition}));
-            continue;
-        }
-
-        // the record data on the wire was null value
-        if (unlikely(!part.records)) {
-            partitions_dispatched.push_back(ss::now());
-            partitions_produced.push_back(
-              ss::make_ready_future<produce_response::partition>(
-                produce_response::partition{
-                  .partition_index = part.partition_index,
-                  .error_code = error_code::invalid_record}));
-            continue;
-        }
-
-        // an error occured handling legacy messages (magic 0 or 1)
-        if (unlikely(part.records->adapter.legacy_error)) {
-            partitions_dispatched.push_back(ss::now());
-            partitions_produced.push_back(
-              ss::make_ready_future<produce_response::partition>(
-                produce_response::partition{
-                  .partition_index = part.partition_index,
-                  .error_code = error_code::invalid_record}));
-            continue;
-        }
-
-        if (unlikely(!part.records->adapter.valid_crc)) {
-            partitions_dispatched.push_back(ss::now());
-            partitions_produced.push_back(
-              ss::make_ready_future<produce_response::partition>(
-                produce_response::partition{
-                  .partition_index = part.partition_index,
-                  .error_code = error_code::corrupt_message}));
-            continue;
-        }
-
-        // produce version >= 3 (enforced for all produce requests)
-        // requires exactly one record batch per request and it must use
-        // the v2 format.
-        //
-        // NOTE: for produce version 0 and 1 the adapter transparently converts
-        // the batch into an v2 batch and sets the v2_format flag. conversion
-        // also produces a single record batch by accumulating legacy messages.
-        if (unlikely(
-              !part.records->adapter.v2_format
-              || !part.records->adapter.batch)) {
-            partitions_dispatched.push_back(ss::now());
-            partitions_produced.push_back(
-              ss::make_ready_future<produce_response::partition>(
-                produce_response::partition{
-                  .partition_index = part.partition_index,
-                  .error_code = error_code::invalid_record}));
-            continue;
+    for (auto& topic : octx.request.data.topics) {
+        auto& t = responses.emplace_back(
+          produce_response::topic{.name = topic.name});
+        // placeholders are referenced by the plan, must not be reallocated
+        t.partitions.reserve(topic.partitions.size());
+        for (auto& part : topic.partitions) {
+            auto& p = t.partitions.emplace_back(produce_response::partition{
+              .partition_index = part.partition_index});
+            p.error_code = plan_topic_partition(octx, plan, topic, part, &p);
         }
-
-        auto pr = produce_topic_partition(octx, topic, part);
-        partitions_produced.push_back(std::move(pr.produced));
-        partitions_dispatched.push_back(std::move(pr.dispatched));
     }
 
-    // collect partition responses and build the topic response
-    return topic_produce_stages{
-      .dispatched = ss::when_all_succeed(
-        partitions_dispatched.begin(), partitions_dispatched.end()),
-      .produced
-      = ss::when_all_succeed(
-          partitions_produced.begin(), partitions_produced.end())
-          .then([name = std::move(topic.name)](
-                  std::vector<produce_response::partition> parts) mutable {
-              return produce_response::topic{
-                .name = std::move(name),
-                .partitions = std::move(parts),
-              };
-          }),
-    };
+    return plan;
 }
 
 /**
- * \brief Dispatch and collect topic produce responses
+ * \brief Dispatch one task per shard and collect the partition responses
  */
-static std::vector<topic_produce_stages> produce_topics(produce_ctx& octx) {
-    std::vector<topic_produce_stages> topics;
-    topics.reserve(octx.request.data.topics.size());
-
-    for (auto& topic : octx.request.data.topics) {
-        topics.push_back(produce_topic(octx, topic));
+static produce_stages
+execute_produce_plan(produce_ctx& octx, produce_plan plan) {
+    std::vector<ss::future<>> dispatched;
+    std::vector<ss::future<>> produced;
+    dispatched.reserve(plan.produces_per_shard.size());
+    produced.reserve(plan.produces_per_shard.size());
+
+    for (ss::shard_id shard = 0; shard < plan.produces_per_shard.size();
+         ++shard) {
+        auto& produce = plan.produces_per_shard[shard];
+        if (produce.empty()) {
+            continue;
+        }
+        auto stages = produce_on_shard(octx, shard, std::move(produce));
+        dispatched.push_back(std::move(stages.dispatched));
+        produced.push_back(std::move(stages.produced));
     }
 
-    return topics;
+    return produce_stages{
+      .dispatched = ss::when_all_succeed(dispatched.begin(), dispatched.end()),
+      .produced = ss::when_all_succeed(produced.begin(), produced.end()),
+    };
 }
 
 template<>
@@ -564,74 +633,60 @@ produce_handler::handle(request_context ctx, ss::smp_service_group ssg) {
         produce_ctx& octx) mutable {
           vlog(klog.trace, "handling produce request {}", octx.request);
 
-          // dispatch produce requests for each topic
-          auto stages = produce_topics(octx);
-          std::vector<ss::future<>> dispatched;
-          std::vector<ss::future<produce_response::topic>> produced;
-          dispatched.reserve(stages.size());
-          produced.reserve(stages.size());
-
-          for (auto& s : stages) {
-              dispatched.push_back(std::move(s.dispatched));
-              produced.push_back(std::move(s.produced));
-          }
-          return seastar::when_all_succeed(dispatched.begin(), dispatched.end())
+          // dispatch produce requests grouped by shard
+          auto stages = execute_produce_plan(octx, create_produce_plan(octx));
+          return std::move(stages.dispatched)
             .then_wrapped([&octx,
                            dispatched_promise = std::move(dispatched_promise),
-                           produced = std::move(produced)](
+                           produced = std::move(stages.produced)](
                             ss::future<> f) mutable {
                 try {
                     f.get();
                     dispatched_promise.set_value();
-                    // collect topic responses
-                    return when_all_succeed(produced.begin(), produced.end())
-                      .then(
-                        [&octx](std::vector<produce_response::topic> topics) {
-                            octx.response.data.responses = std::move(topics);
-                        })
-                      .then([&octx] {
-                          // send response immediately
-                          if (octx.request.data.acks != 0) {
-                              return octx.rctx.respond(
-                                std::move(octx.response));
-                          }
+                    // partition responses are filled by the plan execution
+                    return std::move(produced).then([&octx] {
+                      // send response immediately
+                      if (octx.request.data.acks != 0) {
+                          return octx.rctx.respond(
+                            std::move(octx.response));
+                      }
 
-                          // acks = 0 is handled separately. first, check for
-                          // errors
-                          bool has_error = false;
-                          for (const auto& topic :
-                               octx.response.data.responses) {
-                              for (const auto& p : topic.partitions) {
-                                  if (p.error_code != error_code::none) {
-                                      has_error = true;
-                                      break;
-                                  }
+                      // acks = 0 is handled separately. first, check for
+                      // errors
+                      bool has_error = false;
+                      for (const auto& topic :
+                           octx.response.data.responses) {
+                          for (const auto& p : topic.partitions) {
+                              if (p.error_code != error_code::none) {
+                                  has_error = true;
+                                  break;
                               }
                           }
+                      }
 
-                          // in the absense of errors, acks = 0 results in the
-                          // response being dropped, as the client does not
-                          // expect a response. here we mark the response as
-                          // noop, but let it flow back so that it can be
-                          // accounted for in quota and stats tracking. it is
-                          // dropped later during processing.
-                          if (!has_error) {
-                              return octx.rctx.respond(std::move(octx.response))
-                                .then([](response_ptr resp) {
-                                    resp->mark_noop();
-                                    return resp;
-                                });
-                          }
+                      // in the absense of errors, acks = 0 results in the
+                      // response being dropped, as the client does not
+                      // expect a response. here we mark the response as
+                      // noop, but let it flow back so that it can be
+                      // accounted for in quota and stats tracking. it is
+                      // dropped later during processing.
+                      if (!has_error) {
+                          return octx.rctx.respond(std::move(octx.response))
+                            .then([](response_ptr resp) {
+                                resp->mark_noop();
+                                return resp;
+                            });
+                      }
 
-                          // errors in a response from an acks=0 produce request
-                          // result in the connection being dropped to signal an
-                          // issue to the client
-                          return ss::make_exception_future<response_ptr>(
-                            std::runtime_error(fmt::format(
-                              "Closing connection due to error in produce "
-                              "response: {}",
-                              octx.response)));
-                      });
+                      // errors in a response from an acks=0 produce request
+                      // result in the connection being dropped to signal an
+                      // issue to the client
+                      return ss::make_exception_future<response_ptr>(
+                        std::runtime_error(fmt::format(
+                          "Closing connection due to error in produce "
+                          "response: {}",
+                          octx.response)));
+                  });
                 } catch (...) {
                     /*
                      * if the first stage failed then we cannot resolve the
@@ -642,8 +697,7 @@ produce_handler::handle(request_context ctx, ss::smp_service_group ssg) {
                      * is handled in connection_context handler.
                      */
                     dispatched_promise.set_exception(std::current_exception());
-                    return when_all_succeed(produced.begin(), produced.end())
-                      .discard_result()
+                    return std::move(produced)
                       .then([] {
                           return ss::make_exception_future<response_ptr>(
                             std::runtime_error("First stage produce failed but "
@@ -14,6 +14,8 @@
 #include "security/scram_algorithm.h"
 #include "vlog.h"
 
+#include <seastar/core/scheduling.hh>
+
 namespace kafka {
 
 template<>
@@ -23,14 +25,27 @@ ss::future<response_ptr> sasl_authenticate_handler::handle(
     request.decode(ctx.reader(), ctx.header().version);
     vlog(klog.debug, "Received SASL_AUTHENTICATE {}", request);
 
-    auto result = ctx.sasl()->authenticate(std::move(request.data.auth_bytes));
+    auto& server = ctx.connection()->server();
+    auto m = ctx.probe().auto_sasl_authenticate_measurement();
+    // The unit is held while the step waits for its turn in the auth
+    // scheduling group, so a burst of handshakes queues on the semaphore
+    // rather than piling up tasks in the group.
+    auto units = co_await server.get_auth_unit();
+    auto result = co_await ss::with_scheduling_group(
+      server.auth_sg(), [&ctx, &request] {
+          return ctx.sasl()->authenticate(std::move(request.data.auth_bytes));
+      });
+    units.return_all();
+    m.reset();
+
     if (likely(result)) {
         sasl_authenticate_response_data data{
           .error_code = error_code::none,
           .error_message = std::nullopt,
           .auth_bytes = std::move(result.value()),
         };
-        return ctx.respond(sasl_authenticate_response(std::move(data)));
+        co_return co_await ctx.respond(
+          sasl_authenticate_response(std::move(data)));
     }
 
     sasl_authenticate_response_data data{
@@ -38,7 +53,7 @@ ss::future<response_ptr> sasl_authenticate_handler::handle(
       .error_message = ssx::sformat(
         "SASL authentication failed: {}", result.error().message()),
     };
-    return ctx.respond(sasl_authenticate_response(std::move(data)));
+    co_return co_await ctx.respond(sasl_authenticate_response(std::move(data)));
 }
 
 } // namespace kafka
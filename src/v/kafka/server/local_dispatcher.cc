@@ -0,0 +1,135 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/server/local_dispatcher.h"
+
+#include "config/configuration.h"
+#include "config/node_config.h"
+#include "kafka/server/connection_context.h"
+#include "kafka/server/flex_versions.h"
+#include "kafka/server/logger.h"
+#include "kafka/server/protocol.h"
+#include "kafka/server/request_context.h"
+#include "kafka/server/response.h"
+#include "vlog.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace kafka {
+
+namespace {
+
+constexpr std::string_view local_client_id = "redpanda_local_client";
+
+protocol* get_kafka_protocol(net::server& server) {
+    return dynamic_cast<protocol*>(server.get_protocol());
+}
+
+ss::sstring local_listener_name() {
+    const auto& kafka_api = config::node().kafka_api();
+    return kafka_api.empty() ? ss::sstring{} : kafka_api[0].name;
+}
+
+} // namespace
+
+local_dispatcher::local_dispatcher(ss::sharded<net::server>& server)
+  : _server(server)
+  , _node_id(config::node().node_id()) {}
+
+ss::future<> local_dispatcher::stop() { return _gate.close(); }
+
+bool local_dispatcher::is_ready() const {
+    return _server.local_is_initialized()
+           && get_kafka_protocol(_server.local()) != nullptr;
+}
+
+bool local_dispatcher::is_local_address(
+  const net::unresolved_address& addr) const {
+    const auto& listeners = config::node().kafka_api();
+    if (std::any_of(
+          listeners.begin(), listeners.end(), [&addr](const auto& ep) {
+              return ep.address == addr;
+          })) {
+        return true;
+    }
+    const auto advertised = config::node().advertised_kafka_api();
+    return std::any_of(
+      advertised.begin(), advertised.end(), [&addr](const auto& ep) {
+          return ep.address == addr;
+      });
+}
+
+ss::future<iobuf>
+local_dispatcher::dispatch(api_key key, api_version version, iobuf request) {
+    return ss::with_gate(
+      _gate, [this, key, version, request = std::move(request)]() mutable {
+          return do_dispatch(key, version, std::move(request));
+      });
+}
+
+ss::future<iobuf> local_dispatcher::do_dispatch(
+  api_key key, api_version version, iobuf request) {
+    if (!is_ready()) {
+        // pandaproxy and schema registry may issue requests before the kafka
+        // protocol is attached in start_kafka
+        return ss::make_exception_future<iobuf>(local_dispatch_unavailable());
+    }
+    auto& proto = *get_kafka_protocol(_server.local());
+    if (!_conn) {
+        // mirrors the authorization decision made for network connections in
+        // protocol::apply, minus authentication which has no meaning here.
+        const bool authz_enabled
+          = config::shard_local_cfg().kafka_enable_authorization().value_or(
+            config::shard_local_cfg().enable_sasl());
+        _conn = ss::make_lw_shared<connection_context>(
+          proto, local_listener_name(), authz_enabled);
+    }
+
+    request_header hdr{
+      .key = key,
+      .version = version,
+      .correlation = _correlation,
+      .client_id = local_client_id,
+    };
+    _correlation = _correlation + correlation_id(1);
+    if (flex_versions::is_flexible_request(key, version)) {
+        // an empty tag section is a single byte on the wire
+        hdr.tags = tagged_fields{};
+        hdr.tags_size_bytes = 1;
+    }
+
+    vlog(klog.trace, "local dispatch of request {}", hdr);
+
+    // in-process callers are already accounted for by the services issuing
+    // the requests, so no quota throttling nor memory units apply here.
+    session_resources sres{};
+    auto res = process_request(
+      request_context(
+        _conn, std::move(hdr), std::move(request), std::chrono::milliseconds(0)),
+      proto.smp_group(),
+      sres);
+
+    return std::move(res.dispatched)
+      .then_wrapped([f = std::move(res.response)](ss::future<> d) mutable {
+          if (d.failed()) {
+              return f.discard_result()
+                .handle_exception([](std::exception_ptr e) {
+                    vlog(klog.debug, "Discarding second stage failure {}", e);
+                })
+                .then([d = std::move(d)]() mutable {
+                    return ss::make_exception_future<iobuf>(d.get_exception());
+                });
+          }
+          return f.then(
+            [](response_ptr r) { return std::move(*r).release(); });
+      });
+}
+
+} // namespace kafka
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "kafka/server/fwd.h"
+#include "kafka/types.h"
+#include "model/metadata.h"
+#include "net/server.h"
+#include "net/unresolved_address.h"
+#include "seastarx.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/sharded.hh>
+#include <seastar/core/shared_ptr.hh>
+
+#include <stdexcept>
+
+namespace kafka {
+
+class protocol;
+
+/// \brief Raised by local_dispatcher::dispatch while the kafka protocol of the
+/// local broker is not yet attached to its server.
+class local_dispatch_unavailable final : public std::runtime_error {
+public:
+    local_dispatch_unavailable()
+      : std::runtime_error("kafka protocol not available for local dispatch") {
+    }
+};
+
+/**
+ * Core local entry point for kafka clients living in the same process as the
+ * broker (pandaproxy, schema registry).
+ *
+ * Requests are handed to the kafka request handlers of the local protocol
+ * instance without going through the loopback socket: there is no framing,
+ * no header parsing and no copy through the kernel. The handlers themselves
+ * take care of routing work to the shard owning a partition, exactly as they
+ * do for requests arriving over the network.
+ *
+ * The in-process connection carries no SASL or mTLS identity. When
+ * authorization is enabled requests are authorized as the anonymous
+ * principal, so clients configured with SASL or TLS must keep using TCP.
+ */
+class local_dispatcher {
+public:
+    explicit local_dispatcher(ss::sharded<net::server>&);
+
+    local_dispatcher(const local_dispatcher&) = delete;
+    local_dispatcher& operator=(const local_dispatcher&) = delete;
+    local_dispatcher(local_dispatcher&&) = delete;
+    local_dispatcher& operator=(local_dispatcher&&) = delete;
+    ~local_dispatcher() noexcept = default;
+
+    ss::future<> stop();
+
+    /// \brief Node id of the broker requests are dispatched to.
+    model::node_id node_id() const { return _node_id; }
+
+    /// \brief True once the kafka protocol is attached to the local server and
+    /// requests can be dispatched.
+    bool is_ready() const;
+
+    /// \brief True if addr is one of the kafka listeners of this broker.
+    bool is_local_address(const net::unresolved_address& addr) const;
+
+    /// \brief Process an encoded request body and return the encoded response
+    /// body (without the size prefix and response header).
+    ///
+    /// Fails with local_dispatch_unavailable until \ref is_ready.
+    ss::future<iobuf> dispatch(api_key, api_version, iobuf request);
+
+private:
+    ss::future<iobuf> do_dispatch(api_key, api_version, iobuf request);
+
+    ss::sharded<net::server>& _server;
+    model::node_id _node_id;
+    ss::lw_shared_ptr<connection_context> _conn;
+    correlation_id _correlation{0};
+    ss::gate _gate;
+};
+
+} // namespace kafka
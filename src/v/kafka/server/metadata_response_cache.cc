@@ -0,0 +1,198 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "kafka/server/metadata_response_cache.h"
+
+#include "cluster/metadata_cache.h"
+#include "config/configuration.h"
+#include "kafka/protocol/response_writer.h"
+#include "model/namespace.h"
+#include "prometheus/prometheus_sanitize.h"
+#include "vassert.h"
+
+#include <seastar/core/metrics.hh>
+
+namespace kafka {
+
+void encode_metadata_response_topic(
+  response_writer& writer,
+  const metadata_response::topic& t,
+  api_version version) {
+    vassert(
+      metadata_response_cache::is_cacheable(version),
+      "Unsupported metadata response version {}",
+      version);
+    auto write_node = [](const model::node_id& n, response_writer& w) {
+        w.write(n);
+    };
+    writer.write(t.error_code);
+    writer.write(t.name);
+    if (version >= api_version(1)) {
+        writer.write(t.is_internal);
+    }
+    writer.write_array(
+      t.partitions,
+      [version, &write_node](
+        const metadata_response::partition& p, response_writer& w) {
+          w.write(p.error_code);
+          w.write(p.partition_index);
+          w.write(p.leader_id);
+          if (version >= api_version(7)) {
+              w.write(p.leader_epoch);
+          }
+          w.write_array(p.replica_nodes, write_node);
+          w.write_array(p.isr_nodes, write_node);
+          if (version >= api_version(5)) {
+              w.write_array(p.offline_replicas, write_node);
+          }
+      });
+}
+
+void encode_metadata_response(
+  response_writer& writer,
+  const metadata_response_data& data,
+  std::vector<iobuf> encoded_topics,
+  api_version version) {
+    vassert(
+      metadata_response_cache::is_cacheable(version),
+      "Unsupported metadata response version {}",
+      version);
+    if (version >= api_version(3)) {
+        writer.write(data.throttle_time_ms);
+    }
+    writer.write_array(
+      data.brokers,
+      [version](const metadata_response::broker& b, response_writer& w) {
+          w.write(b.node_id);
+          w.write(b.host);
+          w.write(b.port);
+          if (version >= api_version(1)) {
+              w.write(b.rack);
+          }
+      });
+    if (version >= api_version(2)) {
+        writer.write(data.cluster_id);
+    }
+    if (version >= api_version(1)) {
+        writer.write(data.controller_id);
+    }
+    writer.write(int32_t(encoded_topics.size()));
+    for (auto& t : encoded_topics) {
+        writer.write_direct(std::move(t));
+    }
+}
+
+metadata_response_cache::metadata_response_cache(
+  ss::sharded<cluster::metadata_cache>& metadata_cache)
+  : _metadata_cache(metadata_cache) {
+    _topic_notification
+      = _metadata_cache.local().register_topic_delta_notification(
+        [this](const std::vector<cluster::topic_table::delta>& deltas) {
+            for (const auto& d : deltas) {
+                invalidate(model::topic_namespace(d.ntp.ns, d.ntp.tp.topic));
+            }
+        });
+    _leadership_notification
+      = _metadata_cache.local().register_leadership_update_notification(
+        model::kafka_namespace,
+        [this](
+          model::ntp ntp, model::term_id, std::optional<model::node_id>) {
+            invalidate(
+              model::topic_namespace(std::move(ntp.ns), std::move(ntp.tp.topic)));
+        });
+    setup_metrics();
+}
+
+ss::future<> metadata_response_cache::stop() {
+    _metadata_cache.local().unregister_topic_delta_notification(
+      _topic_notification);
+    _metadata_cache.local().unregister_leadership_update_notification(
+      _leadership_notification);
+    _entries.clear();
+    _size_bytes = 0;
+    return ss::now();
+}
+
+std::optional<iobuf> metadata_response_cache::get(
+  const model::topic_namespace& tp_ns, api_version version) {
+    if (!is_cacheable(version)) {
+        return std::nullopt;
+    }
+    auto it = _entries.find(tp_ns);
+    if (it == _entries.end() || !it->second[version()]) {
+        ++_misses;
+        return std::nullopt;
+    }
+    ++_hits;
+    auto& buf = *it->second[version()];
+    return buf.share(0, buf.size_bytes());
+}
+
+void metadata_response_cache::put(
+  const model::topic_namespace& tp_ns, api_version version, iobuf& buf) {
+    if (!is_cacheable(version)) {
+        return;
+    }
+    auto& entry = _entries[tp_ns][version()];
+    if (entry) {
+        _size_bytes -= entry->size_bytes();
+    }
+    entry = buf.share(0, buf.size_bytes());
+    _size_bytes += entry->size_bytes();
+}
+
+void metadata_response_cache::invalidate(const model::topic_namespace& tp_ns) {
+    auto it = _entries.find(tp_ns);
+    if (it == _entries.end()) {
+        return;
+    }
+    for (const auto& v : it->second) {
+        if (v) {
+            _size_bytes -= v->size_bytes();
+        }
+    }
+    _entries.erase(it);
+    ++_invalidations;
+}
+
+void metadata_response_cache::setup_metrics() {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+
+    namespace sm = ss::metrics;
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("kafka:metadata_response_cache"),
+      {
+        sm::make_gauge(
+          "topics",
+          [this] { return _entries.size(); },
+          sm::description("Number of topics with cached metadata")),
+        sm::make_gauge(
+          "size_bytes",
+          [this] { return _size_bytes; },
+          sm::description("Size of the cached metadata responses in bytes")),
+        sm::make_counter(
+          "hits",
+          [this] { return _hits; },
+          sm::description("Number of topics served from the cache")),
+        sm::make_counter(
+          "misses",
+          [this] { return _misses; },
+          sm::description("Number of topics encoded for a metadata response")),
+        sm::make_counter(
+          "invalidations",
+          [this] { return _invalidations; },
+          sm::description("Number of topics dropped from the cache")),
+      });
+}
+
+} // namespace kafka
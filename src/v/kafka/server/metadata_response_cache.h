@@ -0,0 +1,115 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "cluster/fwd.h"
+#include "cluster/types.h"
+#include "kafka/protocol/metadata.h"
+#include "kafka/types.h"
+#include "model/metadata.h"
+#include "seastarx.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/metrics_registration.hh>
+#include <seastar/core/sharded.hh>
+
+#include <absl/container/node_hash_map.h>
+
+#include <array>
+#include <optional>
+
+namespace kafka {
+
+class response_writer;
+
+/**
+ * Encode a single topic of the metadata response. Only the versions up to
+ * metadata_response_cache::max_version are supported.
+ */
+void encode_metadata_response_topic(
+  response_writer&, const metadata_response::topic&, api_version);
+
+/**
+ * Encode the metadata response using already encoded topics. The topics of
+ * the response data are ignored.
+ */
+void encode_metadata_response(
+  response_writer&,
+  const metadata_response_data&,
+  std::vector<iobuf> encoded_topics,
+  api_version);
+
+/**
+ * Cache of the encoded topics of the metadata response.
+ *
+ * Clients poll the metadata of all topics frequently and encoding every
+ * partition of a large cluster on each request is expensive. Instead the
+ * encoded topics are kept for each version of the API and the response is
+ * assembled from the cached fragments. An entry is dropped whenever the topic
+ * table or the leadership of any of the topic partitions changes, it is
+ * encoded again by the next request.
+ *
+ * Only topics with all partition leaders known are cached as the metadata
+ * handler may pick a random replica for the leaderless partitions.
+ */
+class metadata_response_cache {
+public:
+    // the last version which is not flexible, the flexible versions carry
+    // the tagged fields and authorized operations which are not cacheable
+    static constexpr api_version max_version{7};
+
+    explicit metadata_response_cache(ss::sharded<cluster::metadata_cache>&);
+
+    metadata_response_cache(const metadata_response_cache&) = delete;
+    metadata_response_cache& operator=(const metadata_response_cache&) = delete;
+    metadata_response_cache(metadata_response_cache&&) = delete;
+    metadata_response_cache& operator=(metadata_response_cache&&) = delete;
+    ~metadata_response_cache() noexcept = default;
+
+    ss::future<> stop();
+
+    static bool is_cacheable(api_version version) {
+        return version >= api_version(0) && version <= max_version;
+    }
+
+    /// Returns the encoded topic if it is cached for the given version
+    std::optional<iobuf> get(const model::topic_namespace&, api_version);
+
+    /// Stores the encoded topic, the buffer is shared with the cache
+    void put(const model::topic_namespace&, api_version, iobuf&);
+
+    void invalidate(const model::topic_namespace&);
+
+    size_t size() const { return _entries.size(); }
+
+private:
+    using versions_t = std::array<std::optional<iobuf>, max_version() + 1>;
+
+    void setup_metrics();
+
+    ss::sharded<cluster::metadata_cache>& _metadata_cache;
+    cluster::notification_id_type _topic_notification;
+    cluster::notification_id_type _leadership_notification;
+    absl::node_hash_map<
+      model::topic_namespace,
+      versions_t,
+      model::topic_namespace_hash,
+      model::topic_namespace_eq>
+      _entries;
+    size_t _size_bytes{0};
+    uint64_t _hits{0};
+    uint64_t _misses{0};
+    uint64_t _invalidations{0};
+    ss::metrics::metric_groups _metrics;
+};
+
+} // namespace kafka
@@ -45,6 +45,7 @@ namespace kafka {
 
 protocol::protocol(
   ss::smp_service_group smp,
+  ss::scheduling_group auth_sg,
   ss::sharded<cluster::metadata_cache>& meta,
   ss::sharded<cluster::topics_frontend>& tf,
   ss::sharded<cluster::config_frontend>& cf,
@@ -54,6 +55,7 @@ protocol::protocol(
   ss::sharded<cluster::shard_table>& tbl,
   ss::sharded<cluster::partition_manager>& pm,
   ss::sharded<fetch_session_cache>& session_cache,
+  ss::sharded<metadata_response_cache>& metadata_response_cache,
   ss::sharded<cluster::id_allocator_frontend>& id_allocator_frontend,
   ss::sharded<security::credential_store>& credentials,
   ss::sharded<security::authorizer>& authorizer,
@@ -64,6 +66,10 @@ protocol::protocol(
   ss::sharded<v8_engine::data_policy_table>& data_policy_table,
   std::optional<qdc_monitor::config> qdc_config) noexcept
   : _smp_group(smp)
+  , _auth_sg(auth_sg)
+  , _auth_sem(
+      config::shard_local_cfg().kafka_sasl_max_concurrent_authentications(),
+      "kafka/sasl")
   , _topics_frontend(tf)
   , _config_frontend(cf)
   , _feature_table(ft)
@@ -73,6 +79,7 @@ protocol::protocol(
   , _shard_table(tbl)
   , _partition_manager(pm)
   , _fetch_session_cache(session_cache)
+  , _metadata_response_cache(metadata_response_cache)
   , _id_allocator_frontend(id_allocator_frontend)
   , _is_idempotence_enabled(
       config::shard_local_cfg().enable_idempotence.value())
@@ -22,10 +22,12 @@
 #include "security/authorizer.h"
 #include "security/credential_store.h"
 #include "security/mtls.h"
+#include "ssx/semaphore.h"
 #include "utils/ema.h"
 #include "v8_engine/data_policy_table.h"
 
 #include <seastar/core/future.hh>
+#include <seastar/core/scheduling.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/smp.hh>
 
@@ -35,6 +37,7 @@ class protocol final : public net::server::protocol {
 public:
     protocol(
       ss::smp_service_group,
+      ss::scheduling_group,
       ss::sharded<cluster::metadata_cache>&,
       ss::sharded<cluster::topics_frontend>&,
       ss::sharded<cluster::config_frontend>&,
@@ -44,6 +47,7 @@ public:
       ss::sharded<cluster::shard_table>&,
       ss::sharded<cluster::partition_manager>&,
       ss::sharded<fetch_session_cache>&,
+      ss::sharded<metadata_response_cache>&,
       ss::sharded<cluster::id_allocator_frontend>&,
       ss::sharded<security::credential_store>&,
       ss::sharded<security::authorizer>&,
@@ -66,6 +70,9 @@ public:
     ss::future<> apply(net::server::resources) final;
 
     ss::smp_service_group smp_group() const { return _smp_group; }
+    // SASL authentication runs in its own group so that a reconnect storm
+    // can't starve the data path
+    ss::scheduling_group auth_sg() const { return _auth_sg; }
     cluster::topics_frontend& topics_frontend() {
         return _topics_frontend.local();
     }
@@ -97,6 +104,9 @@ public:
     fetch_session_cache& fetch_sessions_cache() {
         return _fetch_session_cache.local();
     }
+    kafka::metadata_response_cache& get_metadata_response_cache() {
+        return _metadata_response_cache.local();
+    }
     quota_manager& quota_mgr() { return _quota_mgr.local(); }
     bool is_idempotence_enabled() const { return _is_idempotence_enabled; }
     bool are_transactions_enabled() const { return _are_transactions_enabled; }
@@ -127,6 +137,10 @@ public:
           ssx::semaphore_units());
     }
 
+    ss::future<ssx::semaphore_units> get_auth_unit() {
+        return ss::get_units(_auth_sem, 1);
+    }
+
     cluster::controller_api& controller_api() {
         return _controller_api.local();
     }
@@ -139,6 +153,8 @@ public:
 
 private:
     ss::smp_service_group _smp_group;
+    ss::scheduling_group _auth_sg;
+    ssx::semaphore _auth_sem;
     ss::sharded<cluster::topics_frontend>& _topics_frontend;
     ss::sharded<cluster::config_frontend>& _config_frontend;
     ss::sharded<cluster::feature_table>& _feature_table;
@@ -148,6 +164,7 @@ private:
     ss::sharded<cluster::shard_table>& _shard_table;
     ss::sharded<cluster::partition_manager>& _partition_manager;
     ss::sharded<kafka::fetch_session_cache>& _fetch_session_cache;
+    ss::sharded<kafka::metadata_response_cache>& _metadata_response_cache;
     ss::sharded<cluster::id_allocator_frontend>& _id_allocator_frontend;
     bool _is_idempotence_enabled{false};
     bool _are_transactions_enabled{false};
@@ -11,8 +11,13 @@
 
 #include "config/configuration.h"
 #include "kafka/server/logger.h"
+#include "ssx/future-util.h"
 #include "vlog.h"
 
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/smp.hh>
+#include <seastar/coroutine/maybe_yield.hh>
+
 #include <fmt/chrono.h>
 
 #include <chrono>
@@ -21,28 +26,97 @@ namespace kafka {
 using clock = quota_manager::clock;
 using throttle_delay = quota_manager::throttle_delay;
 
-quota_manager::~quota_manager() { _gc_timer.cancel(); }
+quota_manager::quota_manager()
+  : _default_num_windows(config::shard_local_cfg().default_num_windows.bind())
+  , _default_window_width(config::shard_local_cfg().default_window_sec.bind())
+  , _target_tp_rate(config::shard_local_cfg().target_quota_byte_rate.bind())
+  , _dimensions(config::shard_local_cfg().kafka_quota_dimensions.bind())
+  , _gc_freq(config::shard_local_cfg().quota_manager_gc_sec())
+  , _max_delay(config::shard_local_cfg().max_kafka_throttle_delay_ms.bind())
+  , _balance_freq(config::shard_local_cfg().quota_manager_balance_interval()) {
+    _gc_timer.set_callback([this] {
+        auto full_window = _default_num_windows() * _default_window_width();
+        gc(full_window);
+    });
+    _balance_timer.set_callback([this] {
+        ssx::spawn_with_gate(_gate, [this] { return rebalance(); });
+    });
+    update_dimensions();
+    _dimensions.watch([this] {
+        update_dimensions();
+        // the keys of the tracked quotas changed
+        _quotas.clear();
+    });
+}
+
+quota_manager::~quota_manager() {
+    _gc_timer.cancel();
+    _balance_timer.cancel();
+}
 
 ss::future<> quota_manager::stop() {
     _gc_timer.cancel();
-    return ss::make_ready_future<>();
+    _balance_timer.cancel();
+    return _gate.close();
 }
 
 ss::future<> quota_manager::start() {
     _gc_timer.arm_periodic(_gc_freq);
+    if (ss::this_shard_id() == 0 && ss::smp::count > 1) {
+        _balance_timer.arm_periodic(_balance_freq);
+    }
     return ss::make_ready_future<>();
 }
 
+void quota_manager::update_dimensions() {
+    _by_client = false;
+    _by_user = false;
+    for (const auto& d : _dimensions()) {
+        if (d == "client_id") {
+            _by_client = true;
+        } else if (d == "user") {
+            _by_user = true;
+        } else {
+            vlog(klog.warn, "Ignoring unknown quota dimension: {}", d);
+        }
+    }
+}
+
+ss::sstring quota_manager::make_key(
+  std::optional<std::string_view> client_id, std::string_view user) const {
+    // requests without a client id are grouped into an anonymous group that
+    // shares a default quota. the anonymous group is keyed on empty string.
+    auto cid = client_id ? *client_id : "";
+    if (_by_client && _by_user) {
+        // the separator can't appear in either part
+        auto key = ss::uninitialized_string(user.size() + 1 + cid.size());
+        auto out = std::copy(user.begin(), user.end(), key.begin());
+        *out++ = '\0';
+        std::copy(cid.begin(), cid.end(), out);
+        return key;
+    }
+    if (_by_user) {
+        return ss::sstring(user);
+    }
+    if (_by_client) {
+        return ss::sstring(cid);
+    }
+    // a single quota shared by all clients
+    return ss::sstring();
+}
+
 // record a new observation and return <previous delay, new delay>
 throttle_delay quota_manager::record_tp_and_throttle(
   std::optional<std::string_view> client_id,
+  std::string_view user,
   uint64_t bytes,
   clock::time_point now) {
-    // requests without a client id are grouped into an anonymous group that
-    // shares a default quota. the anonymous group is keyed on empty string.
-    auto cid = client_id ? *client_id : "";
+    const double target_rate = _target_tp_rate();
+    const double burst_secs = std::chrono::duration<double>(
+                                _default_window_width())
+                                .count();
 
-    // find or create the throughput tracker for this client
+    // find or create the throughput tracker for this key
     //
     // c++20: heterogeneous lookup for unordered_map can avoid creation of
     // an sstring here but std::unordered_map::find isn't using an
@@ -50,51 +124,50 @@ throttle_delay quota_manager::record_tp_and_throttle(
     // now, these client-name strings are small. This will be solved in
     // c++20 via Hash::transparent_key_equal.
     auto [it, inserted] = _quotas.try_emplace(
-      ss::sstring(cid),
+      make_key(client_id, user),
       quota{
         now,
         clock::duration(0),
-        {static_cast<size_t>(_default_num_windows()),
-         _default_window_width()}});
+        token_bucket(target_rate, target_rate * burst_secs, now)});
+    auto& q = it->second;
 
     // bump to prevent gc
     if (!inserted) {
-        it->second.last_seen = now;
+        q.last_seen = now;
     }
 
-    auto rate = it->second.tp_rate.record_and_measure(bytes, now);
-
-    std::chrono::milliseconds delay_ms(0);
-    if (rate > _target_tp_rate()) {
-        auto diff = rate - _target_tp_rate();
-        double delay = (diff / _target_tp_rate())
-                       * static_cast<double>(
-                         std::chrono::duration_cast<std::chrono::milliseconds>(
-                           it->second.tp_rate.window_size())
-                           .count());
-        delay_ms = std::chrono::milliseconds(static_cast<uint64_t>(delay));
+    // the target rate, window or share may have changed
+    if (auto rate = target_rate * q.share; rate != q.bucket.rate()) {
+        q.bucket.set_rate(rate, rate * burst_secs, now);
     }
+
+    q.usage += bytes;
+    auto delay = q.bucket.record_and_throttle(static_cast<double>(bytes), now);
+    auto delay_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+      delay);
+
     std::chrono::milliseconds max_delay_ms(_max_delay());
     if (delay_ms > max_delay_ms) {
         vlog(
           klog.info,
-          "Found data rate for window of: {} bytes. Client:{}, Estimated "
+          "Found quota debt of: {} bytes. Client:{}, Estimated "
           "backpressure delay of {}. Limiting to {} backpressure delay",
-          rate,
-          cid,
+          -q.bucket.tokens(),
+          client_id ? *client_id : "",
           delay_ms,
           max_delay_ms);
         delay_ms = max_delay_ms;
     }
 
-    auto prev = it->second.delay;
-    it->second.delay = delay_ms;
+    auto prev = q.delay;
+    q.delay = delay_ms;
 
     throttle_delay res{};
     res.first_violation = prev.count() == 0;
-    res.duration = it->second.delay;
+    res.duration = q.delay;
     return res;
 }
+
 // erase inactive tracked quotas. windows are considered inactive if they
 // have not received any updates in ten window's worth of time.
 void quota_manager::gc(clock::duration full_window) {
@@ -107,4 +180,74 @@ void quota_manager::gc(clock::duration full_window) {
       });
 }
 
+std::vector<double>
+quota_manager::compute_shares(const std::vector<uint64_t>& usage) {
+    // fraction of the quota spread evenly between the shards. idle shards
+    // aren't reported, so it is reserved for all of them.
+    static constexpr double even_fraction = 0.1;
+
+    const auto shards = static_cast<double>(usage.size());
+    uint64_t total = 0;
+    for (auto u : usage) {
+        total += u;
+    }
+
+    std::vector<double> shares(usage.size(), 1. / shards);
+    if (total == 0) {
+        return shares;
+    }
+    for (size_t i = 0; i < usage.size(); ++i) {
+        shares[i] = (1. - even_fraction) * static_cast<double>(usage[i])
+                      / static_cast<double>(total)
+                    + even_fraction / shards;
+    }
+    return shares;
+}
+
+quota_manager::usage_map quota_manager::take_usage() {
+    usage_map usage;
+    for (auto& [key, q] : _quotas) {
+        if (q.usage > 0) {
+            usage.emplace(key, std::exchange(q.usage, 0));
+        }
+    }
+    return usage;
+}
+
+ss::future<> quota_manager::apply_shares(const shares_map& shares) {
+    // walk the shares rather than the quotas, which may change while yielding
+    for (const auto& [key, key_shares] : shares) {
+        if (auto it = _quotas.find(key); it != _quotas.end()) {
+            it->second.share = key_shares[ss::this_shard_id()];
+        }
+        co_await ss::coroutine::maybe_yield();
+    }
+}
+
+ss::future<> quota_manager::rebalance() {
+    auto usage = co_await container().map(
+      [](quota_manager& qm) { return qm.take_usage(); });
+
+    // usage of each key by shard
+    absl::flat_hash_map<ss::sstring, std::vector<uint64_t>> by_key;
+    for (size_t shard = 0; shard < usage.size(); ++shard) {
+        for (auto& [key, bytes] : usage[shard]) {
+            auto& u = by_key[key];
+            u.resize(usage.size());
+            u[shard] = bytes;
+            co_await ss::coroutine::maybe_yield();
+        }
+    }
+
+    shares_map shares;
+    shares.reserve(by_key.size());
+    for (const auto& [key, u] : by_key) {
+        shares.emplace(key, compute_shares(u));
+        co_await ss::coroutine::maybe_yield();
+    }
+
+    co_await container().invoke_on_all(
+      [&shares](quota_manager& qm) { return qm.apply_shares(shares); });
+}
+
 } // namespace kafka
@@ -11,11 +11,13 @@
 
 #pragma once
 #include "config/configuration.h"
-#include "resource_mgmt/rate.h"
+#include "resource_mgmt/token_bucket.h"
 #include "seastarx.h"
 
 #include <seastar/core/future.hh>
+#include <seastar/core/gate.hh>
 #include <seastar/core/lowres_clock.hh>
+#include <seastar/core/sharded.hh>
 #include <seastar/core/sstring.hh>
 #include <seastar/core/timer.hh>
 
@@ -24,27 +26,32 @@
 #include <chrono>
 #include <optional>
 #include <string_view>
+#include <vector>
 
 namespace kafka {
 
 // quota_manager tracks quota usage
 //
+// every quota key (by default the client id, see kafka_quota_dimensions) has
+// a token bucket on each shard handling its requests, refilled at the target
+// byte rate. requests exceeding the available tokens are delayed by the time
+// it takes to pay back the debt.
+//
+// a client spreading its connections across shards must not get more than
+// the node quota. shard 0 periodically collects the keys with bytes recorded
+// on each shard and splits their quota between the shards in proportion to
+// their demand. a tenth of the quota is spread evenly between all shards so
+// that idle connections can still make progress. keys idle on every shard keep
+// their shares, keys first seen on a shard get the full quota until the next
+// rebalance.
+//
 // TODO:
 //   - we will want to eventually add support for configuring the quotas and
 //   quota settings as runtime through the kafka api and other mechanisms.
 //
-//   - currently only total throughput per client_id is tracked. in the future
-//   we will want to support additional quotas and accouting granularities to be
-//   at parity with kafka. for example:
-//
-//      - splitting out rates separately for produce and fetch
-//      - accounting per user vs per client (these are separate in kafka)
+//   - splitting out rates separately for produce and fetch.
 //
-//   - it may eventually be beneficial to periodically reduce stats across
-//   shards or track stats globally to produce a more accurate per-node
-//   representation of a statistic (e.g. bandwidth).
-//
-class quota_manager {
+class quota_manager : public ss::peering_sharded_service<quota_manager> {
 public:
     using clock = ss::lowres_clock;
 
@@ -53,20 +60,7 @@ public:
         clock::duration duration;
     };
 
-    quota_manager()
-      : _default_num_windows(
-        config::shard_local_cfg().default_num_windows.bind())
-      , _default_window_width(
-          config::shard_local_cfg().default_window_sec.bind())
-      , _target_tp_rate(config::shard_local_cfg().target_quota_byte_rate.bind())
-      , _gc_freq(config::shard_local_cfg().quota_manager_gc_sec())
-      , _max_delay(
-          config::shard_local_cfg().max_kafka_throttle_delay_ms.bind()) {
-        _gc_timer.set_callback([this] {
-            auto full_window = _default_num_windows() * _default_window_width();
-            gc(full_window);
-        });
-    }
+    quota_manager();
 
     quota_manager(const quota_manager&) = delete;
     quota_manager& operator=(const quota_manager&) = delete;
@@ -82,33 +76,67 @@ public:
     // record a new observation and return <previous delay, new delay>
     throttle_delay record_tp_and_throttle(
       std::optional<std::string_view> client_id,
+      std::string_view user,
       uint64_t bytes,
       clock::time_point now = clock::now());
 
+    // whether the quotas are keyed by the user principal, if not the user
+    // passed to record_tp_and_throttle is ignored
+    bool keyed_by_user() const { return _by_user; }
+
+    // share of the node quota of each shard, given the bytes recorded for the
+    // key by each shard
+    static std::vector<double>
+    compute_shares(const std::vector<uint64_t>& usage);
+
 private:
+    using usage_map = absl::flat_hash_map<ss::sstring, uint64_t>;
+    // share of each key by shard
+    using shares_map = absl::flat_hash_map<ss::sstring, std::vector<double>>;
+
     // erase inactive tracked quotas. windows are considered inactive if they
     // have not received any updates in ten window's worth of time.
     void gc(clock::duration full_window);
 
+    void update_dimensions();
+    ss::sstring make_key(
+      std::optional<std::string_view> client_id, std::string_view user) const;
+
+    ss::future<> rebalance();
+    // bytes recorded since the last call for each key which saw any
+    usage_map take_usage();
+    ss::future<> apply_shares(const shares_map&);
+
 private:
     // last_seen: used for gc keepalive
     // delay: last calculated delay
-    // tp_rate: throughput tracking
+    // bucket: throughput tracking
+    // share: fraction of the node quota assigned to this shard
+    // usage: bytes recorded since the last rebalance
     struct quota {
         clock::time_point last_seen;
         clock::duration delay;
-        rate_tracker tp_rate;
+        token_bucket bucket;
+        double share{1.};
+        uint64_t usage{0};
     };
 
     config::binding<int16_t> _default_num_windows;
     config::binding<std::chrono::milliseconds> _default_window_width;
 
     config::binding<uint32_t> _target_tp_rate;
+    config::binding<std::vector<ss::sstring>> _dimensions;
+    bool _by_client{true};
+    bool _by_user{false};
     absl::flat_hash_map<ss::sstring, quota> _quotas;
 
     ss::timer<> _gc_timer;
     clock::duration _gc_freq;
     config::binding<std::chrono::milliseconds> _max_delay;
+
+    ss::timer<> _balance_timer;
+    clock::duration _balance_freq;
+    ss::gate _gate;
 };
 
 } // namespace kafka
@@ -144,6 +144,10 @@ public:
         return _conn->server().get_fetch_metadata_cache();
     }
 
+    kafka::metadata_response_cache& get_metadata_response_cache() {
+        return _conn->server().get_metadata_response_cache();
+    }
+
     template<typename ResponseType>
     requires requires(
       ResponseType r, response_writer& writer, api_version version) {
@@ -224,4 +228,8 @@ process_result_stages process_request(
 
 bool track_latency(api_key);
 
+// Whether the request may execute concurrently with the requests following it
+// on the connection. Responses are always sent in request order.
+bool can_execute_out_of_order(api_key);
+
 } // namespace kafka
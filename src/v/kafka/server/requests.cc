@@ -12,7 +12,14 @@
 #include "kafka/protocol/schemata/produce_request.h"
 #include "kafka/server/connection_context.h"
 #include "kafka/server/handlers/api_versions.h"
+#include "kafka/server/handlers/describe_configs.h"
+#include "kafka/server/handlers/describe_groups.h"
+#include "kafka/server/handlers/fetch.h"
 #include "kafka/server/handlers/handler_interface.h"
+#include "kafka/server/handlers/list_groups.h"
+#include "kafka/server/handlers/list_offsets.h"
+#include "kafka/server/handlers/metadata.h"
+#include "kafka/server/handlers/offset_for_leader_epoch.h"
 #include "kafka/server/handlers/sasl_authenticate.h"
 #include "kafka/server/handlers/sasl_handshake.h"
 #include "kafka/server/request_context.h"
@@ -242,6 +249,23 @@ bool track_latency(api_key key) {
     }
 }
 
+// read-only requests which neither depend on nor affect the outcome of the
+// requests around them on the same connection
+bool can_execute_out_of_order(api_key key) {
+    switch (key) {
+    case fetch_handler::api::key:
+    case metadata_handler::api::key:
+    case list_offsets_handler::api::key:
+    case offset_for_leader_epoch_handler::api::key:
+    case describe_configs_handler::api::key:
+    case describe_groups_handler::api::key:
+    case list_groups_handler::api::key:
+        return true;
+    default:
+        return false;
+    }
+}
+
 process_result_stages process_request(
   request_context&& ctx,
   ss::smp_service_group g,
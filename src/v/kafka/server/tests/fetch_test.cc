@@ -16,6 +16,7 @@
 #include "test_utils/async.h"
 
 #include <seastar/core/smp.hh>
+#include <seastar/util/defer.hh>
 
 #include <fmt/ostream.h>
 
@@ -503,6 +504,104 @@ FIXTURE_TEST(fetch_one_debounce, redpanda_thread_fixture) {
     BOOST_REQUIRE(resp.data.topics[0].partitions[0].records->size_bytes() > 0);
 }
 
+FIXTURE_TEST(fetch_debounce_wakeup_releases_waiters, redpanda_thread_fixture) {
+    model::topic topic("foo");
+    model::offset offset(0);
+
+    // the debounced re-read would only return after the debounce timeout
+    ss::smp::invoke_on_all([] {
+        config::shard_local_cfg().fetch_reads_debounce_timeout.set_value(
+          std::chrono::milliseconds(10000));
+    }).get();
+    auto reset_debounce = ss::defer([] {
+        ss::smp::invoke_on_all([] {
+            config::shard_local_cfg().fetch_reads_debounce_timeout.reset();
+        }).get();
+    });
+
+    wait_for_controller_leadership().get0();
+
+    add_topic(model::topic_namespace(model::ns("kafka"), topic), 2).get();
+    for (int i = 0; i < 2; ++i) {
+        auto ntp = make_default_ntp(topic, model::partition_id(i));
+        wait_for_partition_offset(ntp, model::offset(0)).get0();
+    }
+
+    kafka::fetch_request req;
+    req.data.max_bytes = std::numeric_limits<int32_t>::max();
+    req.data.min_bytes = 1;
+    req.data.max_wait_ms = std::chrono::milliseconds(20000);
+    req.data.session_id = kafka::invalid_fetch_session_id;
+    req.data.topics = {{
+      .name = topic,
+      .fetch_partitions = {},
+    }};
+    for (int i = 0; i < 2; ++i) {
+        kafka::fetch_request::partition p;
+        p.partition_index = model::partition_id(i);
+        p.log_start_offset = offset;
+        p.fetch_offset = offset;
+        p.max_bytes = std::numeric_limits<int32_t>::max();
+        req.data.topics[0].fetch_partitions.push_back(p);
+    }
+
+    auto client = make_kafka_client().get0();
+    client.connect().get();
+    auto fresp = client.dispatch(req, kafka::api_version(4));
+
+    // the fetch found nothing to read and waits on the partitions
+    auto ntp = make_default_ntp(topic, model::partition_id(0));
+    auto shard = app.shard_table.local().shard_for(ntp);
+    tests::cooperative_spin_wait_with_timeout(5s, [this, ntp, shard] {
+        return app.partition_manager.invoke_on(
+          *shard, [ntp](cluster::partition_manager& mgr) {
+              return !mgr.get(ntp)->raft()->visible_offset_monitor().empty();
+          });
+    }).get();
+
+    // and is woken up by appends to either of them
+    auto appended = ss::lowres_clock::now();
+    app.partition_manager
+      .invoke_on(
+        *shard,
+        [ntp](cluster::partition_manager& mgr) {
+            auto partition = mgr.get(ntp);
+            auto batches = model::test::make_random_batches(
+              model::offset(0), 5);
+            auto rdr = model::make_memory_record_batch_reader(
+              std::move(batches));
+            return partition->raft()->replicate(
+              std::move(rdr),
+              raft::replicate_options(raft::consistency_level::quorum_ack));
+        })
+      .get0();
+
+    auto resp = fresp.get0();
+    BOOST_REQUIRE(ss::lowres_clock::now() - appended < 5s);
+    client.stop().then([&client] { client.shutdown(); }).get();
+
+    BOOST_REQUIRE_EQUAL(resp.data.topics.size(), 1);
+    BOOST_REQUIRE_EQUAL(resp.data.topics[0].partitions.size(), 2);
+    BOOST_REQUIRE(resp.data.topics[0].partitions[0].records);
+    BOOST_REQUIRE_GT(
+      resp.data.topics[0].partitions[0].records->size_bytes(), 0);
+
+    // no waiter is left behind on the partition without new records
+    auto idle_ntp = make_default_ntp(topic, model::partition_id(1));
+    auto idle_shard = app.shard_table.local().shard_for(idle_ntp);
+    auto no_waiters = app.partition_manager
+                        .invoke_on(
+                          *idle_shard,
+                          [idle_ntp](cluster::partition_manager& mgr) {
+                              return mgr.get(idle_ntp)
+                                ->raft()
+                                ->visible_offset_monitor()
+                                .empty();
+                          })
+                        .get0();
+    BOOST_REQUIRE(no_waiters);
+}
+
 FIXTURE_TEST(fetch_multi_topics, redpanda_thread_fixture) {
     // create a topic partition with some data
     model::topic topic_1("foo");
@@ -10,6 +10,7 @@
  */
 #include "kafka/server/handlers/handler_interface.h"
 #include "kafka/server/handlers/handlers.h"
+#include "kafka/server/request_context.h"
 
 #include <boost/test/unit_test.hpp>
 
@@ -47,3 +48,16 @@ BOOST_AUTO_TEST_CASE(handler_handler_for_key) {
     // test case for handlers which fall in the valid range but we don't support
     BOOST_CHECK(!kafka::handler_for_key(kafka::api_key(34)).has_value());
 }
+
+BOOST_AUTO_TEST_CASE(handler_out_of_order) {
+    BOOST_CHECK(kafka::can_execute_out_of_order(kafka::fetch_api::key));
+    BOOST_CHECK(kafka::can_execute_out_of_order(kafka::metadata_api::key));
+    // requests changing state, or depending on earlier ones, stay in order
+    BOOST_CHECK(!kafka::can_execute_out_of_order(kafka::produce_api::key));
+    BOOST_CHECK(
+      !kafka::can_execute_out_of_order(kafka::offset_commit_api::key));
+    BOOST_CHECK(
+      !kafka::can_execute_out_of_order(kafka::sasl_handshake_api::key));
+    BOOST_CHECK(
+      !kafka::can_execute_out_of_order(kafka::sasl_authenticate_api::key));
+}
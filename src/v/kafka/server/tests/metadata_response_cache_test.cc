@@ -0,0 +1,83 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/protocol/metadata.h"
+#include "kafka/protocol/response_writer.h"
+#include "kafka/server/metadata_response_cache.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace {
+kafka::metadata_response::topic
+make_topic(ss::sstring name, int partitions, bool internal) {
+    kafka::metadata_response::topic t;
+    t.error_code = kafka::error_code::none;
+    t.name = model::topic(std::move(name));
+    t.is_internal = internal;
+    for (int i = 0; i < partitions; ++i) {
+        kafka::metadata_response::partition p;
+        p.error_code = i == 0 ? kafka::error_code::leader_not_available
+                              : kafka::error_code::none;
+        p.partition_index = model::partition_id(i);
+        p.leader_id = model::node_id(i % 3);
+        p.leader_epoch = kafka::leader_epoch(i + 10);
+        p.replica_nodes = {
+          model::node_id(0), model::node_id(1), model::node_id(2)};
+        p.isr_nodes = {model::node_id(i % 3)};
+        p.offline_replicas = {model::node_id(2)};
+        t.partitions.push_back(std::move(p));
+    }
+    return t;
+}
+
+kafka::metadata_response make_response() {
+    kafka::metadata_response r;
+    r.data.throttle_time_ms = std::chrono::milliseconds(100);
+    r.data.brokers.push_back(kafka::metadata_response::broker{
+      .node_id = model::node_id(0),
+      .host = "host-0",
+      .port = 9092,
+      .rack = "rack-0"});
+    r.data.brokers.push_back(kafka::metadata_response::broker{
+      .node_id = model::node_id(1), .host = "host-1", .port = 9093});
+    r.data.cluster_id = "redpanda.test";
+    r.data.controller_id = model::node_id(1);
+    r.data.topics.push_back(make_topic("topic-a", 3, false));
+    r.data.topics.push_back(make_topic("topic-b", 0, false));
+    r.data.topics.push_back(make_topic("__consumer_offsets", 5, true));
+    return r;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(metadata_response_cache_encoding_matches_generated) {
+    for (int16_t v = 0; v <= kafka::metadata_response_cache::max_version();
+         ++v) {
+        kafka::api_version version(v);
+        auto response = make_response();
+
+        std::vector<iobuf> topics;
+        for (const auto& t : response.data.topics) {
+            iobuf buf;
+            kafka::response_writer writer(buf);
+            kafka::encode_metadata_response_topic(writer, t, version);
+            topics.push_back(std::move(buf));
+        }
+        iobuf encoded;
+        kafka::response_writer encoded_writer(encoded);
+        kafka::encode_metadata_response(
+          encoded_writer, response.data, std::move(topics), version);
+
+        iobuf expected;
+        kafka::response_writer expected_writer(expected);
+        response.encode(expected_writer, version);
+
+        BOOST_REQUIRE_EQUAL(encoded.size_bytes(), expected.size_bytes());
+        BOOST_REQUIRE(encoded == expected);
+    }
+}
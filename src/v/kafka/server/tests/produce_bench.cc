@@ -0,0 +1,131 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/client/transport.h"
+#include "kafka/protocol/errors.h"
+#include "kafka/protocol/produce.h"
+#include "model/fundamental.h"
+#include "model/namespace.h"
+#include "redpanda/tests/fixture.h"
+#include "storage/record_batch_builder.h"
+#include "test_utils/async.h"
+
+#include <seastar/core/smp.hh>
+
+#include <boost/test/tools/old/interface.hpp>
+
+#include <algorithm>
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+/*
+ * Produce requests writing to every partition of a topic, the partitions are
+ * spread over all of the shards the benchmark runs with. The benchmark needs
+ * the whole application so it is driven by the test fixture rather than by
+ * the perf test framework.
+ */
+struct produce_fixture : public redpanda_thread_fixture {
+    static constexpr int partitions = 200;
+    static constexpr size_t records_per_batch = 10;
+
+    produce_fixture() {
+        wait_for_controller_leadership().get();
+        add_topic(
+          model::topic_namespace_view(model::kafka_namespace, test_topic),
+          partitions)
+          .get();
+        client = std::make_unique<kafka::client::transport>(
+          make_kafka_client().get0());
+        client->connect().get();
+        // the request succeeds only once all of the partitions have leaders
+        tests::cooperative_spin_wait_with_timeout(10s, [this] {
+            return produce().then(
+              [](kafka::produce_response r) { return all_succeeded(r); });
+        }).get();
+    }
+
+    produce_fixture(const produce_fixture&) = delete;
+    produce_fixture& operator=(const produce_fixture&) = delete;
+    produce_fixture(produce_fixture&&) = delete;
+    produce_fixture& operator=(produce_fixture&&) = delete;
+
+    ~produce_fixture() {
+        client->stop().then([this] { client->shutdown(); }).get();
+    }
+
+    kafka::produce_request make_request() {
+        kafka::produce_request::topic tp;
+        tp.name = test_topic;
+        tp.partitions.reserve(partitions);
+        for (int i = 0; i < partitions; ++i) {
+            storage::record_batch_builder builder(
+              model::record_batch_type::raft_data, model::offset(0));
+            for (size_t r = 0; r < records_per_batch; ++r) {
+                iobuf v;
+                v.append("value", 5);
+                builder.add_raw_kv(iobuf{}, std::move(v));
+            }
+            kafka::produce_request::partition partition;
+            partition.partition_index = model::partition_id(i);
+            partition.records.emplace(std::move(builder).build());
+            tp.partitions.push_back(std::move(partition));
+        }
+        std::vector<kafka::produce_request::topic> topics;
+        topics.push_back(std::move(tp));
+        kafka::produce_request req(std::nullopt, 1, std::move(topics));
+        req.data.timeout_ms = std::chrono::seconds(2);
+        req.has_idempotent = false;
+        req.has_transactional = false;
+        return req;
+    }
+
+    static bool all_succeeded(const kafka::produce_response& r) {
+        return std::all_of(
+          r.data.responses.begin(),
+          r.data.responses.end(),
+          [](const kafka::produce_response::topic& t) {
+              return t.partitions.size() == static_cast<size_t>(partitions)
+                     && std::all_of(
+                       t.partitions.begin(),
+                       t.partitions.end(),
+                       [](const kafka::produce_response::partition& p) {
+                           return p.error_code == kafka::error_code::none;
+                       });
+          });
+    }
+
+    ss::future<kafka::produce_response> produce() {
+        return client->dispatch(make_request());
+    }
+
+    std::unique_ptr<kafka::client::transport> client;
+    const model::topic test_topic = model::topic("produce-bench");
+};
+
+FIXTURE_TEST(produce_200_partitions, produce_fixture) {
+    static constexpr size_t requests = 1000;
+
+    std::chrono::steady_clock::duration elapsed{0};
+    for (size_t i = 0; i < requests; ++i) {
+        auto req = make_request();
+        auto start = std::chrono::steady_clock::now();
+        auto resp = client->dispatch(std::move(req)).get0();
+        elapsed += std::chrono::steady_clock::now() - start;
+        BOOST_REQUIRE(all_succeeded(resp));
+    }
+
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(elapsed);
+    info(
+      "{} produce requests of {} partitions on {} shards: {} us per request",
+      requests,
+      partitions,
+      ss::smp::count,
+      us.count() / requests);
+}
@@ -12,7 +12,9 @@
 #include "kafka/protocol/fetch.h"
 #include "kafka/protocol/produce.h"
 #include "kafka/protocol/request_reader.h"
+#include "kafka/protocol/response_writer.h"
 #include "kafka/server/handlers/produce.h"
+#include "kafka/server/protocol_utils.h"
 #include "model/fundamental.h"
 #include "random/generators.h"
 #include "redpanda/tests/fixture.h"
@@ -20,12 +22,14 @@
 #include "test_utils/async.h"
 #include "test_utils/fixture.h"
 
+#include <seastar/core/lowres_clock.hh>
+
 #include <boost/test/tools/old/interface.hpp>
 
 using namespace std::chrono_literals;
 
 struct prod_consume_fixture : public redpanda_thread_fixture {
-    void start() {
+    void start(int partitions = 1) {
         consumer = std::make_unique<kafka::client::transport>(
           make_kafka_client().get0());
         producer = std::make_unique<kafka::client::transport>(
@@ -33,21 +37,24 @@ struct prod_consume_fixture : public redpanda_thread_fixture {
         consumer->connect().get0();
         producer->connect().get0();
         model::topic_namespace tp_ns(model::ns("kafka"), test_topic);
-        add_topic(tp_ns).get0();
-        model::ntp ntp(tp_ns.ns, tp_ns.tp, model::partition_id(0));
-        tests::cooperative_spin_wait_with_timeout(2s, [ntp, this] {
-            auto shard = app.shard_table.local().shard_for(ntp);
-            if (!shard) {
-                return ss::make_ready_future<bool>(false);
-            }
-            return app.partition_manager.invoke_on(
-              *shard, [ntp](cluster::partition_manager& pm) {
-                  return pm.get(ntp)->is_leader();
-              });
-        }).get0();
+        add_topic(tp_ns, partitions).get0();
+        for (int i = 0; i < partitions; ++i) {
+            model::ntp ntp(tp_ns.ns, tp_ns.tp, model::partition_id(i));
+            tests::cooperative_spin_wait_with_timeout(2s, [ntp, this] {
+                auto shard = app.shard_table.local().shard_for(ntp);
+                if (!shard) {
+                    return ss::make_ready_future<bool>(false);
+                }
+                return app.partition_manager.invoke_on(
+                  *shard, [ntp](cluster::partition_manager& pm) {
+                      return pm.get(ntp)->is_leader();
+                  });
+            }).get0();
+        }
     }
 
-    std::vector<kafka::produce_request::partition> small_batches(size_t count) {
+    std::vector<kafka::produce_request::partition> small_batches(
+      size_t count, model::partition_id id = model::partition_id(0)) {
         storage::record_batch_builder builder(
           model::record_batch_type::raft_data, model::offset(0));
 
@@ -60,7 +67,7 @@ struct prod_consume_fixture : public redpanda_thread_fixture {
         std::vector<kafka::produce_request::partition> res;
 
         kafka::produce_request::partition partition;
-        partition.partition_index = model::partition_id(0);
+        partition.partition_index = id;
         partition.records.emplace(std::move(builder).build());
         res.push_back(std::move(partition));
         return res;
@@ -178,3 +185,172 @@ FIXTURE_TEST(test_version_handler, prod_consume_fixture) {
         .get(),
       kafka::client::kafka_request_disconnected_exception);
 }
+
+/**
+ * The partitions of a produce request are dispatched grouped by shard, each
+ * result must land in the placeholder of its own partition, next to the
+ * partitions rejected before dispatch.
+ */
+FIXTURE_TEST(test_produce_partition_results, prod_consume_fixture) {
+    wait_for_controller_leadership().get();
+    start(3);
+
+    auto make_request = [this] {
+        std::vector<kafka::produce_request::topic> topics;
+        auto& tp = topics.emplace_back(
+          kafka::produce_request::topic{.name = test_topic});
+        for (int id : {2, 0, 7}) {
+            auto batches = small_batches(id + 1, model::partition_id(id));
+            std::move(
+              batches.begin(),
+              batches.end(),
+              std::back_inserter(tp.partitions));
+        }
+        // null record set
+        kafka::produce_request::partition no_records;
+        no_records.partition_index = model::partition_id(1);
+        tp.partitions.push_back(std::move(no_records));
+        topics.push_back(kafka::produce_request::topic{
+          .name = model::topic("missing-topic"),
+          .partitions = small_batches(1)});
+        kafka::produce_request req(std::nullopt, -1, std::move(topics));
+        req.data.timeout_ms = std::chrono::seconds(2);
+        req.has_idempotent = false;
+        req.has_transactional = false;
+        return req;
+    };
+
+    for (int round = 0; round < 2; ++round) {
+        auto resp = producer->dispatch(make_request()).get0();
+        BOOST_REQUIRE_EQUAL(resp.data.responses.size(), 2);
+
+        const auto& parts = resp.data.responses[0].partitions;
+        BOOST_REQUIRE_EQUAL(parts.size(), 4);
+        BOOST_REQUIRE_EQUAL(parts[0].partition_index, model::partition_id(2));
+        BOOST_REQUIRE_EQUAL(parts[0].error_code, kafka::error_code::none);
+        BOOST_REQUIRE_EQUAL(parts[0].base_offset, model::offset(round * 3));
+        BOOST_REQUIRE_EQUAL(parts[1].partition_index, model::partition_id(0));
+        BOOST_REQUIRE_EQUAL(parts[1].error_code, kafka::error_code::none);
+        BOOST_REQUIRE_EQUAL(parts[1].base_offset, model::offset(round));
+        BOOST_REQUIRE_EQUAL(parts[2].partition_index, model::partition_id(7));
+        BOOST_REQUIRE_EQUAL(
+          parts[2].error_code, kafka::error_code::unknown_topic_or_partition);
+        BOOST_REQUIRE_EQUAL(parts[3].partition_index, model::partition_id(1));
+        BOOST_REQUIRE_EQUAL(
+          parts[3].error_code, kafka::error_code::invalid_record);
+
+        const auto& missing = resp.data.responses[1].partitions;
+        BOOST_REQUIRE_EQUAL(missing.size(), 1);
+        BOOST_REQUIRE_EQUAL(
+          missing[0].error_code, kafka::error_code::unknown_topic_or_partition);
+    }
+}
+
+/*
+ * Client writing requests without waiting for the responses to the earlier
+ * ones.
+ */
+class pipelining_client : public kafka::client::transport {
+public:
+    using kafka::client::transport::transport;
+
+    template<typename T>
+    ss::future<>
+    send(T r, kafka::api_version version, kafka::correlation_id id) {
+        iobuf buf;
+        auto ph = buf.reserve(sizeof(int32_t));
+        kafka::response_writer wr(buf);
+        wr.write(int16_t(T::api_type::key()));
+        wr.write(int16_t(version()));
+        wr.write(int32_t(id()));
+        wr.write(std::string_view("test_client"));
+        r.encode(wr, version);
+        auto size = ss::cpu_to_be(
+          int32_t(buf.size_bytes() - sizeof(int32_t)));
+        ph.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        return _out.write(iobuf_as_scattered(std::move(buf)));
+    }
+
+    // correlation id and body of the next response, of a version without a
+    // flexible header
+    ss::future<std::pair<kafka::correlation_id, iobuf>> receive() {
+        auto size = co_await kafka::parse_size(_in);
+        if (!size) {
+            throw std::runtime_error("Connection closed");
+        }
+        iobuf_parser parser(co_await read_iobuf_exactly(_in, *size));
+        kafka::correlation_id id(parser.consume_be_type<int32_t>());
+        co_return std::make_pair(id, parser.share(parser.bytes_left()));
+    }
+};
+
+/*
+ * A produce behind a long polling fetch on the same connection doesn't wait
+ * for the fetch, executing in the background, to complete: it is handled
+ * right away and wakes up the fetch well before its max wait expires. The
+ * responses keep the request order.
+ */
+FIXTURE_TEST(test_produce_behind_long_poll_fetch, prod_consume_fixture) {
+    wait_for_controller_leadership().get();
+    start();
+
+    pipelining_client client(net::base_transport::configuration{
+      .server_addr = config::node().kafka_api()[0].address,
+    });
+    client.connect().get();
+
+    const kafka::api_version fetch_version(4);
+    const kafka::api_version produce_version(7);
+
+    kafka::fetch_request::partition fp;
+    fp.fetch_offset = model::offset(0);
+    fp.partition_index = model::partition_id(0);
+    fp.log_start_offset = model::offset(0);
+    fp.max_bytes = 1_MiB;
+    kafka::fetch_request::topic ft;
+    ft.name = test_topic;
+    ft.fetch_partitions.push_back(fp);
+    kafka::fetch_request fetch;
+    fetch.data.min_bytes = 1;
+    fetch.data.max_bytes = 10_MiB;
+    fetch.data.max_wait_ms = 10s;
+    fetch.data.topics.push_back(std::move(ft));
+
+    std::vector<kafka::produce_request::topic> topics;
+    topics.push_back(kafka::produce_request::topic{
+      .name = test_topic, .partitions = small_batches(5)});
+    kafka::produce_request produce(std::nullopt, 1, std::move(topics));
+    produce.data.timeout_ms = std::chrono::seconds(2);
+    produce.has_idempotent = false;
+    produce.has_transactional = false;
+
+    const auto start = ss::lowres_clock::now();
+    client
+      .send(std::move(fetch), fetch_version, kafka::correlation_id(1))
+      .get();
+    client
+      .send(std::move(produce), produce_version, kafka::correlation_id(2))
+      .get();
+
+    auto [fetch_id, fetch_buf] = client.receive().get();
+    BOOST_REQUIRE_EQUAL(fetch_id, kafka::correlation_id(1));
+    kafka::fetch_response fetch_resp;
+    fetch_resp.decode(std::move(fetch_buf), fetch_version);
+    BOOST_REQUIRE_EQUAL(fetch_resp.data.topics.size(), 1);
+    BOOST_REQUIRE_EQUAL(fetch_resp.data.topics.begin()->partitions.size(), 1);
+    const auto& fetched = *fetch_resp.data.topics.begin()->partitions.begin();
+    BOOST_REQUIRE_EQUAL(fetched.error_code, kafka::error_code::none);
+    BOOST_REQUIRE(fetched.records && !fetched.records->empty());
+
+    auto [produce_id, produce_buf] = client.receive().get();
+    BOOST_REQUIRE_EQUAL(produce_id, kafka::correlation_id(2));
+    kafka::produce_response produce_resp;
+    produce_resp.decode(std::move(produce_buf), produce_version);
+    const auto& produced
+      = *produce_resp.data.responses.begin()->partitions.begin();
+    BOOST_REQUIRE_EQUAL(produced.error_code, kafka::error_code::none);
+    BOOST_REQUIRE_EQUAL(produced.base_offset, model::offset(0));
+    BOOST_REQUIRE(ss::lowres_clock::now() - start < 5s);
+
+    client.stop().get();
+}
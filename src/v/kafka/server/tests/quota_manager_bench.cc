@@ -0,0 +1,51 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/server/quota_manager.h"
+#include "seastarx.h"
+#include "units.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+#include <fmt/format.h>
+
+#include <string>
+#include <vector>
+
+namespace {
+
+std::vector<std::string> make_client_ids(size_t count) {
+    std::vector<std::string> ids;
+    ids.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        ids.push_back(fmt::format("producer-client-{}", i));
+    }
+    return ids;
+}
+
+void run_test(size_t clients, size_t records) {
+    kafka::quota_manager qm;
+    auto ids = make_client_ids(clients);
+    auto now = kafka::quota_manager::clock::now();
+
+    perf_tests::start_measuring_time();
+    for (size_t i = 0; i < records; ++i) {
+        perf_tests::do_not_optimize(
+          qm.record_tp_and_throttle(ids[i % clients], "", 16_KiB, now));
+    }
+    perf_tests::stop_measuring_time();
+}
+
+} // namespace
+
+PERF_TEST(quota_manager, record_1_client) { run_test(1, 10000); }
+
+PERF_TEST(quota_manager, record_100_clients) { run_test(100, 10000); }
+
+PERF_TEST(quota_manager, record_10K_clients) { run_test(10000, 10000); }
@@ -0,0 +1,108 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "config/configuration.h"
+#include "kafka/server/quota_manager.h"
+#include "resource_mgmt/token_bucket.h"
+#include "units.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+
+using namespace std::chrono_literals;
+using quota_clock = kafka::quota_manager::clock;
+
+namespace {
+constexpr auto zero = quota_clock::duration(0);
+} // namespace
+
+BOOST_AUTO_TEST_CASE(token_bucket_burst_and_debt) {
+    auto now = quota_clock::now();
+    token_bucket bucket(1000, 500, now);
+
+    // the burst capacity is available right away
+    BOOST_REQUIRE(bucket.record_and_throttle(500, now) == zero);
+
+    // debt is paid back at the rate
+    auto delay = bucket.record_and_throttle(250, now);
+    BOOST_REQUIRE(delay > 240ms && delay < 260ms);
+
+    // refilled, but never above the capacity
+    now += 10s;
+    BOOST_REQUIRE(bucket.record_and_throttle(0, now) == zero);
+    BOOST_REQUIRE_EQUAL(bucket.tokens(), 500);
+
+    // lowering the capacity drops the tokens above it
+    bucket.set_rate(100, 100, now);
+    BOOST_REQUIRE_EQUAL(bucket.tokens(), 100);
+    delay = bucket.record_and_throttle(200, now);
+    BOOST_REQUIRE(delay > 990ms && delay < 1010ms);
+}
+
+BOOST_AUTO_TEST_CASE(quota_shares) {
+    using kafka::quota_manager;
+
+    // a single busy shard gets all but the even part of the idle shard
+    auto shares = quota_manager::compute_shares({0, 100});
+    BOOST_REQUIRE_CLOSE(shares[0], 0.05, 0.001);
+    BOOST_REQUIRE_CLOSE(shares[1], 0.95, 0.001);
+
+    // split by demand with a tenth spread evenly
+    shares = quota_manager::compute_shares({300, 100, 0});
+    BOOST_REQUIRE_CLOSE(shares[0], 0.675 + 0.1 / 3, 0.001);
+    BOOST_REQUIRE_CLOSE(shares[1], 0.225 + 0.1 / 3, 0.001);
+    BOOST_REQUIRE_CLOSE(shares[2], 0.1 / 3, 0.001);
+
+    // idle shards split the quota evenly
+    shares = quota_manager::compute_shares({0, 0});
+    BOOST_REQUIRE_EQUAL(shares[0], 0.5);
+    BOOST_REQUIRE_EQUAL(shares[1], 0.5);
+}
+
+BOOST_AUTO_TEST_CASE(quota_manager_throttle) {
+    auto& cfg = config::shard_local_cfg();
+    cfg.target_quota_byte_rate.set_value(uint32_t(1_MiB));
+    cfg.default_window_sec.set_value(std::chrono::milliseconds(1000));
+    cfg.max_kafka_throttle_delay_ms.set_value(std::chrono::milliseconds(5000));
+
+    kafka::quota_manager qm;
+    auto now = quota_clock::now();
+
+    // within the burst
+    auto delay = qm.record_tp_and_throttle("a", "", 1_MiB, now);
+    BOOST_REQUIRE(delay.duration == zero);
+
+    // over the quota, the first violation isn't delayed by the caller
+    delay = qm.record_tp_and_throttle("a", "", 1_MiB, now);
+    BOOST_REQUIRE(delay.first_violation);
+    BOOST_REQUIRE(delay.duration >= 990ms && delay.duration <= 1000ms);
+    delay = qm.record_tp_and_throttle("a", "", 1_MiB, now);
+    BOOST_REQUIRE(!delay.first_violation);
+    BOOST_REQUIRE(delay.duration >= 1990ms && delay.duration <= 2000ms);
+
+    // other clients have their own quota
+    delay = qm.record_tp_and_throttle("b", "", 1_MiB, now);
+    BOOST_REQUIRE(delay.duration == zero);
+
+    // keyed by user all clients of the user share the quota
+    cfg.kafka_quota_dimensions.set_value(std::vector<ss::sstring>{"user"});
+    BOOST_REQUIRE(qm.keyed_by_user());
+    delay = qm.record_tp_and_throttle("a", "alice", 1_MiB, now);
+    BOOST_REQUIRE(delay.duration == zero);
+    delay = qm.record_tp_and_throttle("b", "alice", 1_MiB, now);
+    BOOST_REQUIRE(delay.duration > zero);
+    delay = qm.record_tp_and_throttle("b", "bob", 1_MiB, now);
+    BOOST_REQUIRE(delay.duration == zero);
+
+    cfg.kafka_quota_dimensions.reset();
+    cfg.target_quota_byte_rate.reset();
+    cfg.default_window_sec.reset();
+    cfg.max_kafka_throttle_delay_ms.reset();
+}
@@ -14,6 +14,7 @@
 #include "bytes/iobuf.h"
 #include "seastarx.h"
 #include "serde/serde.h"
+#include "serde/serialized_size.h"
 #include "ssx/sformat.h"
 #include "utils/named_type.h"
 #include "vassert.h"
@@ -25,6 +26,7 @@
 
 #include <cstdint>
 #include <limits>
+#include <optional>
 #include <ostream>
 #include <string_view>
 #include <type_traits>
@@ -108,6 +110,10 @@ public:
         return write(out, std::move(t._value));
     }
 
+    friend std::optional<size_t> serialized_size(const topic& t) {
+        return serde::serialized_size(t._value);
+    }
+
     operator topic_view() { return topic_view(_value); }
 
     operator topic_view() const { return topic_view(_value); }
@@ -193,6 +199,12 @@ struct topic_partition {
         write(out, std::move(tp.topic));
         write(out, tp.partition);
     }
+
+    friend std::optional<size_t> serialized_size(const topic_partition& tp) {
+        using serde::serialized_size;
+        return serde::sum_sizes(
+          serialized_size(tp.topic), serialized_size(tp.partition));
+    }
     template<typename H>
     friend H AbslHashValue(H h, const topic_partition& tp) {
         return H::combine(std::move(h), tp.topic, tp.partition);
@@ -238,6 +250,12 @@ struct ntp {
         write(out, std::move(ntp.tp));
     }
 
+    friend std::optional<size_t> serialized_size(const ntp& ntp) {
+        using serde::serialized_size;
+        return serde::sum_sizes(
+          serialized_size(ntp.ns), serialized_size(ntp.tp));
+    }
+
     ss::sstring path() const;
     std::filesystem::path topic_path() const;
 
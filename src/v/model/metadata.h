@@ -236,6 +236,12 @@ struct broker_shard {
         write(out, bs.shard);
     }
 
+    friend std::optional<size_t> serialized_size(const broker_shard& bs) {
+        using serde::serialized_size;
+        return serde::sum_sizes(
+          serialized_size(bs.node_id), serialized_size(bs.shard));
+    }
+
     friend void read_nested(
       iobuf_parser& in, broker_shard& bs, std::size_t const bytes_left_limit) {
         using serde::read_nested;
@@ -319,6 +325,11 @@ struct topic_namespace {
         write(out, std::move(t.tp));
     }
 
+    friend std::optional<size_t> serialized_size(const topic_namespace& t) {
+        using serde::serialized_size;
+        return serde::sum_sizes(serialized_size(t.ns), serialized_size(t.tp));
+    }
+
     friend void read_nested(
       iobuf_parser& in,
       topic_namespace& t,
@@ -420,6 +431,21 @@ operator<<(std::ostream& o, const partition_autobalancing_mode& m) {
     }
 }
 
+enum class leader_balancer_mode {
+    greedy_balanced_shards = 0,
+    throughput_balanced_shards,
+};
+
+inline std::ostream&
+operator<<(std::ostream& o, const leader_balancer_mode& m) {
+    switch (m) {
+    case model::leader_balancer_mode::greedy_balanced_shards:
+        return o << "greedy_balanced_shards";
+    case model::leader_balancer_mode::throughput_balanced_shards:
+        return o << "throughput_balanced_shards";
+    }
+}
+
 namespace internal {
 /*
  * Old version for use in backwards compatibility serialization /
@@ -119,9 +119,8 @@ static model::record do_parse_one_record_from_buffer(
   int32_t record_size,
   model::record_attributes::type attr,
   ParserData parser_data) {
-    auto [timestamp_delta, tv] = parser.read_varlong();
-    auto [offset_delta, ov] = parser.read_varlong();
-    auto [key_length, kv] = parser.read_varlong();
+    auto [timestamp_delta, offset_delta, key_length]
+      = parser.template read_varlongs<3>();
     iobuf key;
     if (key_length > 0) {
         key = parser_data(parser, key_length);
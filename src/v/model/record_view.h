@@ -0,0 +1,255 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "bytes/bytes.h"
+#include "bytes/iobuf.h"
+#include "bytes/iobuf_parser.h"
+#include "likely.h"
+#include "model/record.h"
+#include "vassert.h"
+
+#include <fmt/format.h>
+
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+
+namespace model {
+
+/**
+ * Non-owning view of a single record of an uncompressed batch.
+ *
+ * Unlike `record_batch::for_each_record(..)` nothing is materialized: the
+ * record fields are decoded from the batch data the first time any of them is
+ * accessed and the key and value are exposed either as spans pointing into
+ * the batch data, when they are contiguous, or copied on request. Headers are
+ * never decoded.
+ *
+ * The view is valid as long as the batch data isn't modified or moved.
+ */
+class record_view {
+public:
+    record_view(iobuf::iterator_consumer in, int32_t size_bytes) noexcept
+      : _in(in)
+      , _size_bytes(size_bytes) {}
+
+    /// size of the record excluding its length prefix
+    int32_t size_bytes() const { return _size_bytes; }
+
+    record_attributes attributes() const { return fields().attributes; }
+    int64_t timestamp_delta() const { return fields().timestamp_delta; }
+    int32_t offset_delta() const { return fields().offset_delta; }
+
+    /// size of the key, negative for null keys
+    int32_t key_size() const { return fields().key_size; }
+    /// size of the value, negative for null values
+    int32_t value_size() const { return fields().value_size; }
+
+    /// The key if it is stored in a single fragment, std::nullopt otherwise.
+    std::optional<bytes_view> key_span() const {
+        return span(fields().key, key_size());
+    }
+    /// The value if it is stored in a single fragment, std::nullopt otherwise.
+    std::optional<bytes_view> value_span() const {
+        return span(fields().value, value_size());
+    }
+
+    /// Copy of the key, empty for null keys
+    bytes copy_key() const { return copy(fields().key, key_size()); }
+    /// Copy of the value, empty for null values
+    bytes copy_value() const { return copy(fields().value, value_size()); }
+
+private:
+    struct decoded_fields {
+        record_attributes attributes;
+        int64_t timestamp_delta;
+        int32_t offset_delta;
+        int32_t key_size;
+        iobuf::iterator_consumer key;
+        int32_t value_size;
+        iobuf::iterator_consumer value;
+    };
+
+    static std::optional<bytes_view>
+    span(const iobuf::iterator_consumer& in, int32_t size) {
+        if (size <= 0) {
+            return bytes_view{};
+        }
+        if (in.segment_bytes_left() < static_cast<size_t>(size)) {
+            return std::nullopt;
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return bytes_view(
+          reinterpret_cast<const uint8_t*>(&*in.begin()), size);
+    }
+
+    static bytes copy(iobuf::iterator_consumer in, int32_t size) {
+        if (size <= 0) {
+            return bytes{};
+        }
+        auto ret = ss::uninitialized_string<bytes>(size);
+        in.consume_to(size, ret.begin());
+        return ret;
+    }
+
+    const decoded_fields& fields() const {
+        if (!_fields) {
+            _fields = decode();
+        }
+        return *_fields;
+    }
+
+    decoded_fields decode() const {
+        auto in = _in;
+        auto attributes = in.consume_type<record_attributes::type>();
+        auto [timestamp_delta, offset_delta, key_size]
+          = vint::consume_varlongs<3>(in);
+        auto key = in;
+        if (key_size > 0) {
+            in.skip(key_size);
+        }
+        auto value_size = static_cast<int32_t>(vint::consume_varlong(in).first);
+        return decoded_fields{
+          .attributes = record_attributes(attributes),
+          .timestamp_delta = timestamp_delta,
+          .offset_delta = static_cast<int32_t>(offset_delta),
+          .key_size = static_cast<int32_t>(key_size),
+          .key = key,
+          .value_size = value_size,
+          .value = in,
+        };
+    }
+
+    iobuf::iterator_consumer _in;
+    int32_t _size_bytes;
+    mutable std::optional<decoded_fields> _fields;
+};
+
+/**
+ * Iterator over the records of an uncompressed batch, advancing only decodes
+ * the length of the current record.
+ */
+class record_view_iterator {
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = record_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const record_view*;
+    using reference = const record_view&;
+
+    static record_view_iterator
+    make_begin(const iobuf& records, int32_t record_count) {
+        record_view_iterator it(
+          iobuf::iterator_consumer(records.cbegin(), records.cend()),
+          records.size_bytes(),
+          record_count);
+        it.next();
+        return it;
+    }
+
+    static record_view_iterator make_end(const iobuf& records) {
+        return record_view_iterator(
+          iobuf::iterator_consumer(records.cend(), records.cend()), 0, 0);
+    }
+
+    reference operator*() const { return *_current; }
+    pointer operator->() const { return &*_current; }
+
+    record_view_iterator& operator++() {
+        next();
+        return *this;
+    }
+
+    record_view_iterator operator++(int) {
+        auto tmp = *this;
+        next();
+        return tmp;
+    }
+
+    bool operator==(const record_view_iterator& o) const {
+        return _remaining == o._remaining
+               && _current.has_value() == o._current.has_value();
+    }
+    bool operator!=(const record_view_iterator& o) const {
+        return !(*this == o);
+    }
+
+private:
+    record_view_iterator(
+      iobuf::iterator_consumer in, size_t size_bytes, int32_t record_count)
+      : _in(in)
+      , _size_bytes(size_bytes)
+      , _remaining(record_count)
+      , _record_count(record_count) {}
+
+    void next() {
+        if (_remaining == 0) {
+            if (unlikely(_in.bytes_consumed() != _size_bytes)) {
+                throw std::out_of_range(fmt::format(
+                  "Record iteration of {} records stopped with {} bytes "
+                  "remaining",
+                  _record_count,
+                  _size_bytes - _in.bytes_consumed()));
+            }
+            _current.reset();
+            return;
+        }
+        --_remaining;
+        auto [size, length_size] = vint::consume_varlong(_in);
+        _current.emplace(_in, static_cast<int32_t>(size));
+        _in.skip(size);
+    }
+
+    iobuf::iterator_consumer _in;
+    size_t _size_bytes;
+    int32_t _remaining;
+    int32_t _record_count;
+    std::optional<record_view> _current;
+};
+
+class record_view_range {
+public:
+    explicit record_view_range(const record_batch& batch)
+      : _records(batch.data())
+      , _record_count(batch.record_count()) {
+        vassert(
+          !batch.compressed(),
+          "Record iteration is not supported for compressed batches.");
+    }
+
+    record_view_iterator begin() const {
+        return record_view_iterator::make_begin(_records, _record_count);
+    }
+    record_view_iterator end() const {
+        return record_view_iterator::make_end(_records);
+    }
+
+private:
+    const iobuf& _records;
+    int32_t _record_count;
+};
+
+/**
+ * Iterate over the records of an uncompressed batch without materializing
+ * them, e.g.
+ *
+ *     for (const auto& r : model::record_views(batch)) {
+ *         index(r.copy_key(), r.offset_delta());
+ *     }
+ */
+inline record_view_range record_views(const record_batch& batch) {
+    return record_view_range(batch);
+}
+
+} // namespace model
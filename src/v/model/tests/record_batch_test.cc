@@ -9,6 +9,7 @@
 
 #include "model/record.h"
 #include "model/record_utils.h"
+#include "model/record_view.h"
 #include "model/tests/random_batch.h"
 #include "model/timestamp.h"
 
@@ -78,3 +79,52 @@ SEASTAR_THREAD_TEST_CASE(set_max_timestamp) {
     BOOST_TEST(crc == batch.header().crc);
     BOOST_TEST(hdr_crc == batch.header().header_crc);
 }
+
+static void check_record_views(const model::record_batch& batch) {
+    auto records = batch.copy_records();
+    auto views = model::record_views(batch);
+    auto it = views.begin();
+    for (const auto& r : records) {
+        BOOST_REQUIRE(it != views.end());
+        BOOST_REQUIRE_EQUAL(it->size_bytes(), r.size_bytes());
+        BOOST_REQUIRE(it->attributes() == r.attributes());
+        BOOST_REQUIRE_EQUAL(it->timestamp_delta(), r.timestamp_delta());
+        BOOST_REQUIRE_EQUAL(it->offset_delta(), r.offset_delta());
+        BOOST_REQUIRE_EQUAL(it->key_size(), r.key_size());
+        BOOST_REQUIRE_EQUAL(it->value_size(), r.value_size());
+        BOOST_REQUIRE_EQUAL(it->copy_key(), iobuf_to_bytes(r.key()));
+        BOOST_REQUIRE_EQUAL(it->copy_value(), iobuf_to_bytes(r.value()));
+        if (auto key = it->key_span()) {
+            BOOST_REQUIRE_EQUAL(
+              bytes(key->data(), key->size()), iobuf_to_bytes(r.key()));
+        }
+        if (auto value = it->value_span()) {
+            BOOST_REQUIRE_EQUAL(
+              bytes(value->data(), value->size()), iobuf_to_bytes(r.value()));
+        }
+        ++it;
+    }
+    BOOST_REQUIRE(it == views.end());
+}
+
+SEASTAR_THREAD_TEST_CASE(record_view_matches_records) {
+    for (int i = 0; i < 10; ++i) {
+        auto batch = model::test::make_random_batch(
+          model::offset(0), 20, false);
+        check_record_views(batch);
+
+        // split the records in tiny fragments, so that keys and values span
+        // multiple fragments
+        iobuf fragmented;
+        iobuf_const_parser parser(batch.data());
+        while (parser.bytes_left()) {
+            auto chunk = std::min<size_t>(parser.bytes_left(), 3);
+            fragmented.append_fragments(parser.copy(chunk));
+        }
+        model::record_batch fragmented_batch(
+          batch.header(),
+          std::move(fragmented),
+          model::record_batch::tag_ctor_ng{});
+        check_record_views(fragmented_batch);
+    }
+}
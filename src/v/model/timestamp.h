@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <iosfwd>
 #include <limits>
+#include <optional>
 
 class iobuf;
 class iobuf_parser;
@@ -71,6 +72,9 @@ public:
     friend void write(iobuf& out, timestamp ts);
     friend void
     read_nested(iobuf_parser& in, timestamp& ts, size_t const bytes_left_limit);
+    friend std::optional<size_t> serialized_size(const timestamp&) {
+        return sizeof(type);
+    }
 
     static timestamp now();
 
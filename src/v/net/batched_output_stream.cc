@@ -15,16 +15,18 @@
 
 #include <seastar/core/future.hh>
 #include <seastar/core/scattered_message.hh>
+#include <seastar/net/packet.hh>
 
 #include <fmt/format.h>
 
 namespace net {
 
 batched_output_stream::batched_output_stream(
-  ss::output_stream<char> o, size_t cache)
+  ss::output_stream<char> o, size_t cache, server_probe* probe)
   : _out(std::move(o))
   , _cache_size(cache)
-  , _write_sem(std::make_unique<ssx::semaphore>(1, "net/batch-ostream")) {
+  , _write_sem(std::make_unique<ssx::semaphore>(1, "net/batch-ostream"))
+  , _probe(probe) {
     // Size zero reserved for identifying default-initialized
     // instances in stop()
     vassert(_cache_size > 0, "Size must be > 0");
@@ -46,8 +48,12 @@ ss::future<> batched_output_stream::write(ss::scattered_message<char> msg) {
               return already_closed_error(v);
           }
           const size_t vbytes = v.size();
-          return _out.write(std::move(v)).then([this, vbytes] {
+          // append the fragments to the pending packet as they are
+          auto p = std::move(v).release();
+          const size_t vfragments = p.nr_frags();
+          return _out.write(std::move(p)).then([this, vbytes, vfragments] {
               _unflushed_bytes += vbytes;
+              _unflushed_fragments += vfragments;
               if (
                 _write_sem->waiters() == 0 || _unflushed_bytes >= _cache_size) {
                   return do_flush();
@@ -60,7 +66,11 @@ ss::future<> batched_output_stream::do_flush() {
     if (_unflushed_bytes == 0) {
         return ss::make_ready_future<>();
     }
+    if (_probe) {
+        _probe->batched_flush(_unflushed_fragments);
+    }
     _unflushed_bytes = 0;
+    _unflushed_fragments = 0;
     return _out.flush();
 }
 ss::future<> batched_output_stream::flush() {
@@ -11,10 +11,12 @@
 
 #pragma once
 
+#include "net/server_probe.h"
 #include "seastarx.h"
 #include "ssx/semaphore.h"
 
 #include <seastar/core/iostream.hh>
+#include <seastar/net/api.hh>
 
 #include <cstddef>
 #include <memory>
@@ -34,13 +36,25 @@ private:
 };
 
 /// \brief batch operations for zero copy interface of an output_stream<char>
+///
+/// Messages are appended to the output stream without copying their
+/// fragments and are handed to the socket together on flush, as a single
+/// packet of all the fragments of the pending messages. Plain sockets send it
+/// with vectored writes, TLS copies it into its encryption buffers. Messages
+/// are flushed once no other write is waiting or `cache` bytes are pending.
+///
+/// The output stream must be created with a buffer size of at least `cache`
+/// bytes (see make_output_stream), otherwise each message larger than the
+/// buffer is written to the socket on its own.
 class batched_output_stream {
 public:
     static constexpr size_t default_max_unflushed_bytes = 1024 * 1024;
 
     batched_output_stream() = default;
     explicit batched_output_stream(
-      ss::output_stream<char>, size_t cache = default_max_unflushed_bytes);
+      ss::output_stream<char>,
+      size_t cache = default_max_unflushed_bytes,
+      server_probe* probe = nullptr);
     ~batched_output_stream() noexcept = default;
     // NOTE: explicitly defined for a gcc
     batched_output_stream(batched_output_stream&& o) noexcept
@@ -48,6 +62,8 @@ public:
       , _cache_size(o._cache_size)
       , _write_sem(std::move(o._write_sem))
       , _unflushed_bytes(o._unflushed_bytes)
+      , _unflushed_fragments(o._unflushed_fragments)
+      , _probe(o._probe)
       , _closed(o._closed) {}
     batched_output_stream& operator=(batched_output_stream&& o) noexcept {
         if (this != &o) {
@@ -68,6 +84,12 @@ public:
 
     bool is_valid() const noexcept { return _cache_size != 0; }
 
+    /// Output stream of the socket buffering up to `cache` bytes of messages
+    static ss::output_stream<char> make_output_stream(
+      ss::connected_socket& fd, size_t cache = default_max_unflushed_bytes) {
+        return fd.output(cache);
+    }
+
 private:
     ss::future<> do_flush();
 
@@ -75,6 +97,8 @@ private:
     size_t _cache_size{0};
     std::unique_ptr<ssx::semaphore> _write_sem;
     size_t _unflushed_bytes{0};
+    size_t _unflushed_fragments{0};
+    server_probe* _probe{nullptr};
     bool _closed = false;
 };
 } // namespace net
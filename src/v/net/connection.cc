@@ -62,7 +62,10 @@ connection::connection(
   , _name(std::move(name))
   , _fd(std::move(f))
   , _in(_fd.input())
-  , _out(_fd.output())
+  , _out(
+      batched_output_stream::make_output_stream(_fd),
+      batched_output_stream::default_max_unflushed_bytes,
+      &p)
   , _probe(p) {
     if (in_max_buffer_size.has_value()) {
         auto in_config = ss::connected_socket_input_stream_config{};
@@ -108,6 +108,22 @@ void server_probe::setup_metrics(
           sm::description(ssx::sformat(
             "{}: Number of connections are blocked by connection rate", proto)))
           .aggregate(aggregate_labels),
+        sm::make_counter(
+          "batched_flushes",
+          [this] { return _batched_flushes; },
+          sm::description(ssx::sformat(
+            "{}: Number of flushes of the responses batched in the output "
+            "streams",
+            proto)))
+          .aggregate(aggregate_labels),
+        sm::make_counter(
+          "batched_flush_fragments",
+          [this] { return _batched_flush_fragments; },
+          sm::description(ssx::sformat(
+            "{}: Number of response buffer fragments written by the batched "
+            "flushes",
+            proto)))
+          .aggregate(aggregate_labels),
       });
 }
 
@@ -141,7 +157,8 @@ std::ostream& operator<<(std::ostream& o, const server_probe& p) {
       << "sent bytes: " << p._out_bytes << ", "
       << "corrupted headers: " << p._corrupted_headers << ", "
       << "method not found errors: " << p._method_not_found_errors << ", "
-      << "requests blocked by memory: " << p._requests_blocked_memory << "}";
+      << "requests blocked by memory: " << p._requests_blocked_memory << ", "
+      << "batched flushes: " << p._batched_flushes << "}";
     return o;
 }
 
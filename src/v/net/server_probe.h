@@ -52,6 +52,11 @@ public:
 
     void waiting_for_conection_rate() { ++_connections_wait_rate; }
 
+    void batched_flush(size_t fragments) {
+        ++_batched_flushes;
+        _batched_flush_fragments += fragments;
+    }
+
     void setup_metrics(ss::metrics::metric_groups& mgs, std::string_view proto);
 
     void setup_public_metrics(
@@ -72,6 +77,8 @@ private:
     uint32_t _requests_blocked_memory = 0;
     uint32_t _declined_new_connections = 0;
     uint32_t _connections_wait_rate = 0;
+    uint64_t _batched_flushes = 0;
+    uint64_t _batched_flush_fragments = 0;
     friend std::ostream& operator<<(std::ostream& o, const server_probe& p);
 };
 
@@ -0,0 +1,118 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "net/batched_output_stream.h"
+#include "seastarx.h"
+#include "units.h"
+
+#include <seastar/core/iostream.hh>
+#include <seastar/core/scattered_message.hh>
+#include <seastar/core/sleep.hh>
+#include <seastar/net/packet.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <chrono>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+struct put_info {
+    size_t fragments;
+    size_t bytes;
+};
+
+// records the packets handed to the socket, the first one is slow so that
+// the following writes queue up behind it
+class recording_sink final : public ss::data_sink_impl {
+public:
+    explicit recording_sink(std::vector<put_info>& puts)
+      : _puts(puts) {}
+
+    ss::future<> put(ss::net::packet p) final {
+        _puts.push_back({p.nr_frags(), p.len()});
+        if (_puts.size() == 1) {
+            return ss::sleep(10ms);
+        }
+        return ss::now();
+    }
+
+    ss::future<> close() final { return ss::now(); }
+
+private:
+    std::vector<put_info>& _puts;
+};
+
+ss::scattered_message<char> make_message(size_t fragments, size_t size) {
+    ss::scattered_message<char> msg;
+    for (size_t i = 0; i < fragments; ++i) {
+        msg.append(ss::temporary_buffer<char>(size));
+    }
+    return msg;
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(batched_output_stream_single_vectored_write) {
+    std::vector<put_info> puts;
+    const size_t cache = 1_MiB;
+    net::batched_output_stream out(
+      ss::output_stream<char>(
+        ss::data_sink(std::make_unique<recording_sink>(puts)), cache),
+      cache);
+
+    // larger than the default socket buffer, still not written on its own
+    std::vector<ss::future<>> writes;
+    writes.push_back(out.write(make_message(2, 16_KiB)));
+    writes.push_back(out.write(make_message(2, 16_KiB)));
+    writes.push_back(out.write(make_message(3, 16_KiB)));
+    ss::when_all_succeed(writes.begin(), writes.end()).get();
+
+    // the first message may be flushed right away, the ones that queued up
+    // behind it are written together
+    BOOST_REQUIRE_LE(puts.size(), 2);
+    BOOST_REQUIRE_GE(puts.back().fragments, 5);
+    size_t fragments = 0;
+    size_t bytes = 0;
+    for (const auto& p : puts) {
+        fragments += p.fragments;
+        bytes += p.bytes;
+    }
+    BOOST_REQUIRE_EQUAL(fragments, 7);
+    BOOST_REQUIRE_EQUAL(bytes, 112_KiB);
+
+    out.stop().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(batched_output_stream_flush_at_cache_size) {
+    std::vector<put_info> puts;
+    const size_t cache = 64_KiB;
+    net::batched_output_stream out(
+      ss::output_stream<char>(
+        ss::data_sink(std::make_unique<recording_sink>(puts)), cache),
+      cache);
+
+    std::vector<ss::future<>> writes;
+    for (int i = 0; i < 6; ++i) {
+        writes.push_back(out.write(make_message(1, 32_KiB)));
+    }
+    ss::when_all_succeed(writes.begin(), writes.end()).get();
+
+    // queued messages are written once cache bytes are pending
+    BOOST_REQUIRE_LE(puts.size(), 4);
+    size_t bytes = 0;
+    for (const auto& p : puts) {
+        BOOST_REQUIRE_LE(p.bytes, cache);
+        bytes += p.bytes;
+    }
+    BOOST_REQUIRE_EQUAL(bytes, 192_KiB);
+
+    out.stop().get();
+}
@@ -59,7 +59,8 @@ ss::future<> base_transport::do_connect(clock_type::time_point timeout) {
         // Never implicitly destroy a live output stream here: output streams
         // are only safe to destroy after/during stop()
         vassert(!_out.is_valid(), "destroyed output_stream without stopping");
-        _out = net::batched_output_stream(_fd->output());
+        _out = net::batched_output_stream(
+          net::batched_output_stream::make_output_stream(*_fd));
     } catch (...) {
         auto e = std::current_exception();
         _probe.connection_error(e);
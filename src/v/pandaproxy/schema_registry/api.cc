@@ -11,6 +11,7 @@
 
 #include "kafka/client/client.h"
 #include "kafka/client/configuration.h"
+#include "kafka/server/local_dispatcher.h"
 #include "model/metadata.h"
 #include "pandaproxy/schema_registry/configuration.h"
 #include "pandaproxy/schema_registry/seq_writer.h"
@@ -28,12 +29,14 @@ api::api(
   ss::smp_service_group sg,
   size_t max_memory,
   kafka::client::configuration& client_cfg,
-  configuration& cfg) noexcept
+  configuration& cfg,
+  ss::sharded<kafka::local_dispatcher>* local_dispatcher) noexcept
   : _node_id{node_id}
   , _sg{sg}
   , _max_memory{max_memory}
   , _client_cfg{client_cfg}
-  , _cfg{cfg} {}
+  , _cfg{cfg}
+  , _local_dispatcher{local_dispatcher} {}
 
 api::~api() noexcept = default;
 
@@ -42,6 +45,11 @@ ss::future<> api::start() {
     co_await _store->start(_sg);
     co_await _client.start(
       config::to_yaml(_client_cfg, config::redact_secrets::no));
+    if (_local_dispatcher) {
+        co_await _client.invoke_on_all([this](kafka::client::client& c) {
+            c.set_local_dispatcher(&_local_dispatcher->local());
+        });
+    }
     co_await _sequencer.start(
       _node_id, _sg, std::ref(_client), std::ref(*_store));
     co_await _service.start(
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "kafka/client/fwd.h"
+#include "kafka/server/fwd.h"
 #include "model/metadata.h"
 #include "pandaproxy/schema_registry/fwd.h"
 #include "seastarx.h"
@@ -31,7 +32,9 @@ public:
       ss::smp_service_group sg,
       size_t max_memory,
       kafka::client::configuration& client_cfg,
-      configuration& cfg) noexcept;
+      configuration& cfg,
+      ss::sharded<kafka::local_dispatcher>* local_dispatcher
+      = nullptr) noexcept;
     ~api() noexcept;
 
     ss::future<> start();
@@ -43,6 +46,7 @@ private:
     size_t _max_memory;
     kafka::client::configuration& _client_cfg;
     configuration& _cfg;
+    ss::sharded<kafka::local_dispatcher>* _local_dispatcher;
 
     ss::sharded<kafka::client::client> _client;
     std::unique_ptr<pandaproxy::schema_registry::sharded_store> _store;
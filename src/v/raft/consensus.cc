@@ -1335,8 +1335,13 @@ ss::future<>
 consensus::write_voted_for(consensus::voted_for_configuration config) {
     auto key = voted_for_key();
     iobuf val = reflection::to_iobuf(config);
+    // vote and term changes are on the election path, don't let them wait
+    // for the commit interval
     return _storage.kvs().put(
-      storage::kvstore::key_space::consensus, std::move(key), std::move(val));
+      storage::kvstore::key_space::consensus,
+      std::move(key),
+      std::move(val),
+      storage::kvstore::flush_priority::yes);
 }
 
 ss::future<> consensus::write_last_applied(model::offset o) {
@@ -9,8 +9,6 @@
 
 #include "raft/offset_monitor.h"
 
-#include "vassert.h"
-
 #include <seastar/core/future-util.hh>
 
 namespace raft {
@@ -35,7 +33,8 @@ ss::future<> offset_monitor::wait(
     if (!f.available()) {
         // the future may already be available, for example if an abort had
         // already be requested. in that case, skip adding as a waiter.
-        _waiters.emplace(offset, std::move(w));
+        auto it = _waiters.emplace(offset, std::move(w));
+        it->second->it = it;
     }
     return f;
 }
@@ -78,13 +77,6 @@ offset_monitor::waiter::waiter(
 
 void offset_monitor::waiter::handle_abort() {
     done.set_exception(wait_aborted());
-    auto it = std::find_if(
-      mon->_waiters.begin(),
-      mon->_waiters.end(),
-      [this](const waiters_type::value_type& w) {
-          return w.second.get() == this;
-      });
-    vassert(it != mon->_waiters.end(), "waiter not found");
     // when the waiter is destroyed here by erase, then if they are active,
     // the timer is cancelled and the abort source subscription is removed.
     mon->_waiters.erase(it); // *this is no longer valid after erase
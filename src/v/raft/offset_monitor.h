@@ -18,7 +18,7 @@
 #include <seastar/core/future.hh>
 #include <seastar/core/timer.hh>
 
-#include <absl/container/btree_map.h>
+#include <map>
 
 namespace raft {
 
@@ -67,8 +67,15 @@ public:
     void notify(model::offset);
 
 private:
+    struct waiter;
+
+    // node based so that a waiter can keep its own position, and remove
+    // itself in constant time when it is aborted
+    using waiters_type = std::multimap<model::offset, std::unique_ptr<waiter>>;
+
     struct waiter {
         offset_monitor* mon;
+        waiters_type::iterator it;
         ss::promise<> done;
         ss::timer<model::timeout_clock> timer;
         ss::abort_source::subscription sub;
@@ -83,9 +90,6 @@ private:
 
     friend waiter;
 
-    using waiters_type
-      = absl::btree_multimap<model::offset, std::unique_ptr<waiter>>;
-
     waiters_type _waiters;
     model::offset _last_applied;
 };
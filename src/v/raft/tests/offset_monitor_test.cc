@@ -187,6 +187,27 @@ SEASTAR_THREAD_TEST_CASE(wait_abort_source) {
     BOOST_REQUIRE(mon.empty());
 }
 
+SEASTAR_THREAD_TEST_CASE(wait_abort_source_same_offset) {
+    raft::offset_monitor mon;
+    ss::abort_source as;
+
+    // only the aborted waiter is removed, the others on the same offset stay
+    auto f0_1 = mon.wait(model::offset(0), model::no_timeout, std::nullopt);
+    auto f0_2 = mon.wait(model::offset(0), model::no_timeout, as);
+    auto f0_3 = mon.wait(model::offset(0), model::no_timeout, std::nullopt);
+
+    as.request_abort();
+    BOOST_REQUIRE(f0_2.failed());
+    BOOST_REQUIRE_THROW(f0_2.get(), raft::offset_monitor::wait_aborted);
+    BOOST_REQUIRE(!f0_1.available());
+    BOOST_REQUIRE(!f0_3.available());
+
+    mon.notify(model::offset(0));
+    BOOST_REQUIRE_NO_THROW(f0_1.get());
+    BOOST_REQUIRE_NO_THROW(f0_3.get());
+    BOOST_REQUIRE(mon.empty());
+}
+
 SEASTAR_THREAD_TEST_CASE(wait_abort_source_already_aborted) {
     raft::offset_monitor mon;
     ss::abort_source as;
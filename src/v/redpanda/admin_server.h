@@ -75,12 +75,12 @@ private:
     static constexpr auth_level superuser = auth_level::superuser;
 
     /**
-     * Authenticate, and raise if `required_auth` is not met by
-     * the credential (or pass if authentication is disabled).
+     * Raise if `required_auth` is not met by the authenticated identity
+     * (or pass if authentication is disabled).
      */
     template<auth_level required_auth>
-    request_auth_result apply_auth(ss::const_req req) {
-        auto auth_state = _auth.authenticate(req);
+    request_auth_result apply_auth(request_auth_result::identity id) {
+        auto auth_state = request_auth_result(std::move(id));
         if constexpr (required_auth == auth_level::superuser) {
             auth_state.require_superuser();
         } else if constexpr (required_auth == auth_level::user) {
@@ -107,17 +107,22 @@ private:
         path.set(
           _server._routes,
           [this, handler](std::unique_ptr<ss::httpd::request> req) {
-              auto auth_state = apply_auth<required_auth>(*req);
-
-              // Note: a request is only logged if it does not throw
-              // from authenticate().
-              log_request(*req, auth_state);
-
-              if constexpr (peek_auth) {
-                  return handler(std::move(req), auth_state);
-              } else {
-                  return handler(std::move(req));
-              }
+              auto& req_ref = *req;
+              return _auth.authenticate(req_ref).then(
+                [this, handler, req = std::move(req)](
+                  request_auth_result::identity id) mutable {
+                    auto auth_state = apply_auth<required_auth>(std::move(id));
+
+                    // Note: a request is only logged if it does not throw
+                    // from authenticate().
+                    log_request(*req, auth_state);
+
+                    if constexpr (peek_auth) {
+                        return handler(std::move(req), auth_state);
+                    } else {
+                        return handler(std::move(req));
+                    }
+                });
           });
     }
 
@@ -134,12 +139,20 @@ private:
       ss::httpd::path_description const& path,
       ss::httpd::handle_function handler) {
         auto handler_f = new ss::httpd::function_handler{
-          [this, handler](ss::const_req req, ss::reply& reply) {
-              auto auth_state = apply_auth<required_auth>(req);
-
-              log_request(req, auth_state);
-
-              return handler(req, reply);
+          [this, handler](
+            std::unique_ptr<ss::httpd::request> req,
+            std::unique_ptr<ss::reply> rep) {
+              auto& req_ref = *req;
+              return _auth.authenticate(req_ref).then(
+                [this, handler, req = std::move(req), rep = std::move(rep)](
+                  request_auth_result::identity id) mutable {
+                    auto auth_state = apply_auth<required_auth>(std::move(id));
+
+                    log_request(*req, auth_state);
+
+                    rep->_content += handler(*req, *rep);
+                    return std::move(rep);
+                });
           },
           "json"};
 
@@ -12,6 +12,7 @@
 #include "archival/ntp_archiver_service.h"
 #include "archival/service.h"
 #include "archival/upload_controller.h"
+#include "bytes/details/io_fragment_pool.h"
 #include "cli_parser.h"
 #include "cluster/cluster_utils.h"
 #include "cluster/controller.h"
@@ -41,6 +42,8 @@
 #include "kafka/server/group_manager.h"
 #include "kafka/server/group_metadata_migration.h"
 #include "kafka/server/group_router.h"
+#include "kafka/server/local_dispatcher.h"
+#include "kafka/server/metadata_response_cache.h"
 #include "kafka/server/protocol.h"
 #include "kafka/server/queue_depth_monitor.h"
 #include "kafka/server/quota_manager.h"
@@ -274,6 +277,24 @@ void application::initialize(
           config::shard_local_cfg().zstd_decompress_workspace_bytes());
     }).get0();
 
+    ss::smp::invoke_on_all([] {
+        auto& pool = details::io_fragment_pool::local();
+        pool.configure({
+          .high_watermark
+          = config::shard_local_cfg().iobuf_fragment_pool_high_watermark(),
+          .low_watermark
+          = config::shard_local_cfg().iobuf_fragment_pool_low_watermark(),
+        });
+        if (!config::shard_local_cfg().disable_metrics()) {
+            pool.setup_metrics();
+        }
+    }).get0();
+    _deferred.emplace_back([] {
+        ss::smp::invoke_on_all([] {
+            details::io_fragment_pool::local().stop();
+        }).get();
+    });
+
     if (config::shard_local_cfg().enable_pid_file()) {
         syschecks::pidfile_create(config::node().pidfile_path());
     }
@@ -544,11 +565,13 @@ static storage::kvstore_config kvstore_config_from_global_config() {
      *           - 1
      *           - ... #cores
      */
-    return storage::kvstore_config(
+    auto conf = storage::kvstore_config(
       config::shard_local_cfg().kvstore_max_segment_size(),
       config::shard_local_cfg().kvstore_flush_interval.bind(),
       config::node().data_directory().as_sstring(),
       storage::debug_sanitize_files::no);
+    conf.flush_threshold = config::shard_local_cfg().kvstore_flush_threshold();
+    return conf;
 }
 
 static storage::log_config
@@ -675,6 +698,13 @@ void application::wire_up_services() {
           memory_groups::kafka_total_memory(),
           std::reference_wrapper(_proxy_client))
           .get();
+        if (_redpanda_enabled) {
+            _proxy_client
+              .invoke_on_all([this](kafka::client::client& c) {
+                  c.set_local_dispatcher(&kafka_local_dispatcher.local());
+              })
+              .get();
+        }
     }
     if (_schema_reg_config) {
         construct_single_service(
@@ -685,7 +715,8 @@ void application::wire_up_services() {
           // https://github.com/redpanda-data/redpanda/issues/1392
           memory_groups::kafka_total_memory(),
           *_schema_reg_client_config,
-          *_schema_reg_config);
+          *_schema_reg_config,
+          _redpanda_enabled ? &kafka_local_dispatcher : nullptr);
     }
 }
 
@@ -1190,10 +1221,14 @@ void application::wire_up_redpanda_services() {
       .get();
     _kafka_server.start(&kafka_cfg).get();
     kafka_cfg.stop().get();
+    // constructed ahead of the proxy clients which hold on to it; requests are
+    // refused until the kafka protocol is attached in start_kafka.
+    construct_service(kafka_local_dispatcher, std::ref(_kafka_server)).get();
     construct_service(
       fetch_session_cache,
       config::shard_local_cfg().fetch_session_eviction_timeout_ms())
       .get();
+    construct_service(metadata_response_cache, std::ref(metadata_cache)).get();
     construct_service(
       _compaction_controller,
       std::ref(storage),
@@ -1455,6 +1490,7 @@ void application::start_kafka(::stop_signal& app_signal) {
       .invoke_on_all([this, qdc_config](net::server& s) {
           auto proto = std::make_unique<kafka::protocol>(
             smp_service_groups.kafka_smp_sg(),
+            _scheduling_groups.auth_sg(),
             metadata_cache,
             controller->get_topics_frontend(),
             controller->get_config_frontend(),
@@ -1464,6 +1500,7 @@ void application::start_kafka(::stop_signal& app_signal) {
             shard_table,
             partition_manager,
             fetch_session_cache,
+            metadata_response_cache,
             id_allocator_frontend,
             controller->get_credential_store(),
             controller->get_authorizer(),
@@ -96,6 +96,7 @@ public:
     ss::sharded<kafka::coordinator_ntp_mapper> co_coordinator_ntp_mapper;
     std::unique_ptr<cluster::controller> controller;
     ss::sharded<kafka::fetch_session_cache> fetch_session_cache;
+    ss::sharded<kafka::metadata_response_cache> metadata_response_cache;
     smp_groups smp_service_groups;
     ss::sharded<kafka::quota_manager> quota_mgr;
     ss::sharded<cluster::id_allocator_frontend> id_allocator_frontend;
@@ -108,6 +109,7 @@ public:
     ss::sharded<cluster::tx_gateway_frontend> tx_gateway_frontend;
     ss::sharded<v8_engine::data_policy_table> data_policies;
     ss::sharded<cloud_storage::cache> shadow_index_cache;
+    ss::sharded<kafka::local_dispatcher> kafka_local_dispatcher;
 
 private:
     using deferred_actions
@@ -13,58 +13,103 @@
 
 #include "cluster/controller.h"
 #include "config/configuration.h"
+#include "prometheus/prometheus_sanitize.h"
 #include "seastar/http/exception.hh"
 #include "security/scram_algorithm.h"
 #include "vlog.h"
 
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/metrics.hh>
+
 static ss::logger logger{"request_auth"};
 
 request_authenticator::request_authenticator(
   config::binding<bool> require_auth, cluster::controller* controller)
   : _controller(controller)
-  , _require_auth(std::move(require_auth)) {}
+  , _require_auth(std::move(require_auth))
+  , _validate_sem(
+      config::shard_local_cfg().admin_api_max_concurrent_password_checks(),
+      "admin/auth") {
+    setup_metrics();
+}
+
+void request_authenticator::setup_metrics() {
+    namespace sm = ss::metrics;
+
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("admin:auth"),
+      {sm::make_counter(
+         "password_cache_hits",
+         [this] { return _password_cache.hits(); },
+         sm::description(
+           "Number of basic auth passwords found in the verified password "
+           "cache")),
+       sm::make_counter(
+         "password_cache_misses",
+         [this] { return _password_cache.misses(); },
+         sm::description(
+           "Number of basic auth passwords validated with PBKDF2")),
+       sm::make_gauge(
+         "password_checks_waiting",
+         [this] { return _validate_sem.waiters(); },
+         sm::description(
+           "Number of basic auth password validations waiting for the "
+           "concurrency limit"))});
+}
 
 /**
  * Attempt to authenticate the request.
  *
- * The returned object **must be used** via one of its authorization
- * helpers (e.g. require_superuser) or it will throw an exception
- * on destruction.
+ * The resulting identity **must be used** to build a request_auth_result
+ * and checked via one of its authorization helpers (e.g. require_superuser)
+ * or it will throw an exception on destruction.
  *
  * @param req
  * @return
  */
-request_auth_result
+ss::future<request_auth_result::identity>
 request_authenticator::authenticate(const ss::httpd::request& req) {
     if (_controller == nullptr) {
         // We are running outside of an environment with credentials, e.g.
         // a unit test or a standalone pandaproxy/schema_registry
-        return request_auth_result(
-          request_auth_result::authenticated::yes,
-          request_auth_result::superuser::yes);
+        co_return request_auth_result::identity{
+          .is_authenticated = request_auth_result::authenticated::yes,
+          .is_superuser = request_auth_result::superuser::yes};
     }
 
     const auto& cred_store = _controller->get_credential_store().local();
     try {
-        return do_authenticate(req, cred_store, _require_auth());
+        co_return co_await do_authenticate(req, cred_store, _require_auth());
     } catch (ss::httpd::base_exception const& e) {
-        if (e.status() == ss::httpd::reply::status_type::unauthorized) {
-            if (_require_auth()) {
-                throw;
-            } else {
-                // Auth is disabled: give this user full access, but
-                // treat them as anonymous.
-                return request_auth_result(
-                  request_auth_result::authenticated::yes,
-                  request_auth_result::superuser::yes);
-            }
-        } else {
+        if (
+          e.status() != ss::httpd::reply::status_type::unauthorized
+          || _require_auth()) {
             throw;
         }
     }
+    // Auth is disabled: give this user full access, but
+    // treat them as anonymous.
+    co_return request_auth_result::identity{
+      .is_authenticated = request_auth_result::authenticated::yes,
+      .is_superuser = request_auth_result::superuser::yes};
 }
 
-request_auth_result request_authenticator::do_authenticate(
+ss::future<bool> request_authenticator::validate_password(
+  const ss::sstring& password, const security::scram_credential& cred) {
+    auto units = co_await ss::get_units(_validate_sem, 1);
+    if (co_await security::scram_sha256::validate_password_async(
+          password, cred.stored_key(), cred.salt(), cred.iterations())) {
+        co_return true;
+    }
+    co_return co_await security::scram_sha512::validate_password_async(
+      password, cred.stored_key(), cred.salt(), cred.iterations());
+}
+
+ss::future<request_auth_result::identity>
+request_authenticator::do_authenticate(
   ss::httpd::request const& req,
   security::credential_store const& cred_store,
   bool require_auth) {
@@ -97,6 +142,7 @@ request_auth_result request_authenticator::do_authenticate(
         username = security::credential_user{decoded_bytes.substr(0, colon)};
         auto password = ss::sstring(decoded_bytes.substr(colon + 1));
 
+        _password_cache.sync(cred_store);
         const auto cred_opt = cred_store.get<security::scram_credential>(
           username);
         if (!cred_opt.has_value()) {
@@ -109,11 +155,14 @@ request_auth_result request_authenticator::do_authenticate(
               "Unauthorized", ss::httpd::reply::status_type::unauthorized);
         } else {
             const auto& cred = cred_opt.value();
-            bool is_valid = (
-              security::scram_sha256::validate_password(
-                password, cred.stored_key(), cred.salt(), cred.iterations())
-              || security::scram_sha512::validate_password(
-                password, cred.stored_key(), cred.salt(), cred.iterations()));
+            bool is_valid = _password_cache.contains(
+              username, password, cred);
+            if (!is_valid) {
+                is_valid = co_await validate_password(password, cred);
+                if (is_valid) {
+                    _password_cache.insert(username, password, cred);
+                }
+            }
             if (!is_valid) {
                 // User found, password doesn't match
                 vlog(
@@ -128,8 +177,10 @@ request_auth_result request_authenticator::do_authenticate(
                 auto found = std::find(
                   superusers.begin(), superusers.end(), username);
                 bool superuser = (found != superusers.end()) || (!require_auth);
-                return request_auth_result(
-                  username, request_auth_result::superuser(superuser));
+                co_return request_auth_result::identity{
+                  .username = username,
+                  .is_authenticated = request_auth_result::authenticated::yes,
+                  .is_superuser = request_auth_result::superuser(superuser)};
             }
         }
     } else if (!auth_hdr.empty()) {
@@ -138,13 +189,13 @@ request_auth_result request_authenticator::do_authenticate(
     } else {
         // No Authorization header: user is anonymous
         if (require_auth) {
-            return request_auth_result(
-              request_auth_result::authenticated::no,
-              request_auth_result::superuser::no);
+            co_return request_auth_result::identity{
+              .is_authenticated = request_auth_result::authenticated::no,
+              .is_superuser = request_auth_result::superuser::no};
         } else {
-            return request_auth_result(
-              request_auth_result::authenticated::yes,
-              request_auth_result::superuser::yes);
+            co_return request_auth_result::identity{
+              .is_authenticated = request_auth_result::authenticated::yes,
+              .is_superuser = request_auth_result::superuser::yes};
         }
     }
 }
@@ -13,7 +13,11 @@
 
 #include "cluster/fwd.h"
 #include "config/property.h"
+#include "security/scram_password_cache.h"
+#include "ssx/semaphore.h"
 
+#include <seastar/core/future.hh>
+#include <seastar/core/metrics_registration.hh>
 #include <seastar/http/request.hh>
 
 #include <security/credential_store.h>
@@ -55,6 +59,21 @@ public:
       : _authenticated(is_authenticated)
       , _superuser(is_superuser){};
 
+    /**
+     * Outcome of authentication before any authorization check. Unlike
+     * request_auth_result it is safe to pass through a future.
+     */
+    struct identity {
+        std::optional<security::credential_user> username;
+        authenticated is_authenticated;
+        superuser is_superuser;
+    };
+
+    explicit request_auth_result(identity id)
+      : _username(std::move(id.username).value_or(security::credential_user{}))
+      , _authenticated(id.is_authenticated)
+      , _superuser(id.is_superuser){};
+
     ~request_auth_result() noexcept(false);
 
     /**
@@ -86,14 +105,34 @@ public:
     request_authenticator(
       config::binding<bool> require_auth, cluster::controller*);
 
-    request_auth_result authenticate(const ss::httpd::request& req);
+    /**
+     * Validating a basic auth password runs PBKDF2, so the returned future
+     * may wait for a free validation slot. Build a request_auth_result from
+     * the identity to apply authorization rules.
+     */
+    ss::future<request_auth_result::identity>
+    authenticate(const ss::httpd::request& req);
 
 private:
-    request_auth_result do_authenticate(
+    ss::future<request_auth_result::identity> do_authenticate(
       ss::httpd::request const& req,
       security::credential_store const& cred_store,
       bool require_auth);
 
+    ss::future<bool> validate_password(
+      const ss::sstring& password, const security::scram_credential&);
+
+    void setup_metrics();
+
     cluster::controller* _controller{nullptr};
     config::binding<bool> _require_auth;
+    // basic auth credentials are validated on every request
+    security::scram_password_cache _password_cache;
+    // bounds the PBKDF2 derivations running on this core
+    ssx::semaphore _validate_sem;
+    ss::metrics::metric_groups _metrics;
+};
+    config::binding<bool> _require_auth;
+    // basic auth credentials are validated on every request
+    security::scram_password_cache _password_cache;
 };
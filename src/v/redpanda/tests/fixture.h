@@ -88,6 +88,7 @@ public:
         // used by request context builder
         proto = std::make_unique<kafka::protocol>(
           app.smp_service_groups.kafka_smp_sg(),
+          ss::default_scheduling_group(),
           app.metadata_cache,
           app.controller->get_topics_frontend(),
           app.controller->get_config_frontend(),
@@ -97,6 +98,7 @@ public:
           app.shard_table,
           app.partition_manager,
           app.fetch_session_cache,
+          app.metadata_response_cache,
           app.id_allocator_frontend,
           app.controller->get_credential_store(),
           app.controller->get_authorizer(),
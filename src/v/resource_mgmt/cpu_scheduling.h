@@ -36,6 +36,7 @@ public:
           "raft_learner_recovery", 50);
         _archival_upload = co_await ss::create_scheduling_group(
           "archival_upload", 100);
+        _auth = co_await ss::create_scheduling_group("auth", 100);
     }
 
     ss::future<> destroy_groups() {
@@ -48,6 +49,7 @@ public:
         co_await destroy_scheduling_group(_compaction);
         co_await destroy_scheduling_group(_raft_learner_recovery);
         co_await destroy_scheduling_group(_archival_upload);
+        co_await destroy_scheduling_group(_auth);
         co_return;
     }
 
@@ -64,6 +66,7 @@ public:
         return _raft_learner_recovery;
     }
     ss::scheduling_group archival_upload() { return _archival_upload; }
+    ss::scheduling_group auth_sg() { return _auth; }
 
     std::vector<std::reference_wrapper<const ss::scheduling_group>>
     all_scheduling_groups() const {
@@ -77,7 +80,8 @@ public:
           std::cref(_cache_background_reclaim),
           std::cref(_compaction),
           std::cref(_raft_learner_recovery),
-          std::cref(_archival_upload)};
+          std::cref(_archival_upload),
+          std::cref(_auth)};
     }
 
 private:
@@ -92,4 +96,5 @@ private:
     ss::scheduling_group _compaction;
     ss::scheduling_group _raft_learner_recovery;
     ss::scheduling_group _archival_upload;
+    ss::scheduling_group _auth;
 };
@@ -0,0 +1,79 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+#include "seastarx.h"
+
+#include <seastar/core/lowres_clock.hh>
+
+#include <algorithm>
+#include <chrono>
+
+// token_bucket limits the rate of a metric to `rate` units/second while
+// allowing bursts of up to `capacity` units. tokens are refilled continuously
+// based on the time elapsed since the last update.
+//
+// recording more units than there are tokens puts the bucket into debt, and
+// the returned throttle delay is the time it takes to pay back the debt at the
+// configured rate. unlike a sliding window rate, recording an observation is a
+// constant amount of work.
+class token_bucket final {
+public:
+    using clock = ss::lowres_clock;
+
+    token_bucket(double rate, double capacity, clock::time_point now)
+      : _rate(std::max(rate, min_rate))
+      , _capacity(capacity)
+      , _tokens(capacity)
+      , _last_refill(now) {}
+
+    // record an observation and return the delay until the bucket is out of
+    // debt, zero if it isn't in debt.
+    clock::duration record_and_throttle(double v, clock::time_point now) {
+        refill(now);
+        _tokens -= v;
+        if (_tokens >= 0) {
+            return clock::duration(0);
+        }
+        return std::chrono::duration_cast<clock::duration>(
+          std::chrono::duration<double>(-_tokens / _rate));
+    }
+
+    // change the rate and capacity, the available tokens are clamped to the
+    // new capacity while any debt is kept.
+    void set_rate(double rate, double capacity, clock::time_point now) {
+        refill(now);
+        _rate = std::max(rate, min_rate);
+        _capacity = capacity;
+        _tokens = std::min(_tokens, _capacity);
+    }
+
+    double rate() const { return _rate; }
+    double capacity() const { return _capacity; }
+    double tokens() const { return _tokens; }
+
+private:
+    static constexpr double min_rate = 1.;
+
+    void refill(clock::time_point now) {
+        if (now <= _last_refill) {
+            return;
+        }
+        auto elapsed = std::chrono::duration<double>(now - _last_refill);
+        _tokens = std::min(_capacity, _tokens + elapsed.count() * _rate);
+        _last_refill = now;
+    }
+
+    double _rate;
+    double _capacity;
+    double _tokens;
+    clock::time_point _last_refill;
+};
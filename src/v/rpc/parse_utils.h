@@ -18,6 +18,7 @@
 #include "rpc/logger.h"
 #include "rpc/types.h"
 #include "seastarx.h"
+#include "serde/serialized_size.h"
 #include "vlog.h"
 
 #include <seastar/core/do_with.hh>
@@ -115,6 +116,22 @@ concept is_rpc_serde_exempt = requires {
     typename T::rpc_serde_exempt;
 };
 
+/*
+ * Serde encoding of a message. Messages without asynchronous serialization are
+ * sized first so that they are written into a single reserved fragment.
+ */
+template<typename T>
+ss::future<> write_serde(iobuf& out, T msg) {
+    if constexpr (serde::has_serde_async_write<T>) {
+        return ss::do_with(std::move(msg), [&out](T& msg) {
+            return serde::write_async(out, std::move(msg));
+        });
+    } else {
+        serde::write_reserved(out, std::move(msg));
+        return ss::now();
+    }
+}
+
 /*
  * Encode a client request for the given transport version.
  *
@@ -140,10 +157,8 @@ encode_for_version(iobuf& out, T msg, transport_version version) {
             return transport_version::v0;
         });
     } else if constexpr (is_rpc_adl_exempt<T>) {
-        return ss::do_with(std::move(msg), [&out](T& msg) {
-            return serde::write_async(out, std::move(msg)).then([] {
-                return transport_version::v2;
-            });
+        return write_serde(out, std::move(msg)).then([] {
+            return transport_version::v2;
         });
     } else {
         if (version < transport_version::v2) {
@@ -151,10 +166,8 @@ encode_for_version(iobuf& out, T msg, transport_version version) {
               .to(out, std::move(msg))
               .then([version] { return version; });
         } else {
-            return ss::do_with(std::move(msg), [&out, version](T& msg) {
-                return serde::write_async(out, std::move(msg)).then([version] {
-                    return version;
-                });
+            return write_serde(out, std::move(msg)).then([version] {
+                return version;
             });
         }
     }
@@ -68,6 +68,8 @@ struct aws_header_values {
     static constexpr boost::beast::string_view user_agent
       = "redpanda.vectorized.io";
     static constexpr boost::beast::string_view text_plain = "text/plain";
+    static constexpr boost::beast::string_view application_xml
+      = "application/xml";
 };
 
 // configuration //
@@ -160,6 +162,17 @@ std::ostream& operator<<(std::ostream& o, const configuration& c) {
 
 // request_creator //
 
+static void add_tagging_header(
+  http::client::request_header& header, const std::vector<object_tag>& tags) {
+    if (!tags.empty()) {
+        std::stringstream tstr;
+        for (const auto& [key, val] : tags) {
+            tstr << fmt::format("&{}={}", key, val);
+        }
+        header.insert(aws_header_names::x_amz_tagging, tstr.str().substr(1));
+    }
+}
+
 request_creator::request_creator(
   const configuration& conf,
   ss::lw_shared_ptr<const cloud_roles::apply_credentials> apply_credentials)
@@ -167,13 +180,16 @@ request_creator::request_creator(
   , _apply_credentials{std::move(apply_credentials)} {}
 
 result<http::client::request_header> request_creator::make_get_object_request(
-  bucket_name const& name, object_key const& key) {
+  bucket_name const& name,
+  object_key const& key,
+  std::optional<byte_range> range) {
     http::client::request_header header{};
     // GET /{object-id} HTTP/1.1
     // Host: {bucket-name}.s3.amazonaws.com
     // x-amz-date:{req-datetime}
     // Authorization:{signature}
     // x-amz-content-sha256:e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855
+    // Range: bytes={first}-{last}
     auto host = fmt::format("{}.{}", name(), _ap());
     auto target = fmt::format("/{}", key().string());
     header.method(boost::beast::http::verb::get);
@@ -182,6 +198,11 @@ result<http::client::request_header> request_creator::make_get_object_request(
       boost::beast::http::field::user_agent, aws_header_values::user_agent);
     header.insert(boost::beast::http::field::host, host);
     header.insert(boost::beast::http::field::content_length, "0");
+    if (range) {
+        header.insert(
+          boost::beast::http::field::range,
+          fmt::format("bytes={}-{}", range->first, range->last));
+    }
     auto ec = _apply_credentials->add_auth(header);
     if (ec) {
         return ec;
@@ -241,13 +262,7 @@ request_creator::make_unsigned_put_object_request(
       boost::beast::http::field::content_length,
       std::to_string(payload_size_bytes));
 
-    if (!tags.empty()) {
-        std::stringstream tstr;
-        for (const auto& [key, val] : tags) {
-            tstr << fmt::format("&{}={}", key, val);
-        }
-        header.insert(aws_header_names::x_amz_tagging, tstr.str().substr(1));
-    }
+    add_tagging_header(header, tags);
 
     auto ec = _apply_credentials->add_auth(header);
     if (ec) {
@@ -320,6 +335,125 @@ request_creator::make_delete_object_request(
     return header;
 }
 
+result<http::client::request_header>
+request_creator::make_create_multipart_upload_request(
+  bucket_name const& name,
+  object_key const& key,
+  const std::vector<object_tag>& tags) {
+    // POST /{object-id}?uploads HTTP/1.1
+    // Host: {bucket-name}.s3.amazonaws.com
+    // x-amz-date:{req-datetime}
+    // Authorization:{signature}
+    // x-amz-tagging:{tags}
+    http::client::request_header header{};
+    auto host = fmt::format("{}.{}", name(), _ap());
+    auto target = fmt::format("/{}?uploads", key().string());
+    header.method(boost::beast::http::verb::post);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_type, aws_header_values::text_plain);
+    header.insert(boost::beast::http::field::content_length, "0");
+    add_tagging_header(header, tags);
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+    return header;
+}
+
+result<http::client::request_header>
+request_creator::make_unsigned_upload_part_request(
+  bucket_name const& name,
+  object_key const& key,
+  upload_id const& id,
+  size_t part_number,
+  size_t payload_size_bytes) {
+    // PUT /{object-id}?partNumber={part}&uploadId={upload-id} HTTP/1.1
+    // Host: {bucket-name}.s3.amazonaws.com
+    // x-amz-date:{req-datetime}
+    // Authorization:{signature}
+    // Content-Length: {size}
+    // [{size} bytes of part data]
+    http::client::request_header header{};
+    auto host = fmt::format("{}.{}", name(), _ap());
+    auto target = fmt::format(
+      "/{}?partNumber={}&uploadId={}", key().string(), part_number, id());
+    header.method(boost::beast::http::verb::put);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_type, aws_header_values::text_plain);
+    header.insert(
+      boost::beast::http::field::content_length,
+      std::to_string(payload_size_bytes));
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+    return header;
+}
+
+result<http::client::request_header>
+request_creator::make_complete_multipart_upload_request(
+  bucket_name const& name,
+  object_key const& key,
+  upload_id const& id,
+  size_t payload_size_bytes) {
+    // POST /{object-id}?uploadId={upload-id} HTTP/1.1
+    // Host: {bucket-name}.s3.amazonaws.com
+    // x-amz-date:{req-datetime}
+    // Authorization:{signature}
+    // Content-Type: application/xml
+    // <CompleteMultipartUpload>...</CompleteMultipartUpload>
+    http::client::request_header header{};
+    auto host = fmt::format("{}.{}", name(), _ap());
+    auto target = fmt::format("/{}?uploadId={}", key().string(), id());
+    header.method(boost::beast::http::verb::post);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_type,
+      aws_header_values::application_xml);
+    header.insert(
+      boost::beast::http::field::content_length,
+      std::to_string(payload_size_bytes));
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+    return header;
+}
+
+result<http::client::request_header>
+request_creator::make_abort_multipart_upload_request(
+  bucket_name const& name, object_key const& key, upload_id const& id) {
+    // DELETE /{object-id}?uploadId={upload-id} HTTP/1.1
+    // Host: {bucket-name}.s3.amazonaws.com
+    // x-amz-date:{req-datetime}
+    // Authorization:{signature}
+    http::client::request_header header{};
+    auto host = fmt::format("{}.{}", name(), _ap());
+    auto target = fmt::format("/{}?uploadId={}", key().string(), id());
+    header.method(boost::beast::http::verb::delete_);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(boost::beast::http::field::content_length, "0");
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+    return header;
+}
+
 // client //
 
 static void log_buffer_with_rate_limiting(const char* msg, iobuf& buf) {
@@ -486,8 +620,9 @@ ss::future<> client::shutdown() {
 ss::future<http::client::response_stream_ref> client::get_object(
   bucket_name const& name,
   object_key const& key,
-  const ss::lowres_clock::duration& timeout) {
-    auto header = _requestor.make_get_object_request(name, key);
+  const ss::lowres_clock::duration& timeout,
+  std::optional<byte_range> range) {
+    auto header = _requestor.make_get_object_request(name, key, range);
     if (!header) {
         return ss::make_exception_future<http::client::response_stream_ref>(
           std::system_error(header.error()));
@@ -503,8 +638,11 @@ ss::future<http::client::response_stream_ref> client::get_object(
           // the header first
           return ref->prefetch_headers().then([ref = std::move(ref)]() mutable {
               vassert(ref->is_header_done(), "Header is not received");
+              // ranged requests are answered with 206 (Partial Content)
+              const auto status = ref->get_headers().result();
               if (
-                ref->get_headers().result() != boost::beast::http::status::ok) {
+                status != boost::beast::http::status::ok
+                && status != boost::beast::http::status::partial_content) {
                   // Got error response, consume the response body and produce
                   // rest api error
                   vlog(
@@ -695,6 +833,167 @@ ss::future<> client::delete_object(
       });
 }
 
+ss::future<upload_id> client::create_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  const std::vector<object_tag>& tags,
+  const ss::lowres_clock::duration& timeout) {
+    auto header = _requestor.make_create_multipart_upload_request(
+      name, key, tags);
+    if (!header) {
+        throw std::system_error(header.error());
+    }
+    vlog(
+      s3_log.trace,
+      "send https request:\n{}",
+      http::redacted_header(header.value()));
+    try {
+        auto ref = co_await _client.request(std::move(header.value()), timeout);
+        auto res = co_await drain_response_stream(ref);
+        if (ref->get_headers().result() != boost::beast::http::status::ok) {
+            vlog(s3_log.warn, "S3 replied with error: {}", ref->get_headers());
+            co_return co_await parse_rest_error_response<upload_id>(
+              std::move(res));
+        }
+        auto root = iobuf_to_ptree(std::move(res));
+        co_return upload_id(
+          root.get<ss::sstring>("InitiateMultipartUploadResult.UploadId"));
+    } catch (const rest_error_response& err) {
+        _probe->register_failure(err.code());
+        throw;
+    }
+}
+
+ss::future<ss::sstring> client::upload_part(
+  bucket_name const& name,
+  object_key const& key,
+  upload_id const& id,
+  size_t part_number,
+  size_t payload_size,
+  ss::input_stream<char>&& body,
+  const ss::lowres_clock::duration& timeout) {
+    auto stream = std::move(body);
+    auto header = _requestor.make_unsigned_upload_part_request(
+      name, key, id, part_number, payload_size);
+    if (!header) {
+        co_await stream.close();
+        throw std::system_error(header.error());
+    }
+    vlog(
+      s3_log.trace,
+      "send https request:\n{}",
+      http::redacted_header(header.value()));
+    std::exception_ptr eptr;
+    ss::sstring etag;
+    try {
+        auto ref = co_await _client.request(
+          std::move(header.value()), stream, timeout);
+        auto res = co_await drain_response_stream(ref);
+        if (ref->get_headers().result() != boost::beast::http::status::ok) {
+            vlog(s3_log.warn, "S3 replied with error: {}", ref->get_headers());
+            co_await parse_rest_error_response<>(std::move(res));
+        }
+        auto tag = ref->get_headers().at(boost::beast::http::field::etag);
+        etag = ss::sstring(tag.data(), tag.size());
+    } catch (const rest_error_response& err) {
+        _probe->register_failure(err.code());
+        eptr = std::current_exception();
+    } catch (...) {
+        eptr = std::current_exception();
+    }
+    co_await stream.close();
+    if (eptr) {
+        std::rethrow_exception(eptr);
+    }
+    co_return etag;
+}
+
+/// Generate body of the 'CompleteMultipartUpload' request
+static iobuf make_complete_multipart_upload_body(
+  const std::vector<completed_part>& parts) {
+    ss::sstring xml = "<CompleteMultipartUpload>";
+    for (const auto& part : parts) {
+        xml += ssx::sformat(
+          "<Part><PartNumber>{}</PartNumber><ETag>{}</ETag></Part>",
+          part.part_number,
+          part.etag);
+    }
+    xml += "</CompleteMultipartUpload>";
+    iobuf out;
+    out.append(xml.data(), xml.size());
+    return out;
+}
+
+ss::future<> client::complete_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  upload_id const& id,
+  const std::vector<completed_part>& parts,
+  const ss::lowres_clock::duration& timeout) {
+    auto body = make_complete_multipart_upload_body(parts);
+    auto header = _requestor.make_complete_multipart_upload_request(
+      name, key, id, body.size_bytes());
+    if (!header) {
+        throw std::system_error(header.error());
+    }
+    vlog(
+      s3_log.trace,
+      "send https request:\n{}",
+      http::redacted_header(header.value()));
+    auto stream = make_iobuf_input_stream(std::move(body));
+    std::exception_ptr eptr;
+    try {
+        auto ref = co_await _client.request(
+          std::move(header.value()), stream, timeout);
+        auto res = co_await drain_response_stream(ref);
+        if (ref->get_headers().result() != boost::beast::http::status::ok) {
+            vlog(s3_log.warn, "S3 replied with error: {}", ref->get_headers());
+            co_await parse_rest_error_response<>(std::move(res));
+        }
+        // The server can report an error with status 200 after it started
+        // sending whitespace to keep the connection alive while the object
+        // is being assembled. The error is encoded in the body in this case.
+        auto root = iobuf_to_ptree(res.copy());
+        if (root.get_child_optional("Error")) {
+            vlog(s3_log.warn, "CompleteMultipartUpload failed");
+            co_await parse_rest_error_response<>(std::move(res));
+        }
+    } catch (const rest_error_response& err) {
+        _probe->register_failure(err.code());
+        eptr = std::current_exception();
+    } catch (...) {
+        eptr = std::current_exception();
+    }
+    co_await stream.close();
+    if (eptr) {
+        std::rethrow_exception(eptr);
+    }
+}
+
+ss::future<> client::abort_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  upload_id const& id,
+  const ss::lowres_clock::duration& timeout) {
+    auto header = _requestor.make_abort_multipart_upload_request(name, key, id);
+    if (!header) {
+        throw std::system_error(header.error());
+    }
+    vlog(
+      s3_log.trace,
+      "send https request:\n{}",
+      http::redacted_header(header.value()));
+    auto ref = co_await _client.request(std::move(header.value()), timeout);
+    auto res = co_await drain_response_stream(ref);
+    auto status = ref->get_headers().result();
+    if (
+      status != boost::beast::http::status::ok
+      && status != boost::beast::http::status::no_content) { // expect 204
+        vlog(s3_log.warn, "S3 replied with error: {}", ref->get_headers());
+        co_await parse_rest_error_response<>(std::move(res));
+    }
+}
+
 client_pool::client_pool(
   size_t size, configuration conf, client_pool_overdraft_policy policy)
   : _max_size(size)
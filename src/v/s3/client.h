@@ -44,6 +44,23 @@ struct object_tag {
     ss::sstring value;
 };
 
+/// Inclusive range of bytes requested from an object
+struct byte_range {
+    uint64_t first;
+    uint64_t last;
+};
+
+/// Identifier of the multipart upload returned by 'CreateMultipartUpload'
+using upload_id = named_type<ss::sstring, struct s3_upload_id>;
+
+/// Part of the multipart upload that was accepted by the server
+struct completed_part {
+    /// Part number (1-based)
+    size_t part_number;
+    /// ETag returned by 'UploadPart'
+    ss::sstring etag;
+};
+
 /// List of default overrides that can be used to workaround issues
 /// that can arise when we want to deal with different S3 API implementations
 /// and different OS issues (like different truststore locations on different
@@ -122,9 +139,12 @@ public:
     ///
     /// \param name is a bucket that has the object
     /// \param key is an object name
+    /// \param range is an optional range of bytes to fetch
     /// \return initialized and signed http header or error
-    result<http::client::request_header>
-    make_get_object_request(bucket_name const& name, object_key const& key);
+    result<http::client::request_header> make_get_object_request(
+      bucket_name const& name,
+      object_key const& key,
+      std::optional<byte_range> range = std::nullopt);
 
     /// \brief Create a 'HeadObject' request header
     ///
@@ -155,6 +175,55 @@ public:
       std::optional<object_key> start_after,
       std::optional<size_t> max_keys);
 
+    /// \brief Create a 'CreateMultipartUpload' request header
+    ///
+    /// \param name is a bucket that should be used to store new object
+    /// \param key is an object name
+    /// \param tags is a set of tags applied to the resulting object
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_create_multipart_upload_request(
+      bucket_name const& name,
+      object_key const& key,
+      const std::vector<object_tag>& tags);
+
+    /// \brief Create unsigned 'UploadPart' request header
+    ///
+    /// \param name is a bucket name
+    /// \param key is an object name
+    /// \param id is an id of the multipart upload
+    /// \param part_number is a 1-based index of the part
+    /// \param payload_size_bytes is a size of the part in bytes
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_unsigned_upload_part_request(
+      bucket_name const& name,
+      object_key const& key,
+      upload_id const& id,
+      size_t part_number,
+      size_t payload_size_bytes);
+
+    /// \brief Create a 'CompleteMultipartUpload' request header
+    ///
+    /// \param name is a bucket name
+    /// \param key is an object name
+    /// \param id is an id of the multipart upload
+    /// \param payload_size_bytes is a size of the xml body with parts list
+    /// \return initialized and signed http header or error
+    result<http::client::request_header>
+    make_complete_multipart_upload_request(
+      bucket_name const& name,
+      object_key const& key,
+      upload_id const& id,
+      size_t payload_size_bytes);
+
+    /// \brief Create an 'AbortMultipartUpload' request header
+    ///
+    /// \param name is a bucket name
+    /// \param key is an object name
+    /// \param id is an id of the multipart upload
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_abort_multipart_upload_request(
+      bucket_name const& name, object_key const& key, upload_id const& id);
+
 private:
     access_point_uri _ap;
     /// Applies credentials to http requests by adding headers and signing
@@ -185,11 +254,14 @@ public:
     ///
     /// \param name is a bucket name
     /// \param key is an object key
+    /// \param range is an optional range of bytes to download, if set only
+    ///        these bytes are returned in the body
     /// \return future that gets ready after request was sent
     ss::future<http::client::response_stream_ref> get_object(
       bucket_name const& name,
       object_key const& key,
-      const ss::lowres_clock::duration& timeout);
+      const ss::lowres_clock::duration& timeout,
+      std::optional<byte_range> range = std::nullopt);
 
     struct head_object_result {
         uint64_t object_size;
@@ -243,6 +315,59 @@ public:
       const object_key& key,
       const ss::lowres_clock::duration& timeout);
 
+    /// Start multipart upload.
+    /// \param name is a bucket name
+    /// \param key is an id of the resulting object
+    /// \param tags is a set of tags applied to the resulting object
+    /// \return future that returns id of the new multipart upload
+    ss::future<upload_id> create_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const std::vector<object_tag>& tags,
+      const ss::lowres_clock::duration& timeout);
+
+    /// Upload single part of the multipart upload.
+    /// Parts can be uploaded in any order and in parallel, a part
+    /// can be re-uploaded if the previous attempt failed.
+    /// \param name is a bucket name
+    /// \param key is an id of the resulting object
+    /// \param id is an id of the multipart upload
+    /// \param part_number is a 1-based index of the part
+    /// \param payload_size is a size of the part in bytes
+    /// \param body is an input_stream that can be used to read the part
+    /// \return future that returns ETag of the uploaded part
+    ss::future<ss::sstring> upload_part(
+      bucket_name const& name,
+      object_key const& key,
+      upload_id const& id,
+      size_t part_number,
+      size_t payload_size,
+      ss::input_stream<char>&& body,
+      const ss::lowres_clock::duration& timeout);
+
+    /// Complete multipart upload by assembling the object from the parts.
+    /// \param name is a bucket name
+    /// \param key is an id of the resulting object
+    /// \param id is an id of the multipart upload
+    /// \param parts is a list of uploaded parts ordered by part number
+    /// \return future that becomes ready when the object is assembled
+    ss::future<> complete_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      upload_id const& id,
+      const std::vector<completed_part>& parts,
+      const ss::lowres_clock::duration& timeout);
+
+    /// Abort multipart upload and release storage used by the parts.
+    /// \param name is a bucket name
+    /// \param key is an id of the resulting object
+    /// \param id is an id of the multipart upload
+    ss::future<> abort_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      upload_id const& id,
+      const ss::lowres_clock::duration& timeout);
+
 private:
     request_creator _requestor;
     http::client _client;
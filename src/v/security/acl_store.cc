@@ -14,6 +14,8 @@
 
 #include <absl/container/flat_hash_map.h>
 
+#include <algorithm>
+
 namespace security {
 
 std::optional<std::reference_wrapper<const acl_entry>> acl_entry_set::find(
@@ -41,6 +43,55 @@ std::optional<std::reference_wrapper<const acl_entry>> acl_entry_set::find(
     return std::nullopt;
 }
 
+const prefix_trie::node* prefix_trie::node::find_child(char c) const {
+    auto it = std::lower_bound(
+      children.begin(),
+      children.end(),
+      c,
+      [](const std::unique_ptr<node>& n, char c) { return n->label[0] < c; });
+    if (it == children.end() || (*it)->label[0] != c) {
+        return nullptr;
+    }
+    return it->get();
+}
+
+void prefix_trie::insert(std::string_view name) {
+    node* n = &_root;
+    while (!name.empty()) {
+        auto it = std::lower_bound(
+          n->children.begin(),
+          n->children.end(),
+          name[0],
+          [](const std::unique_ptr<node>& c, char ch) {
+              return c->label[0] < ch;
+          });
+        if (it == n->children.end() || (*it)->label[0] != name[0]) {
+            auto child = std::make_unique<node>();
+            child->label = ss::sstring(name);
+            child->terminal = true;
+            n->children.insert(it, std::move(child));
+            return;
+        }
+        std::string_view label((*it)->label);
+        const auto common = static_cast<size_t>(
+          std::mismatch(label.begin(), label.end(), name.begin(), name.end())
+            .first
+          - label.begin());
+        if (common < label.size()) {
+            // split the edge, the new node holds the common part of the label
+            auto split = std::make_unique<node>();
+            split->label = ss::sstring(label.substr(0, common));
+            auto child = std::move(*it);
+            child->label = ss::sstring(label.substr(common));
+            split->children.push_back(std::move(child));
+            *it = std::move(split);
+        }
+        name.remove_prefix(common);
+        n = it->get();
+    }
+    n->terminal = true;
+}
+
 bool acl_matches::empty() const {
     if (wildcards && !wildcards->get().empty()) {
         return false;
@@ -100,23 +151,16 @@ acl_store::find(resource_type resource, const ss::sstring& name) const {
         literals = it->second;
     }
 
-    /*
-     * the acls are sorted within (resource-type, pattern-type) bounds by name
-     * in reverse order so longer names (prefixes) appear first.
-     */
     std::vector<acl_matches::entry_set_ref> prefixes;
-    {
-        auto it = _acls.lower_bound(
-          resource_pattern(resource, name, pattern_type::prefixed));
-
-        auto end = _acls.upper_bound(resource_pattern(
-          resource, name.substr(0, 1), pattern_type::prefixed));
-
-        for (; it != end; ++it) {
-            if (std::string_view(name).starts_with(it->first.name())) {
-                prefixes.emplace_back(it->second);
-            }
-        }
+    if (auto trie = _prefixes.find(resource); trie != _prefixes.end()) {
+        trie->second.for_each_prefix(
+          name, [this, resource, &prefixes](std::string_view prefix) {
+              const auto it = _acls.find(resource_pattern(
+                resource, ss::sstring(prefix), pattern_type::prefixed));
+              if (it != _acls.end()) {
+                  prefixes.emplace_back(it->second);
+              }
+          });
     }
 
     return acl_matches(wildcards, literals, std::move(prefixes));
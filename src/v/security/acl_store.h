@@ -12,8 +12,12 @@
 #include "security/acl.h"
 
 #include <absl/container/btree_map.h>
+#include <absl/container/flat_hash_map.h>
 #include <absl/container/flat_hash_set.h>
 
+#include <memory>
+#include <string_view>
+
 namespace security {
 
 /*
@@ -103,6 +107,56 @@ private:
     std::vector<entry_set_ref> prefixes;
 };
 
+/*
+ * Index of the names of prefixed resource patterns. The names are kept in a
+ * radix tree so that all of the patterns matching a resource name are found
+ * with a single walk over the name, independently of the number of patterns.
+ */
+class prefix_trie {
+public:
+    void insert(std::string_view name);
+
+    /*
+     * Invoke the function for every inserted name which is a prefix of the
+     * given name, including the name itself, shortest first.
+     */
+    template<typename Func>
+    void for_each_prefix(std::string_view name, Func&& f) const {
+        if (_root.terminal) {
+            f(name.substr(0, 0));
+        }
+        const node* n = &_root;
+        size_t depth = 0;
+        while (depth < name.size()) {
+            const auto* child = n->find_child(name[depth]);
+            if (
+              child == nullptr
+              || !name.substr(depth).starts_with(child->label)) {
+                return;
+            }
+            depth += child->label.size();
+            if (child->terminal) {
+                f(name.substr(0, depth));
+            }
+            n = child;
+        }
+    }
+
+private:
+    struct node {
+        // the part of the name on the edge leading to this node
+        ss::sstring label;
+        // an inserted name ends at this node
+        bool terminal{false};
+        // sorted by the first character of the label
+        std::vector<std::unique_ptr<node>> children;
+
+        const node* find_child(char c) const;
+    };
+
+    node _root;
+};
+
 /*
  * Container for ACLs.
  */
@@ -120,6 +174,10 @@ public:
             auto& entries = _acls[binding.pattern()];
             entries.insert(binding.entry());
             entries.rehash();
+            if (binding.pattern().pattern() == pattern_type::prefixed) {
+                _prefixes[binding.pattern().resource()].insert(
+                  binding.pattern().name());
+            }
         }
     }
 
@@ -155,6 +213,13 @@ private:
 
     absl::btree_map<resource_pattern, acl_entry_set, resource_pattern_compare>
       _acls;
+
+    /*
+     * names of the prefixed patterns for each resource type. entry sets are
+     * never removed from the store, so the index only grows and a name may
+     * refer to an empty entry set.
+     */
+    absl::flat_hash_map<resource_type, prefix_trie> _prefixes;
 };
 
 } // namespace security
@@ -21,9 +21,13 @@
 #include <seastar/core/sstring.hh>
 #include <seastar/util/bool_class.hh>
 
+#include <absl/container/flat_hash_map.h>
 #include <absl/container/flat_hash_set.h>
+#include <absl/hash/hash.h>
 #include <fmt/core.h>
 
+#include <string_view>
+
 namespace security {
 
 /*
@@ -36,6 +40,13 @@ namespace security {
  * perform any operation. When authorization occurs if the assocaited principal
  * is found in the set of superusers then its request will be permitted. If the
  * principal is not a superuser then normal ACL authorization applies.
+ *
+ * decision cache
+ * ==============
+ *
+ * Requests touching many partitions repeat the same authorization checks. The
+ * decisions are cached by (principal, host, operation, resource) and the cache
+ * is dropped whenever the ACLs or the superusers change.
  */
 class authorizer final {
 public:
@@ -59,6 +70,7 @@ public:
      * Add ACL bindings to the authorizer.
      */
     void add_bindings(const std::vector<acl_binding>& bindings) {
+        invalidate_decisions();
         if (unlikely(
               seclog.is_shard_zero()
               && seclog.is_enabled(ss::log_level::debug))) {
@@ -74,6 +86,9 @@ public:
      */
     std::vector<std::vector<acl_binding>> remove_bindings(
       const std::vector<acl_binding_filter>& filters, bool dry_run = false) {
+        if (!dry_run) {
+            invalidate_decisions();
+        }
         return _store.remove_bindings(filters, dry_run);
     }
 
@@ -95,7 +110,88 @@ public:
       const acl_principal& principal,
       const acl_host& host) const {
         auto type = get_resource_type<T>();
-        auto acls = _store.find(type, resource_name());
+        const decision_key_view key{
+          .principal = principal,
+          .host = host,
+          .operation = operation,
+          .type = type,
+          .name = resource_name()};
+        if (auto it = _decisions.find(key); it != _decisions.end()) {
+            return it->second;
+        }
+        auto decision = authorize(
+          type, resource_name(), operation, principal, host);
+        if (_decisions.size() >= max_cached_decisions) {
+            _decisions.clear();
+        }
+        _decisions.emplace(
+          decision_key{
+            .principal = principal,
+            .host = host,
+            .operation = operation,
+            .type = type,
+            .name = ss::sstring(resource_name())},
+          decision);
+        return decision;
+    }
+
+    size_t cached_decisions() const { return _decisions.size(); }
+
+private:
+    // the cache is dropped when it grows over the limit, the limit is well
+    // above the number of distinct checks made by the clients of a shard.
+    static constexpr size_t max_cached_decisions = 10000;
+
+    struct decision_key_view {
+        const acl_principal& principal;
+        const acl_host& host;
+        acl_operation operation;
+        resource_type type;
+        std::string_view name;
+    };
+
+    struct decision_key {
+        acl_principal principal;
+        acl_host host;
+        acl_operation operation;
+        resource_type type;
+        ss::sstring name;
+    };
+
+    struct decision_key_hash {
+        using is_transparent = void;
+
+        template<typename Key>
+        size_t operator()(const Key& k) const {
+            return absl::HashOf(
+              k.principal,
+              k.host,
+              k.operation,
+              k.type,
+              std::string_view(k.name));
+        }
+    };
+
+    struct decision_key_eq {
+        using is_transparent = void;
+
+        template<typename A, typename B>
+        bool operator()(const A& a, const B& b) const {
+            return a.operation == b.operation && a.type == b.type
+                   && std::string_view(a.name) == std::string_view(b.name)
+                   && a.principal == b.principal && a.host == b.host;
+        }
+    };
+
+    void invalidate_decisions() { _decisions.clear(); }
+
+    bool authorize(
+      resource_type type,
+      const ss::sstring& resource_name,
+      acl_operation operation,
+      const acl_principal& principal,
+      const acl_host& host) const {
+        auto acls = _store.find(type, resource_name);
 
         if (_superusers.contains(principal)) {
             return true;
@@ -121,8 +217,10 @@ public:
           });
     }
 
-private:
     acl_store _store;
+    mutable absl::
+      flat_hash_map<decision_key, bool, decision_key_hash, decision_key_eq>
+        _decisions;
 
     // The list of superusers is stored twice: once as a vector in the
     // configuration subsystem, then again has a set here for fast lookups.
@@ -133,6 +231,7 @@ private:
         // Rebuild the whole set, because an incremental change would
         // in any case involve constructing a set to do a comparison
         // between old and new.
+        invalidate_decisions();
         _superusers.clear();
         for (const auto& username : _superusers_conf()) {
             auto principal = acl_principal(principal_type::user, username);
@@ -46,6 +46,7 @@ public:
     template<typename T>
     void put(const credential_user& name, T&& credential) {
         _credentials.insert_or_assign(name, std::forward<T>(credential));
+        ++_version;
     }
 
     template<typename T>
@@ -57,6 +58,7 @@ public:
     }
 
     bool remove(const credential_user& user) {
+        ++_version;
         return _credentials.erase(user) > 0;
     }
 
@@ -67,8 +69,12 @@ public:
     const_iterator begin() const { return _credentials.cbegin(); }
     const_iterator end() const { return _credentials.cend(); }
 
+    /// Changes each time a credential is added, updated or removed
+    uint64_t version() const { return _version; }
+
 private:
     container_type _credentials;
+    uint64_t _version{0};
 };
 
 } // namespace security
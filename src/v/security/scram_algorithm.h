@@ -16,6 +16,10 @@
 #include "ssx/sformat.h"
 #include "utils/base64.h"
 
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/future.hh>
+#include <seastar/coroutine/maybe_yield.hh>
+
 #include <absl/container/node_hash_map.h>
 
 /**
@@ -303,7 +307,42 @@ public:
         return storedkey == reference_stored_key;
     }
 
+    /**
+     * Same as validate_password, but the PBKDF2 rounds yield to the reactor
+     * when it asks for preemption, so the derivation can be bounded by a
+     * semaphore and doesn't stall the shard.
+     */
+    static ss::future<bool> validate_password_async(
+      ss::sstring password,
+      bytes reference_stored_key,
+      bytes salt,
+      int iterations) {
+        bytes password_bytes(password.begin(), password.end());
+        auto salted_password = co_await hi_async(
+          std::move(password_bytes), std::move(salt), iterations);
+        auto clientkey = client_key(salted_password);
+        auto storedkey = stored_key(clientkey);
+        co_return storedkey == reference_stored_key;
+    }
+
 private:
+    static ss::future<bytes> hi_async(bytes str, bytes salt, int iterations) {
+        MacType mac(str);
+        mac.update(salt);
+        mac.update(std::array<char, 4>{0, 0, 0, 1});
+        auto u1 = mac.reset();
+        auto prev = u1;
+        auto result = u1;
+        for (int i = 2; i <= iterations; i++) {
+            mac.update(prev);
+            auto ui = mac.reset();
+            result = result ^ ui;
+            prev = ui;
+            co_await ss::coroutine::maybe_yield();
+        }
+        co_return bytes(result.begin(), result.end());
+    }
+
     static bytes salt_password(
       const ss::sstring& password, bytes_view salt, int iterations) {
         bytes password_bytes(password.begin(), password.end());
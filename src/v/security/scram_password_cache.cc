@@ -0,0 +1,101 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "security/scram_password_cache.h"
+
+#include "hashing/secure.h"
+
+#include <absl/container/flat_hash_map.h>
+
+namespace security {
+
+namespace {
+/// Compare without an early exit, so the time taken doesn't tell a client
+/// guessing passwords how many leading bytes of the digest it got right
+bool equal_constant_time(bytes_view a, bytes_view b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    uint8_t diff = 0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        diff |= a[i] ^ b[i];
+    }
+    return diff == 0;
+}
+} // namespace
+
+bytes scram_password_cache::digest(
+  const ss::sstring& password, const scram_credential& credential) {
+    hmac_sha256 mac(credential.salt());
+    mac.update(password);
+    auto digest = mac.reset();
+    return bytes(digest.begin(), digest.end());
+}
+
+void scram_password_cache::sync(const credential_store& store) {
+    if (store.version() != _credentials_version) {
+        _entries.clear();
+        _credentials_version = store.version();
+    }
+}
+
+bool scram_password_cache::contains(
+  const credential_user& user,
+  const ss::sstring& password,
+  const scram_credential& credential,
+  clock_type::time_point now) {
+    auto it = _entries.find(user);
+    if (it == _entries.end()) {
+        ++_misses;
+        return false;
+    }
+    if (
+      it->second.expires <= now
+      || it->second.stored_key != credential.stored_key()
+      || it->second.iterations != credential.iterations()) {
+        _entries.erase(it);
+        ++_misses;
+        return false;
+    }
+    if (!equal_constant_time(
+          it->second.digest, digest(password, credential))) {
+        ++_misses;
+        return false;
+    }
+    ++_hits;
+    return true;
+}
+
+void scram_password_cache::insert(
+  const credential_user& user,
+  const ss::sstring& password,
+  const scram_credential& credential,
+  clock_type::time_point now) {
+    if (_capacity == 0) {
+        return;
+    }
+    if (!_entries.contains(user) && _entries.size() >= _capacity) {
+        absl::erase_if(
+          _entries, [now](const auto& e) { return e.second.expires <= now; });
+        if (_entries.size() >= _capacity) {
+            _entries.erase(_entries.begin());
+        }
+    }
+    _entries.insert_or_assign(
+      user,
+      entry{
+        .digest = digest(password, credential),
+        .iterations = credential.iterations(),
+        .stored_key = credential.stored_key(),
+        .expires = now + _ttl,
+      });
+}
+
+} // namespace security
@@ -0,0 +1,97 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+#include "bytes/bytes.h"
+#include "security/credential_store.h"
+#include "security/scram_credential.h"
+#include "seastarx.h"
+
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/sstring.hh>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <chrono>
+
+namespace security {
+
+/*
+ * Cache of passwords verified against SCRAM credentials.
+ *
+ * Validating a plain text password (e.g. HTTP basic auth) derives the salted
+ * password with PBKDF2, which by design costs thousands of HMAC rounds. When
+ * many clients connect at once the derivation monopolizes the reactor. The
+ * cache remembers, for each user, a single round HMAC of the last password
+ * verified with the credential salt, together with the stored key of the
+ * credential it was verified against.
+ *
+ * The entry is a much cheaper target for brute forcing than the credential,
+ * so it is only kept for a limited time and the whole cache is dropped as
+ * soon as the credential store changes (user updated or deleted).
+ *
+ * Only successful validations are inserted, a client guessing passwords can't
+ * evict the entries of legitimate users and always pays the full derivation.
+ */
+class scram_password_cache {
+public:
+    using clock_type = ss::lowres_clock;
+
+    static constexpr size_t default_capacity = 1000;
+    static constexpr clock_type::duration default_ttl = std::chrono::minutes(5);
+
+    explicit scram_password_cache(
+      size_t capacity = default_capacity,
+      clock_type::duration ttl = default_ttl)
+      : _capacity(capacity)
+      , _ttl(ttl) {}
+
+    /// Drop all entries if the credential store changed since the last call
+    void sync(const credential_store&);
+
+    /// True if the password was verified for the user's credential before
+    bool contains(
+      const credential_user&,
+      const ss::sstring& password,
+      const scram_credential&,
+      clock_type::time_point now = clock_type::now());
+
+    /// Remember the password verified for the user's credential
+    void insert(
+      const credential_user&,
+      const ss::sstring& password,
+      const scram_credential&,
+      clock_type::time_point now = clock_type::now());
+
+    void clear() { _entries.clear(); }
+
+    size_t size() const { return _entries.size(); }
+    uint64_t hits() const { return _hits; }
+    uint64_t misses() const { return _misses; }
+
+private:
+    struct entry {
+        bytes digest;
+        int iterations;
+        bytes stored_key;
+        clock_type::time_point expires;
+    };
+
+    static bytes digest(const ss::sstring& password, const scram_credential&);
+
+    size_t _capacity;
+    clock_type::duration _ttl;
+    absl::flat_hash_map<credential_user, entry> _entries;
+    uint64_t _credentials_version{0};
+    uint64_t _hits{0};
+    uint64_t _misses{0};
+};
+
+} // namespace security
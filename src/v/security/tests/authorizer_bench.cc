@@ -0,0 +1,117 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "config/mock_property.h"
+#include "security/acl_store.h"
+#include "security/authorizer.h"
+
+#include <seastar/core/reactor.hh>
+#include <seastar/testing/perf_tests.hh>
+
+#include <fmt/format.h>
+
+#include <vector>
+
+using namespace security; // NOLINT
+
+namespace {
+
+constexpr size_t acl_count = 100000;
+constexpr size_t lookups = 1000;
+
+const acl_principal user(principal_type::user, "alice");
+const acl_host host("192.168.0.1");
+
+/*
+ * Half of the ACLs are literal and half are prefixed. Prefixed patterns are
+ * nested so that every name has a few matching prefixes.
+ */
+std::vector<acl_binding> make_bindings() {
+    std::vector<acl_binding> bindings;
+    bindings.reserve(acl_count);
+    acl_entry allow_read(
+      acl_principal(principal_type::user, "alice"),
+      acl_wildcard_host,
+      acl_operation::read,
+      acl_permission::allow);
+    for (size_t i = 0; i < acl_count / 2; ++i) {
+        bindings.emplace_back(
+          resource_pattern(
+            resource_type::topic,
+            fmt::format("topic-{}", i),
+            pattern_type::literal),
+          allow_read);
+        bindings.emplace_back(
+          resource_pattern(
+            resource_type::topic,
+            fmt::format("prefix-{}", i),
+            pattern_type::prefixed),
+          allow_read);
+    }
+    return bindings;
+}
+
+std::vector<model::topic> make_topics() {
+    std::vector<model::topic> topics;
+    topics.reserve(lookups);
+    for (size_t i = 0; i < lookups; ++i) {
+        auto n = i * (acl_count / 2 / lookups);
+        if (i % 2 == 0) {
+            topics.emplace_back(fmt::format("topic-{}", n));
+        } else {
+            topics.emplace_back(fmt::format("prefix-{}-partition", n));
+        }
+    }
+    return topics;
+}
+
+struct acl_fixture {
+    acl_fixture()
+      : topics(make_topics())
+      , auth(
+          authorizer::allow_empty_matches::no,
+          [] {
+              return config::mock_binding<std::vector<ss::sstring>>(
+                std::vector<ss::sstring>{});
+          }) {
+        auto bindings = make_bindings();
+        store.add_bindings(bindings);
+        auth.add_bindings(bindings);
+    }
+
+    std::vector<model::topic> topics;
+    acl_store store;
+    authorizer auth;
+};
+
+} // namespace
+
+PERF_TEST_F(acl_fixture, acl_store_find_100k) {
+    perf_tests::start_measuring_time();
+    for (const auto& topic : topics) {
+        perf_tests::do_not_optimize(
+          store.find(resource_type::topic, topic()).empty());
+    }
+    perf_tests::stop_measuring_time();
+    return lookups;
+}
+
+PERF_TEST_F(acl_fixture, authorizer_cached_100k) {
+    // populate the decision cache
+    for (const auto& topic : topics) {
+        auth.authorized(topic, acl_operation::read, user, host);
+    }
+    perf_tests::start_measuring_time();
+    for (const auto& topic : topics) {
+        perf_tests::do_not_optimize(
+          auth.authorized(topic, acl_operation::read, user, host));
+    }
+    perf_tests::stop_measuring_time();
+    return lookups;
+}
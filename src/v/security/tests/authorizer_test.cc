@@ -898,4 +898,76 @@ BOOST_AUTO_TEST_CASE(topic_group_same_name) {
       kafka::group_id("topic-foo-xxx"), acl_operation::read, user, host));
 }
 
+BOOST_AUTO_TEST_CASE(nested_prefixes) {
+    auto auth = make_test_instance();
+    acl_principal user(principal_type::user, "alice");
+    acl_host host("192.168.0.1");
+
+    std::vector<acl_binding> bindings;
+    bindings.emplace_back(
+      resource_pattern(resource_type::topic, "fo", pattern_type::prefixed),
+      allow_read_acl);
+    bindings.emplace_back(
+      resource_pattern(resource_type::topic, "foo-bar", pattern_type::prefixed),
+      deny_read_acl);
+    bindings.emplace_back(
+      resource_pattern(resource_type::topic, "foo-baz", pattern_type::prefixed),
+      allow_write_acl);
+    bindings.emplace_back(
+      resource_pattern(resource_type::topic, "bar", pattern_type::prefixed),
+      allow_write_acl);
+    auth.add_bindings(bindings);
+
+    auto read = [&](const char* topic) {
+        return auth.authorized(
+          model::topic(topic), acl_operation::read, user, host);
+    };
+    auto write = [&](const char* topic) {
+        return auth.authorized(
+          model::topic(topic), acl_operation::write, user, host);
+    };
+
+    BOOST_REQUIRE(read("fo"));
+    BOOST_REQUIRE(read("foo"));
+    BOOST_REQUIRE(read("foo-ba"));
+    BOOST_REQUIRE(!read("foo-bar"));
+    BOOST_REQUIRE(!read("foo-bar-1"));
+    BOOST_REQUIRE(read("foo-baz-1"));
+    BOOST_REQUIRE(!read("f"));
+    BOOST_REQUIRE(!read("bar"));
+
+    BOOST_REQUIRE(write("foo-baz"));
+    BOOST_REQUIRE(!write("foo-ba"));
+    BOOST_REQUIRE(write("bar-1"));
+    BOOST_REQUIRE(!write("ba"));
+}
+
+BOOST_AUTO_TEST_CASE(decision_cache_invalidation) {
+    auto auth = make_test_instance();
+    acl_principal user(principal_type::user, "alice");
+    acl_host host("192.168.0.1");
+    model::topic topic("foo-1");
+
+    BOOST_REQUIRE(!auth.authorized(topic, acl_operation::read, user, host));
+    BOOST_REQUIRE(!auth.authorized(topic, acl_operation::read, user, host));
+    BOOST_REQUIRE_EQUAL(auth.cached_decisions(), 1);
+
+    std::vector<acl_binding> bindings;
+    bindings.emplace_back(prefixed_resource, allow_read_acl);
+    auth.add_bindings(bindings);
+    BOOST_REQUIRE_EQUAL(auth.cached_decisions(), 0);
+    BOOST_REQUIRE(auth.authorized(topic, acl_operation::read, user, host));
+
+    // dry run doesn't change the decisions
+    std::vector<acl_binding_filter> filters;
+    filters.emplace_back(
+      resource_pattern_filter(prefixed_resource), acl_entry_filter::any());
+    auth.remove_bindings(filters, true);
+    BOOST_REQUIRE_EQUAL(auth.cached_decisions(), 1);
+
+    auth.remove_bindings(filters);
+    BOOST_REQUIRE_EQUAL(auth.cached_decisions(), 0);
+    BOOST_REQUIRE(!auth.authorized(topic, acl_operation::read, user, host));
+}
+
 } // namespace security
@@ -9,6 +9,7 @@
 #define BOOST_TEST_MODULE kafka_security
 #include "random/generators.h"
 #include "security/scram_algorithm.h"
+#include "security/scram_password_cache.h"
 #include "utils/base64.h"
 
 #include <seastar/testing/thread_test_case.hh>
@@ -304,4 +305,77 @@ BOOST_AUTO_TEST_CASE(validate_password) {
     BOOST_REQUIRE_EQUAL(check_garbage, false);
 }
 
+SEASTAR_THREAD_TEST_CASE(validate_password_async) {
+    ss::sstring password = "letmein";
+    ss::sstring garbage = "letmeout";
+    int iterations = scram_sha512::min_iterations;
+
+    auto creds = scram_sha512::make_credentials(password, iterations);
+
+    BOOST_REQUIRE(scram_sha512::validate_password_async(
+                    password, creds.stored_key(), creds.salt(), iterations)
+                    .get());
+    BOOST_REQUIRE(!scram_sha512::validate_password_async(
+                     garbage, creds.stored_key(), creds.salt(), iterations)
+                     .get());
+}
+
+BOOST_AUTO_TEST_CASE(password_cache) {
+    using namespace std::chrono_literals;
+    ss::sstring password = "letmein";
+    ss::sstring garbage = "letmeout";
+    int iterations = 3;
+    credential_user alice{"alice"};
+    credential_user bob{"bob"};
+    auto now = scram_password_cache::clock_type::now();
+
+    auto creds = scram_sha256::make_credentials(password, iterations);
+    scram_password_cache cache(2, 10s);
+
+    BOOST_REQUIRE(!cache.contains(alice, password, creds, now));
+    cache.insert(alice, password, creds, now);
+    BOOST_REQUIRE(cache.contains(alice, password, creds, now));
+    BOOST_REQUIRE(!cache.contains(alice, garbage, creds, now));
+    BOOST_REQUIRE(!cache.contains(bob, password, creds, now));
+
+    // same salt with a different stored key isn't trusted and drops the entry
+    auto updated = scram_sha256::make_credentials(password, iterations);
+    scram_credential forged(
+      creds.salt(),
+      updated.server_key(),
+      updated.stored_key(),
+      creds.iterations());
+    BOOST_REQUIRE(!cache.contains(alice, password, forged, now));
+    BOOST_REQUIRE(!cache.contains(alice, password, creds, now));
+
+    // entries expire
+    cache.insert(alice, password, creds, now);
+    BOOST_REQUIRE(cache.contains(alice, password, creds, now + 9s));
+    BOOST_REQUIRE(!cache.contains(alice, password, creds, now + 10s));
+    BOOST_REQUIRE_EQUAL(cache.size(), 0);
+
+    // the cache is bounded
+    cache.insert(alice, password, creds, now);
+    cache.insert(bob, password, updated, now);
+    cache.insert(
+      credential_user{"carol"},
+      garbage,
+      scram_sha512::make_credentials(garbage, iterations),
+      now);
+    BOOST_REQUIRE_EQUAL(cache.size(), 2);
+    BOOST_REQUIRE_EQUAL(cache.hits(), 2);
+
+    // any change to the credential store drops the cache
+    credential_store store;
+    cache.sync(store);
+    BOOST_REQUIRE_EQUAL(cache.size(), 2);
+    store.put(alice, creds);
+    cache.sync(store);
+    BOOST_REQUIRE_EQUAL(cache.size(), 0);
+    cache.insert(alice, password, creds, now);
+    store.remove(alice);
+    cache.sync(store);
+    BOOST_REQUIRE_EQUAL(cache.size(), 0);
+}
+
 } // namespace security
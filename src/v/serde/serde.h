@@ -33,6 +33,7 @@
 #include <absl/container/node_hash_map.h>
 #include <absl/container/node_hash_set.h>
 
+#include <bit>
 #include <chrono>
 #include <iosfwd>
 #include <numeric>
@@ -170,6 +171,33 @@ inline constexpr auto const is_serde_compatible_v
     || is_std_unordered_map<T>
     || is_fragmented_vector<T> || reflection::is_tristate<T> || std::is_same_v<T, ss::net::inet_address>;
 
+/*
+ * Types whose serialized form is identical to their in-memory representation.
+ * Vectors of these types are written and read with a single copy of each
+ * contiguous range of elements instead of an element by element recursion.
+ * bool is excluded since any non-zero byte must read as true, enums since
+ * they are widened to serde_enum_serialized_t.
+ */
+template<typename T>
+constexpr bool bulk_copyable() {
+    if constexpr (std::endian::native != std::endian::little) {
+        return false;
+    } else if constexpr (reflection::is_rp_named_type<T>) {
+        return std::is_trivially_copyable_v<T>
+               && sizeof(T) == sizeof(typename T::type)
+               && bulk_copyable<typename T::type>();
+    } else {
+        return (std::is_integral_v<T> && !std::is_same_v<T, bool>)
+               || (std::is_same_v<T, float>
+                   && std::numeric_limits<float>::is_iec559)
+               || (std::is_same_v<T, double>
+                   && std::numeric_limits<double>::is_iec559);
+    }
+}
+
+template<typename T>
+inline constexpr bool is_bulk_copyable_v = bulk_copyable<T>();
+
 template<typename T>
 inline constexpr auto const are_bytes_and_string_different = !(
   std::is_same_v<T, ss::sstring> && std::is_same_v<T, bytes>);
@@ -320,8 +348,14 @@ void write(iobuf& out, T t) {
               t.size()));
         }
         write(out, static_cast<serde_size_t>(t.size()));
-        for (auto& el : t) {
-            write(out, std::move(el));
+        if constexpr (is_bulk_copyable_v<typename Type::value_type>) {
+            out.append(
+              reinterpret_cast<char const*>(t.data()),
+              t.size() * sizeof(typename Type::value_type));
+        } else {
+            for (auto& el : t) {
+                write(out, std::move(el));
+            }
         }
     } else if constexpr (reflection::is_rp_named_type<Type>) {
         return write(out, static_cast<typename Type::type>(t));
@@ -388,8 +422,16 @@ void write(iobuf& out, T t) {
               t.size()));
         }
         write(out, static_cast<serde_size_t>(t.size()));
-        for (auto& el : t) {
-            write(out, std::move(el));
+        if constexpr (is_bulk_copyable_v<typename Type::value_type>) {
+            t.for_each_fragment([&out](const auto* data, size_t n) {
+                out.append(
+                  reinterpret_cast<char const*>(data),
+                  n * sizeof(typename Type::value_type));
+            });
+        } else {
+            for (auto& el : t) {
+                write(out, std::move(el));
+            }
         }
     } else if constexpr (reflection::is_tristate<T>) {
         if (t.is_disabled()) {
@@ -507,6 +549,18 @@ header read_header(iobuf_parser& in, std::size_t const bytes_left_limit) {
       ._checksum = checksum};
 }
 
+template<typename T>
+void check_bulk_read(iobuf_parser& in, size_t size) {
+    if (unlikely(in.bytes_left() < size)) {
+        throw serde_exception(fmt_with_ctx(
+          ssx::sformat,
+          "reading {} of {} bytes: {} bytes left",
+          type_str<T>(),
+          size,
+          in.bytes_left()));
+    }
+}
+
 template<typename T>
 void read_nested(iobuf_parser& in, T& t, std::size_t const bytes_left_limit) {
     using Type = std::decay_t<T>;
@@ -603,9 +657,16 @@ void read_nested(iobuf_parser& in, T& t, std::size_t const bytes_left_limit) {
     } else if constexpr (reflection::is_std_vector<Type>) {
         using value_type = typename Type::value_type;
         const auto size = read_nested<serde_size_t>(in, bytes_left_limit);
-        t.reserve(size);
-        for (auto i = 0U; i < size; ++i) {
-            t.push_back(read_nested<value_type>(in, bytes_left_limit));
+        if constexpr (is_bulk_copyable_v<value_type>) {
+            check_bulk_read<Type>(in, size * sizeof(value_type));
+            t.resize(size);
+            in.consume_to(
+              size * sizeof(value_type), reinterpret_cast<char*>(t.data()));
+        } else {
+            t.reserve(size);
+            for (auto i = 0U; i < size; ++i) {
+                t.push_back(read_nested<value_type>(in, bytes_left_limit));
+            }
         }
     } else if constexpr (reflection::is_rp_named_type<Type>) {
         t = Type{read_nested<typename Type::type>(in, bytes_left_limit)};
@@ -667,8 +728,16 @@ void read_nested(iobuf_parser& in, T& t, std::size_t const bytes_left_limit) {
     } else if constexpr (is_fragmented_vector<Type>) {
         using value_type = typename Type::value_type;
         const auto size = read_nested<serde_size_t>(in, bytes_left_limit);
-        for (auto i = 0U; i < size; ++i) {
-            t.push_back(read_nested<value_type>(in, bytes_left_limit));
+        if constexpr (is_bulk_copyable_v<value_type>) {
+            check_bulk_read<Type>(in, size * sizeof(value_type));
+            t.append(size, [&in](value_type* data, size_t n) {
+                in.consume_to(
+                  n * sizeof(value_type), reinterpret_cast<char*>(data));
+            });
+        } else {
+            for (auto i = 0U; i < size; ++i) {
+                t.push_back(read_nested<value_type>(in, bytes_left_limit));
+            }
         }
         t.shrink_to_fit();
     } else if constexpr (is_chrono_duration<Type>) {
@@ -0,0 +1,217 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#pragma once
+
+#include "serde/serde.h"
+
+#include <array>
+#include <optional>
+#include <tuple>
+#include <utility>
+
+namespace serde {
+
+template<typename T>
+inline constexpr size_t envelope_header_size
+  = 2 * sizeof(version_t) + sizeof(serde_size_t)
+    + (is_checksum_envelope<T> ? sizeof(checksum_t) : 0);
+
+template<typename T>
+constexpr std::optional<size_t> fixed_serialized_size();
+
+namespace detail {
+
+template<typename Tuple, size_t... I>
+constexpr std::optional<size_t>
+fixed_fields_size(std::index_sequence<I...>) {
+    constexpr std::array<std::optional<size_t>, sizeof...(I)> sizes{
+      fixed_serialized_size<std::tuple_element_t<I, Tuple>>()...};
+    size_t total = 0;
+    for (const auto& s : sizes) {
+        if (!s) {
+            return std::nullopt;
+        }
+        total += *s;
+    }
+    return total;
+}
+
+template<typename T>
+using envelope_fields_t = decltype(envelope_to_tuple(std::declval<T&>()));
+
+inline void
+add_size(std::optional<size_t>& total, std::optional<size_t> size) {
+    if (total && size) {
+        *total += *size;
+    } else {
+        total = std::nullopt;
+    }
+}
+
+} // namespace detail
+
+/// Sum of serialized sizes, std::nullopt if any of them is unknown
+template<typename... Sizes>
+std::optional<size_t> sum_sizes(Sizes... sizes) {
+    std::optional<size_t> total = 0;
+    (detail::add_size(total, sizes), ...);
+    return total;
+}
+
+/*
+ * Size of the serialized form of T when it doesn't depend on the value, i.e.
+ * for scalars and envelopes made of such types, std::nullopt otherwise.
+ * Envelopes with custom serde_write are never of fixed size.
+ */
+template<typename T>
+constexpr std::optional<size_t> fixed_serialized_size() {
+    using Type = std::decay_t<T>;
+    if constexpr (has_serde_write<Type> || has_serde_async_write<Type>) {
+        return std::nullopt;
+    } else if constexpr (is_envelope<Type>) {
+        using fields = detail::envelope_fields_t<Type>;
+        auto size = detail::fixed_fields_size<fields>(
+          std::make_index_sequence<std::tuple_size_v<fields>>{});
+        if (!size) {
+            return std::nullopt;
+        }
+        return envelope_header_size<Type> + *size;
+    } else if constexpr (
+      std::is_same_v<Type, bool> || reflection::is_ss_bool_class<Type>) {
+        return sizeof(int8_t);
+    } else if constexpr (serde_is_enum_v<Type>) {
+        return sizeof(serde_enum_serialized_t);
+    } else if constexpr (std::is_scalar_v<Type>) {
+        return sizeof(Type);
+    } else if constexpr (reflection::is_rp_named_type<Type>) {
+        return fixed_serialized_size<typename Type::type>();
+    } else if constexpr (is_chrono_duration<Type>) {
+        return sizeof(int64_t);
+    } else {
+        return std::nullopt;
+    }
+}
+
+namespace detail {
+
+/// Implements serialized_size(), iobuf payloads are only counted if
+/// WithPayloads is set
+template<bool WithPayloads, typename T>
+std::optional<size_t> serialized_size(const T& t) {
+    using Type = std::decay_t<T>;
+    constexpr auto fixed = fixed_serialized_size<Type>();
+    if constexpr (fixed.has_value()) {
+        return *fixed;
+    } else if constexpr (
+      has_serde_write<Type> || has_serde_async_write<Type>) {
+        return std::nullopt;
+    } else if constexpr (is_envelope<Type>) {
+        std::optional<size_t> total = envelope_header_size<Type>;
+        // serde_fields() isn't const qualified, the fields are only read
+        std::apply(
+          [&total](const auto&... f) {
+              (add_size(total, serialized_size<WithPayloads>(f)), ...);
+          },
+          envelope_to_tuple(const_cast<Type&>(t)));
+        return total;
+    } else if constexpr (
+      reflection::is_std_vector<Type> || is_fragmented_vector<Type>) {
+        using value_type = typename Type::value_type;
+        constexpr auto fixed_element = fixed_serialized_size<value_type>();
+        std::optional<size_t> total = sizeof(serde_size_t);
+        if constexpr (fixed_element.has_value()) {
+            *total += t.size() * *fixed_element;
+        } else {
+            for (const auto& e : t) {
+                detail::add_size(total, serialized_size<WithPayloads>(e));
+            }
+        }
+        return total;
+    } else if constexpr (reflection::is_rp_named_type<Type>) {
+        return serialized_size<WithPayloads>(t());
+    } else if constexpr (std::is_same_v<Type, iobuf>) {
+        return sizeof(serde_size_t) + (WithPayloads ? t.size_bytes() : 0);
+    } else if constexpr (
+      std::is_same_v<Type, ss::sstring> || std::is_same_v<Type, bytes>) {
+        return sizeof(serde_size_t) + t.size();
+    } else if constexpr (reflection::is_std_optional<Type>) {
+        std::optional<size_t> total = sizeof(int8_t);
+        if (t) {
+            detail::add_size(total, serialized_size<WithPayloads>(*t));
+        }
+        return total;
+    } else if constexpr (reflection::is_tristate<Type>) {
+        std::optional<size_t> total = sizeof(int8_t);
+        if (t.has_value()) {
+            add_size(total, serialized_size<WithPayloads>(t.value()));
+        }
+        return total;
+    } else if constexpr (
+      is_absl_node_hash_set<Type> || is_absl_btree_set<Type>) {
+        std::optional<size_t> total = sizeof(serde_size_t);
+        for (const auto& e : t) {
+            detail::add_size(total, serialized_size<WithPayloads>(e));
+        }
+        return total;
+    } else if constexpr (
+      is_absl_node_hash_map<Type> || is_absl_flat_hash_map<Type>
+      || is_std_unordered_map<Type>) {
+        std::optional<size_t> total = sizeof(serde_size_t);
+        for (const auto& [k, v] : t) {
+            detail::add_size(total, serialized_size<WithPayloads>(k));
+            detail::add_size(total, serialized_size<WithPayloads>(v));
+        }
+        return total;
+    } else if constexpr (std::is_same_v<Type, ss::net::inet_address>) {
+        return sizeof(int8_t) + sizeof(serde_size_t) + t.size();
+    } else {
+        return std::nullopt;
+    }
+}
+
+} // namespace detail
+
+/*
+ * Exact number of bytes serde::write(out, t) appends to out. Returns
+ * std::nullopt when t contains an envelope with custom serde_write, whose
+ * size is only known after writing it, or a type with an ADL write helper
+ * which doesn't provide a matching ADL serialized_size helper.
+ */
+template<typename T>
+std::optional<size_t> serialized_size(const T& t) {
+    return detail::serialized_size<true>(t);
+}
+
+/*
+ * Size write_reserved() reserves for t: serialized_size() without the iobuf
+ * payloads, which are appended by sharing their fragments rather than
+ * copied into the reservation.
+ */
+template<typename T>
+std::optional<size_t> reserved_size(const T& t) {
+    return detail::serialized_size<false>(t);
+}
+
+/*
+ * Two pass write: compute the serialized size first and reserve it so that
+ * the message is written into a single fragment (or into as few fragments of
+ * the maximum allocation size as possible for large messages) instead of
+ * growing the buffer while writing. iobuf fields are still appended by
+ * sharing their fragments, only their size prefix is reserved.
+ */
+template<typename T>
+void write_reserved(iobuf& out, T t) {
+    if (auto size = reserved_size(t); size && *size > 0) {
+        out.reserve_memory(*size);
+    }
+    write(out, std::move(t));
+}
+
+} // namespace serde
@@ -88,3 +88,71 @@ PERF_TEST(big_10mb, serialize) {
 PERF_TEST(big_10mb, deserialize) {
     return deserialize_big(10 << 20 /*10MB*/, 1 << 15 /*32KB*/);
 }
+
+/*
+ * Vectors of integers are encoded with a bulk copy. Durations have the same
+ * encoding but go through the element by element path, serving as the
+ * baseline.
+ */
+constexpr size_t vector_elements = 100000;
+
+template<typename T>
+inline T gen_vector() {
+    T ret;
+    for (size_t i = 0; i < vector_elements; ++i) {
+        ret.push_back(typename T::value_type(i));
+    }
+    return ret;
+}
+
+template<typename T>
+inline size_t serialize_vector() {
+    auto v = gen_vector<T>();
+    perf_tests::start_measuring_time();
+    auto o = serde::to_iobuf(std::move(v));
+    perf_tests::do_not_optimize(o);
+    perf_tests::stop_measuring_time();
+    return vector_elements;
+}
+
+template<typename T>
+inline size_t deserialize_vector() {
+    auto o = serde::to_iobuf(gen_vector<T>());
+    perf_tests::start_measuring_time();
+    auto result = serde::from_iobuf<T>(std::move(o));
+    perf_tests::do_not_optimize(result);
+    perf_tests::stop_measuring_time();
+    return vector_elements;
+}
+
+PERF_TEST(vector_int64, serialize) {
+    return serialize_vector<std::vector<int64_t>>();
+}
+
+PERF_TEST(vector_int64, deserialize) {
+    return deserialize_vector<std::vector<int64_t>>();
+}
+
+PERF_TEST(vector_duration, serialize) {
+    return serialize_vector<std::vector<std::chrono::nanoseconds>>();
+}
+
+PERF_TEST(vector_duration, deserialize) {
+    return deserialize_vector<std::vector<std::chrono::nanoseconds>>();
+}
+
+PERF_TEST(fragmented_vector_int64, serialize) {
+    return serialize_vector<fragmented_vector<int64_t>>();
+}
+
+PERF_TEST(fragmented_vector_int64, deserialize) {
+    return deserialize_vector<fragmented_vector<int64_t>>();
+}
+
+PERF_TEST(fragmented_vector_duration, serialize) {
+    return serialize_vector<fragmented_vector<std::chrono::nanoseconds>>();
+}
+
+PERF_TEST(fragmented_vector_duration, deserialize) {
+    return deserialize_vector<fragmented_vector<std::chrono::nanoseconds>>();
+}
@@ -13,6 +13,7 @@
 #include "random/generators.h"
 #include "serde/envelope.h"
 #include "serde/serde.h"
+#include "serde/serialized_size.h"
 #include "tristate.h"
 #include "utils/fragmented_vector.h"
 
@@ -23,6 +24,7 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <limits>
 #include <optional>
@@ -222,6 +224,38 @@ SEASTAR_THREAD_TEST_CASE(vector_test) {
     BOOST_CHECK((m == std::vector{1, 2, 3}));
 }
 
+SEASTAR_THREAD_TEST_CASE(vector_bulk_copy_test) {
+    static_assert(serde::is_bulk_copyable_v<int64_t>);
+    static_assert(serde::is_bulk_copyable_v<double>);
+    static_assert(serde::is_bulk_copyable_v<model::offset>);
+    static_assert(!serde::is_bulk_copyable_v<bool>);
+    static_assert(!serde::is_bulk_copyable_v<std::chrono::milliseconds>);
+
+    // the bulk encoding matches the element by element encoding
+    std::vector<model::offset> offsets{
+      model::offset(-1), model::offset(0), model::offset(1 << 20)};
+    auto expected = iobuf();
+    serde::write(expected, static_cast<serde::serde_size_t>(offsets.size()));
+    for (auto o : offsets) {
+        serde::write(expected, o);
+    }
+    BOOST_CHECK(serde::to_iobuf(offsets) == expected);
+    BOOST_CHECK(
+      serde::from_iobuf<std::vector<model::offset>>(std::move(expected))
+      == offsets);
+
+    std::vector<double> doubles{0.5, -1.25, 1e100};
+    BOOST_CHECK(
+      serde::from_iobuf<std::vector<double>>(serde::to_iobuf(doubles))
+      == doubles);
+
+    // truncated input
+    auto b = serde::to_iobuf(std::vector<int32_t>{1, 2, 3});
+    b.trim_back(1);
+    BOOST_CHECK_THROW(
+      serde::from_iobuf<std::vector<int32_t>>(std::move(b)), std::exception);
+}
+
 // struct with differing sizes:
 // vector length may take different size (vint)
 // vector data may have different size (_ints.size() * sizeof(int))
@@ -673,6 +707,76 @@ SEASTAR_THREAD_TEST_CASE(serde_fields_test_struct_test) {
       == serde_fields_test_struct{123});
 }
 
+struct sized_msg : serde::envelope<sized_msg, serde::version<1>> {
+    complex_msg complex;
+    std::optional<ss::sstring> name;
+    iobuf data;
+    model::ntp ntp;
+    absl::flat_hash_map<model::node_id, std::vector<model::offset>> offsets;
+    fragmented_vector<test_msg1> msgs;
+
+    auto serde_fields() {
+        return std::tie(complex, name, data, ntp, offsets, msgs);
+    }
+};
+
+SEASTAR_THREAD_TEST_CASE(serialized_size_test) {
+    static_assert(serde::fixed_serialized_size<int16_t>() == 2);
+    static_assert(serde::fixed_serialized_size<my_enum>() == 4);
+    static_assert(
+      serde::fixed_serialized_size<test_msg0>()
+      == serde::envelope_header_size<test_msg0> + 2);
+    static_assert(
+      serde::fixed_serialized_size<test_msg1>()
+      == serde::envelope_header_size<test_msg1>
+           + *serde::fixed_serialized_size<test_msg0>() + 12);
+    static_assert(!serde::fixed_serialized_size<complex_msg>());
+    BOOST_REQUIRE_EQUAL(
+      *serde::serialized_size(test_msg1{}),
+      serde::to_iobuf(test_msg1{}).size_bytes());
+
+    sized_msg m;
+    m.complex._vec.push_back(inner_differing_sizes{._ints = {1, 2, 3}});
+    m.complex._vec.push_back(inner_differing_sizes{});
+    m.name = "name";
+    m.data.append("data", 4);
+    m.ntp = model::ntp(
+      model::ns("ns"), model::topic("topic"), model::partition_id(1));
+    m.offsets[model::node_id(1)] = {model::offset(1), model::offset(2)};
+    m.msgs.push_back(test_msg1{});
+
+    auto expected = serde::serialized_size(m);
+    BOOST_REQUIRE(expected);
+    auto b = iobuf();
+    serde::write_reserved(b, std::move(m));
+    BOOST_REQUIRE_EQUAL(*expected, b.size_bytes());
+
+    // custom serialization has unknown size
+    BOOST_REQUIRE(!serde::serialized_size(test_snapshot_header{}));
+}
+
+SEASTAR_THREAD_TEST_CASE(write_reserved_shares_iobuf_test) {
+    constexpr size_t payload_size = 16384;
+    ss::temporary_buffer<char> payload(payload_size);
+    std::fill_n(payload.get_write(), payload_size, 'x');
+    const char* payload_data = payload.get();
+
+    sized_msg m;
+    m.name = "name";
+    m.data.append(std::move(payload));
+    BOOST_REQUIRE_EQUAL(
+      *serde::reserved_size(m), *serde::serialized_size(m) - payload_size);
+
+    auto b = iobuf();
+    serde::write_reserved(b, std::move(m));
+
+    // the payload fragment is shared, not copied into the reservation
+    auto shared = std::any_of(b.begin(), b.end(), [payload_data](auto& f) {
+        return f.get() == payload_data;
+    });
+    BOOST_REQUIRE(shared);
+}
+
 SEASTAR_THREAD_TEST_CASE(fragmented_vector_test) {
     std::vector<int> sizes(100);
     std::iota(sizes.begin(), sizes.end(), 0);
@@ -273,6 +273,8 @@ size_t batch_cache::reclaim(size_t size) {
 
     _last_reclaim = ss::lowres_clock::now();
     _size_bytes -= reclaimed;
+    ++_reclaims;
+    _reclaimed_bytes += reclaimed;
     return reclaimed;
 }
 
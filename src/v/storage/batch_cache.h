@@ -308,6 +308,13 @@ public:
      */
     bool is_memory_reclaiming() const { return _is_reclaiming; }
 
+    /// Current size of the cached data
+    size_t size_bytes() const { return _size_bytes; }
+
+    /// Number of reclaims since creation and the bytes they released
+    uint64_t reclaims() const { return _reclaims; }
+    size_t reclaimed_bytes() const { return _reclaimed_bytes; }
+
 private:
     friend batch_cache_test_fixture;
     struct batch_reclaiming_lock {
@@ -374,6 +381,8 @@ private:
     reclaimer _reclaimer;
     bool _is_reclaiming{false};
     size_t _size_bytes{0};
+    uint64_t _reclaims{0};
+    size_t _reclaimed_bytes{0};
 
     reclaim_options _reclaim_opts;
     ss::lowres_clock::time_point _last_reclaim;
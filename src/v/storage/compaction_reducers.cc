@@ -13,6 +13,7 @@
 #include "model/record.h"
 #include "model/record_batch_types.h"
 #include "model/record_utils.h"
+#include "model/record_view.h"
 #include "random/generators.h"
 #include "storage/index_state.h"
 #include "storage/logger.h"
@@ -22,6 +23,7 @@
 #include "vlog.h"
 
 #include <seastar/core/future.hh>
+#include <seastar/core/loop.hh>
 
 #include <absl/algorithm/container.h>
 #include <absl/container/flat_hash_map.h>
@@ -292,10 +294,13 @@ index_rebuilder_reducer::operator()(model::record_batch&& b) {
 
 ss::future<> index_rebuilder_reducer::do_index(model::record_batch&& b) {
     return ss::do_with(std::move(b), [this](model::record_batch& b) {
-        return model::for_each_record(
-          b,
-          [this, bt = b.header().type, o = b.base_offset()](model::record& r) {
-              return _w->index(bt, r.key(), o, r.offset_delta());
+        auto records = model::record_views(b);
+        return ss::do_for_each(
+          records.begin(),
+          records.end(),
+          [this, bt = b.header().type, o = b.base_offset()](
+            const model::record_view& r) {
+              return _w->index(bt, r.copy_key(), o, r.offset_delta());
           });
     });
 }
@@ -15,17 +15,24 @@
 #include "prometheus/prometheus_sanitize.h"
 #include "raft/types.h"
 #include "reflection/adl.h"
+#include "ssx/future-util.h"
 #include "storage/parser.h"
 #include "storage/record_batch_builder.h"
 #include "storage/segment_set.h"
 #include "storage/types.h"
+#include "utils/directory_walker.h"
 #include "vlog.h"
 
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/lowres_clock.hh>
 #include <seastar/core/metrics.hh>
 #include <seastar/core/thread.hh>
+#include <seastar/coroutine/maybe_yield.hh>
 #include <seastar/util/defer.hh>
 #include <seastar/util/log.hh>
 
+#include <regex>
+
 static ss::logger lg("kvstore");
 
 namespace storage {
@@ -38,7 +45,9 @@ kvstore::kvstore(kvstore_config kv_conf, storage_resources& resources)
       std::filesystem::path(_ntpc.work_directory()),
       simple_snapshot_manager::default_snapshot_filename,
       ss::default_priority_class())
-  , _timer([this] { _sem.signal(); }) {}
+  , _timer([this] { _sem.signal(); }) {
+    _conf.flush_threshold = std::max(_conf.flush_threshold, size_t(1));
+}
 
 ss::future<> kvstore::start() {
     vlog(lg.debug, "Starting kvstore: dir {}", _ntpc.work_directory());
@@ -59,6 +68,16 @@ ss::future<> kvstore::start() {
               "entries_written",
               [this] { return _probe.entries_written; },
               ss::metrics::description("Number of entries written")),
+            ss::metrics::make_total_operations(
+              "early_flushes",
+              [this] { return _probe.early_flushes; },
+              ss::metrics::description(
+                "Number of flushes started before the flush interval elapsed")),
+            ss::metrics::make_gauge(
+              "pending_ops",
+              [this] { return _ops.size() + _priority_ops.size(); },
+              ss::metrics::description(
+                "Number of operations waiting to be flushed")),
             ss::metrics::make_total_operations(
               "entries_removed",
               [this] { return _probe.entries_removed; },
@@ -71,6 +90,42 @@ ss::future<> kvstore::start() {
               "key_count",
               [this] { return _db.size(); },
               ss::metrics::description("Number of keys in the database")),
+            ss::metrics::make_gauge(
+              "dirty_keys",
+              [this] { return _dirty.size(); },
+              ss::metrics::description(
+                "Number of keys modified since the last snapshot delta")),
+            ss::metrics::make_total_operations(
+              "snapshots_saved",
+              [this] { return _probe.snapshots_saved; },
+              ss::metrics::description("Number of full snapshots saved")),
+            ss::metrics::make_total_operations(
+              "snapshot_deltas_saved",
+              [this] { return _probe.snapshot_deltas_saved; },
+              ss::metrics::description("Number of snapshot deltas saved")),
+            ss::metrics::make_gauge(
+              "snapshot_deltas",
+              [this] { return _deltas.size(); },
+              ss::metrics::description(
+                "Number of snapshot deltas waiting to be merged")),
+            ss::metrics::make_current_bytes(
+              "snapshot_bytes",
+              [this] { return _probe.snapshot_bytes; },
+              ss::metrics::description("Size of the last full snapshot")),
+            ss::metrics::make_total_bytes(
+              "snapshot_delta_bytes",
+              [this] { return _probe.snapshot_delta_bytes; },
+              ss::metrics::description("Bytes written as snapshot deltas")),
+            ss::metrics::make_gauge(
+              "last_snapshot_ms",
+              [this] { return _probe.last_snapshot_ms; },
+              ss::metrics::description(
+                "Time taken to write the last full snapshot")),
+            ss::metrics::make_gauge(
+              "last_snapshot_delta_ms",
+              [this] { return _probe.last_snapshot_delta_ms; },
+              ss::metrics::description(
+                "Time taken to write the last snapshot delta")),
           });
     }
 
@@ -115,10 +170,12 @@ ss::future<> kvstore::stop() {
     // flusher only operates on a snapshot of the pending ops that it takes when
     // it starts these ops begin cancelled would be ops that arrived between the
     // start of a flush and this service being stopped.
-    for (auto& op : _ops) {
-        op.done.set_exception(ss::gate_closed_exception());
+    for (auto* ops : {&_priority_ops, &_ops}) {
+        for (auto& op : *ops) {
+            op.done.set_exception(ss::gate_closed_exception());
+        }
+        ops->clear();
     }
-    _ops.clear();
 
     return f.then([this] {
         // wait until the flusher exists--it might create _segment
@@ -157,24 +214,44 @@ std::optional<iobuf> kvstore::get(key_space ks, bytes_view key) {
     return std::nullopt;
 }
 
-ss::future<> kvstore::put(key_space ks, bytes key, iobuf value) {
+ss::future<> kvstore::put(
+  key_space ks, bytes key, iobuf value, flush_priority priority) {
     _probe.entry_written();
-    return put(ks, std::move(key), std::make_optional<iobuf>(std::move(value)));
+    return put(
+      ks,
+      std::move(key),
+      std::make_optional<iobuf>(std::move(value)),
+      priority);
 }
 
 ss::future<> kvstore::remove(key_space ks, bytes key) {
     _probe.entry_removed();
-    return put(ks, std::move(key), std::nullopt);
+    return put(ks, std::move(key), std::nullopt, flush_priority::no);
 }
 
-ss::future<> kvstore::put(key_space ks, bytes key, std::optional<iobuf> value) {
+ss::future<> kvstore::put(
+  key_space ks,
+  bytes key,
+  std::optional<iobuf> value,
+  flush_priority priority) {
     vassert(_started, "kvstore has not been started");
 
     key = make_spaced_key(ks, key);
     return ss::with_gate(
-      _gate, [this, key = std::move(key), value = std::move(value)]() mutable {
-          auto& w = _ops.emplace_back(std::move(key), std::move(value));
-          if (!_timer.armed()) {
+      _gate,
+      [this,
+       priority,
+       key = std::move(key),
+       value = std::move(value)]() mutable {
+          auto& ops = priority ? _priority_ops : _ops;
+          auto& w = ops.emplace_back(std::move(key), std::move(value));
+          if (priority || _ops.size() == _conf.flush_threshold) {
+              // flush right away. if a flush is already running the pending
+              // operations are grouped into the one following it.
+              _probe.early_flush();
+              _timer.cancel();
+              _sem.signal();
+          } else if (!_timer.armed()) {
               _timer.arm(_conf.commit_interval());
           }
           return w.done.get_future();
@@ -182,8 +259,16 @@ ss::future<> kvstore::put(key_space ks, bytes key, std::optional<iobuf> value) {
 }
 
 void kvstore::apply_op(bytes key, std::optional<iobuf> value) {
+    _dirty.insert(key);
     auto it = _db.find(key);
     bool found = it != _db.end();
+    if (_capture && _capture->needs_undo(key)) {
+        std::optional<iobuf> captured;
+        if (found) {
+            captured = it->second.share(0, it->second.size_bytes());
+        }
+        _capture->undo.emplace(key, std::move(captured));
+    }
     if (value) {
         vlog(
           lg.trace,
@@ -210,13 +295,38 @@ void kvstore::apply_op(bytes key, std::optional<iobuf> value) {
     }
 }
 
+/*
+ * All of the priority operations followed by at most `flush_threshold` of the
+ * other operations. Callers write a given key with the same priority, so
+ * reordering them is safe.
+ */
+std::vector<kvstore::op> kvstore::take_ops() {
+    auto ops = std::exchange(_priority_ops, {});
+    if (ops.empty() && _ops.size() <= _conf.flush_threshold) {
+        return std::exchange(_ops, {});
+    }
+
+    auto count = std::min(_ops.size(), _conf.flush_threshold);
+    ops.reserve(ops.size() + count);
+    std::move(
+      _ops.begin(),
+      _ops.begin() + static_cast<ptrdiff_t>(count),
+      std::back_inserter(ops));
+    _ops.erase(_ops.begin(), _ops.begin() + static_cast<ptrdiff_t>(count));
+    if (!_ops.empty()) {
+        // flush the remainder right after this batch
+        _sem.signal();
+    }
+    return ops;
+}
+
 ss::future<> kvstore::flush_and_apply_ops() {
-    if (_ops.empty()) {
+    if (_ops.empty() && _priority_ops.empty()) {
         return ss::now();
     }
 
     // flush and apply whatever happens to be queued up
-    auto ops = std::exchange(_ops, {});
+    auto ops = take_ops();
 
     // build the operation batch to be logged
     storage::record_batch_builder builder(
@@ -282,17 +392,13 @@ ss::future<> kvstore::roll() {
         // cleaned-up segment.
         auto seg = std::exchange(_segment, nullptr);
         return seg->close()
-          .then([this] { return save_snapshot(); })
-          .then([seg] {
-              vlog(
-                lg.debug,
-                "Removing old segment with base offset {}",
-                seg->offsets().base_offset);
-              return ss::remove_file(seg->reader().filename()).then([seg] {
-                  return ss::remove_file(seg->index().filename());
-              });
-          })
-          .then([this] {
+          .then([this] { return save_snapshot_delta(); })
+          .then([this, seg] {
+              // kept until a full snapshot covers it
+              _rolled.push_back(rolled_segment{
+                .last_offset = seg->offsets().dirty_offset,
+                .data_path = seg->reader().filename(),
+                .index_path = seg->index().filename()});
               return make_segment(
                        _ntpc,
                        model::offset(_next_offset),
@@ -307,12 +413,111 @@ ss::future<> kvstore::roll() {
                 .then([this](ss::lw_shared_ptr<segment> seg) {
                     _segment = std::move(seg);
                 });
-          });
+          })
+          .then([this] { maybe_merge_snapshot_deltas(); });
     }
 
     return ss::now();
 }
 
+/*
+ * Serialize a snapshot batch: size_prefix + batch
+ */
+static iobuf serialize_snapshot_batch(model::record_batch batch) {
+    iobuf data;
+    auto ph = data.reserve(sizeof(int32_t));
+    reflection::serialize(data, std::move(batch));
+    auto size = ss::cpu_to_le(int32_t(data.size_bytes() - sizeof(int32_t)));
+    ph.write((const char*)&size, sizeof(size));
+    return data;
+}
+
+/*
+ * Write a serialized snapshot batch along with the last log offset it
+ * represents.
+ */
+static ss::future<> write_snapshot(
+  simple_snapshot_manager& snap, model::offset last_offset, iobuf data) {
+    return snap.start_snapshot().then(
+      [&snap, last_offset, data = std::move(data)](
+        snapshot_writer writer) mutable {
+          return ss::do_with(
+            std::move(writer),
+            [&snap, last_offset, data = std::move(data)](
+              snapshot_writer& wr) mutable {
+                iobuf meta;
+                reflection::serialize(meta, last_offset);
+
+                return wr.write_metadata(std::move(meta))
+                  .then([&wr, data = std::move(data)]() mutable {
+                      auto& os = wr.output(); // kept alive by do_with above
+                      return write_iobuf_to_output_stream(std::move(data), os);
+                  })
+                  .then([&wr] { return wr.close(); })
+                  .then([&snap, &wr]() {
+                      vlog(lg.debug, "Finishing snapshot creation");
+                      return snap.finish_snapshot(wr);
+                  });
+            });
+      });
+}
+
+/*
+ * Read the last log offset and the batch of a snapshot.
+ */
+static std::pair<model::offset, model::record_batch>
+read_snapshot_in_thread(snapshot_reader& reader) {
+    // the snapshot metadata contains the last offset represented
+    auto snap_meta = reader.read_metadata().get0();
+    iobuf_parser parser(std::move(snap_meta));
+    auto last_offset = model::offset(
+      reflection::adl<model::offset::type>{}.from(parser));
+
+    auto buf = read_iobuf_exactly(reader.input(), sizeof(int32_t)).get0();
+    if (buf.size_bytes() != sizeof(int32_t)) {
+        throw std::runtime_error(fmt::format(
+          "Failed to read snapshot size. Wanted {} bytes != {}",
+          sizeof(int32_t),
+          buf.size_bytes()));
+    }
+    auto size = reflection::from_iobuf<int32_t>(std::move(buf));
+
+    buf = read_iobuf_exactly(reader.input(), size).get0();
+    if ((int32_t)buf.size_bytes() != size) {
+        throw std::runtime_error(fmt::format(
+          "Failed to read snapshot data. Wanted {} bytes != {}",
+          size,
+          buf.size_bytes()));
+    }
+
+    auto batch = reflection::from_iobuf<model::record_batch>(std::move(buf));
+
+    auto batch_crc = model::crc_record_batch(batch);
+    if (batch.header().crc != batch_crc) {
+        throw std::runtime_error(fmt::format(
+          "Snapshot batch failed crc {} != {}", batch_crc, batch.header().crc));
+    }
+
+    auto header_crc = model::internal_header_only_crc(batch.header());
+    if (batch.header().header_crc != header_crc) {
+        throw std::runtime_error(fmt::format(
+          "Snapshot batch header failed crc {} != {}",
+          header_crc,
+          batch.header().header_crc));
+    }
+
+    return {last_offset, std::move(batch)};
+}
+
+std::filesystem::path
+kvstore::snapshot_delta_path(model::offset last_offset) const {
+    return std::filesystem::path(_ntpc.work_directory())
+           / fmt::format(
+             "{}.delta.{}",
+             simple_snapshot_manager::default_snapshot_filename,
+             last_offset);
+}
+
 ss::future<> kvstore::save_snapshot() {
     vassert(
       _next_offset >= model::offset(0),
@@ -320,54 +525,151 @@ ss::future<> kvstore::save_snapshot() {
       _next_offset);
 
     // no operations have been applied to the db
+    if (_next_offset == model::offset(0)) {
+        co_return;
+    }
+
+    // the last log offset represented in the snapshot
+    auto last_offset = _next_offset - model::offset(1);
+    vlog(lg.debug, "Creating snapshot at offset {}", last_offset);
+
+    // keys modified from here on go into the next delta
+    _dirty.clear();
+    auto start = ss::lowres_clock::now();
+    auto data = co_await build_snapshot();
+    auto size = data.size_bytes();
+
+    co_await write_snapshot(_snap, last_offset, std::move(data));
+    _probe.snapshot_saved(
+      size,
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+        ss::lowres_clock::now() - start));
+    co_await remove_merged(last_offset);
+}
+
+/*
+ * Package up the db as of the call into a serialized batch. Operations applied
+ * while the builder yields record the captured value of the keys it hasn't
+ * reached yet, those are added from the undo log at the end.
+ */
+ss::future<iobuf> kvstore::build_snapshot() {
+    vassert(!_capture, "Concurrent snapshot builds");
+    _capture = std::make_unique<snapshot_capture>();
+    auto reset = ss::defer([this] { _capture.reset(); });
+
+    storage::record_batch_builder builder(
+      model::record_batch_type::kvstore, model::offset(0));
+    auto it = _db.begin();
+    while (it != _db.end()) {
+        if (!_capture->undo.contains(it->first)) {
+            builder.add_raw_kv(
+              bytes_to_iobuf(it->first),
+              it->second.share(0, it->second.size_bytes()));
+        }
+        auto prev = it++;
+        if (it != _db.end() && ss::need_preempt()) {
+            _capture->cursor = prev->first;
+            co_await ss::coroutine::maybe_yield();
+            it = _db.upper_bound(*_capture->cursor);
+        }
+    }
+
+    // the db has been walked, nothing else needs capturing
+    auto capture = std::exchange(_capture, nullptr);
+    for (auto& [key, value] : capture->undo) {
+        if (value) {
+            builder.add_raw_kv(bytes_to_iobuf(key), std::move(*value));
+        }
+        co_await ss::coroutine::maybe_yield();
+    }
+    co_return serialize_snapshot_batch(std::move(builder).build());
+}
+
+ss::future<> kvstore::save_snapshot_delta() {
     if (_next_offset == model::offset(0)) {
         return ss::now();
     }
 
+    auto last_offset = _next_offset - model::offset(1);
     vlog(
       lg.debug,
-      "Creating snapshot at offset {}",
-      _next_offset - model::offset(1));
+      "Creating snapshot delta at offset {} with {} keys",
+      last_offset,
+      _dirty.size());
 
-    // package up the db into a batch
+    // latest value of each modified key, std::nullopt for removed keys
     storage::record_batch_builder builder(
       model::record_batch_type::kvstore, model::offset(0));
-    for (auto& entry : _db) {
+    for (const auto& key : _dirty) {
+        std::optional<iobuf> value;
+        if (auto it = _db.find(key); it != _db.end()) {
+            value = it->second.share(0, it->second.size_bytes());
+        }
         builder.add_raw_kv(
-          bytes_to_iobuf(entry.first),
-          entry.second.share(0, entry.second.size_bytes()));
+          bytes_to_iobuf(key), reflection::to_iobuf(std::move(value)));
     }
-    auto batch = std::move(builder).build();
-
-    // serialize batch: size_prefix + batch
-    iobuf data;
-    auto ph = data.reserve(sizeof(int32_t));
-    reflection::serialize(data, std::move(batch));
-    auto size = ss::cpu_to_le(int32_t(data.size_bytes() - sizeof(int32_t)));
-    ph.write((const char*)&size, sizeof(size));
+    auto data = serialize_snapshot_batch(std::move(builder).build());
+    auto size = data.size_bytes();
+    _dirty.clear();
+
+    auto start = ss::lowres_clock::now();
+    auto path = snapshot_delta_path(last_offset);
+    return ss::do_with(
+             simple_snapshot_manager(
+               path.parent_path(),
+               path.filename().string(),
+               ss::default_priority_class()),
+             [last_offset, data = std::move(data)](
+               simple_snapshot_manager& snap) mutable {
+                 return write_snapshot(snap, last_offset, std::move(data));
+             })
+      .then([this, last_offset, size, start] {
+          _deltas.push_back(last_offset);
+          _probe.snapshot_delta_saved(
+            size,
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+              ss::lowres_clock::now() - start));
+      });
+}
 
-    return _snap.start_snapshot().then(
-      [this, data = std::move(data)](snapshot_writer writer) mutable {
-          return ss::do_with(
-            std::move(writer),
-            [this, data = std::move(data)](snapshot_writer& wr) mutable {
-                // the last log offset represented in the snapshot
-                auto last_offset = _next_offset - model::offset(1);
+void kvstore::maybe_merge_snapshot_deltas() {
+    if (_merging_deltas || _deltas.size() < _conf.max_snapshot_deltas) {
+        return;
+    }
 
-                iobuf meta;
-                reflection::serialize(meta, last_offset);
+    // the database is captured right away at the offset of the last delta,
+    // the segment following it starts at the next offset. writing the
+    // snapshot out doesn't hold up flushing.
+    _merging_deltas = true;
+    auto f = ssx::spawn_with_gate_then(_gate, [this] {
+        return save_snapshot().finally([this] { _merging_deltas = false; });
+    });
+    ssx::background = f.handle_exception([](const std::exception_ptr& e) {
+        vlog(lg.warn, "Failed to merge snapshot deltas: {}", e);
+    });
+}
 
-                return wr.write_metadata(std::move(meta))
-                  .then([&wr, data = std::move(data)]() mutable {
-                      auto& os = wr.output(); // kept alive by do_with above
-                      return write_iobuf_to_output_stream(std::move(data), os);
-                  })
-                  .then([&wr] { return wr.close(); })
-                  .then([this, &wr]() {
-                      vlog(lg.debug, "Finishing snapshot creation");
-                      return _snap.finish_snapshot(wr);
-                  });
-            });
+/*
+ * Remove the snapshot deltas and the rolled segments covered by the full
+ * snapshot with the given last offset.
+ */
+ss::future<> kvstore::remove_merged(model::offset last_offset) {
+    std::vector<ss::sstring> merged;
+    while (!_deltas.empty() && _deltas.front() <= last_offset) {
+        merged.push_back(snapshot_delta_path(_deltas.front()).string());
+        _deltas.pop_front();
+    }
+    while (!_rolled.empty() && _rolled.front().last_offset <= last_offset) {
+        merged.push_back(std::move(_rolled.front().data_path));
+        merged.push_back(std::move(_rolled.front().index_path));
+        _rolled.pop_front();
+    }
+    return ss::do_with(
+      std::move(merged), [](std::vector<ss::sstring>& merged) {
+          return ss::do_for_each(merged, [](const ss::sstring& path) {
+              vlog(lg.debug, "Removing {} merged into the snapshot", path);
+              return ss::remove_file(path);
+          });
       });
 }
 
@@ -378,6 +680,7 @@ ss::future<> kvstore::recover() {
          * is found, or the offset immediately following the snapshot offset.
          */
         load_snapshot_in_thread();
+        load_snapshot_deltas_in_thread();
 
         auto dir = std::filesystem::path(_ntpc.work_directory());
         auto segments
@@ -409,50 +712,12 @@ void kvstore::load_snapshot_in_thread() {
     }
     auto close_reader = ss::defer([&reader] { reader->close().get(); });
 
-    // the snapshot metadata contains the last offset represented
-    auto snap_meta = reader->read_metadata().get0();
-    iobuf_parser parser(std::move(snap_meta));
-    auto last_offset = model::offset(
-      reflection::adl<model::offset::type>{}.from(parser));
+    auto [last_offset, batch] = read_snapshot_in_thread(*reader);
     vlog(
       lg.debug,
       "Load snapshot: loading snapshot with last offset {}",
       last_offset);
 
-    // read and restore db from snapshot
-    auto buf = read_iobuf_exactly(reader->input(), sizeof(int32_t)).get0();
-    if (buf.size_bytes() != sizeof(int32_t)) {
-        throw std::runtime_error(fmt::format(
-          "Failed to read snapshot size. Wanted {} bytes != {}",
-          sizeof(int32_t),
-          buf.size_bytes()));
-    }
-    auto size = reflection::from_iobuf<int32_t>(std::move(buf));
-
-    buf = read_iobuf_exactly(reader->input(), size).get0();
-    if ((int32_t)buf.size_bytes() != size) {
-        throw std::runtime_error(fmt::format(
-          "Failed to read snapshot data. Wanted {} bytes != {}",
-          size,
-          buf.size_bytes()));
-    }
-
-    auto batch = reflection::from_iobuf<model::record_batch>(std::move(buf));
-
-    auto batch_crc = model::crc_record_batch(batch);
-    if (batch.header().crc != batch_crc) {
-        throw std::runtime_error(fmt::format(
-          "Snapshot batch failed crc {} != {}", batch_crc, batch.header().crc));
-    }
-
-    auto header_crc = model::internal_header_only_crc(batch.header());
-    if (batch.header().header_crc != header_crc) {
-        throw std::runtime_error(fmt::format(
-          "Snapshot batch header failed crc {} != {}",
-          header_crc,
-          batch.header().header_crc));
-    }
-
     batch.for_each_record([this](model::record r) {
         auto key = iobuf_to_bytes(r.release_key());
         _probe.add_cached_bytes(key.size() + r.value().size_bytes());
@@ -469,6 +734,76 @@ void kvstore::load_snapshot_in_thread() {
     _next_offset = last_offset + model::offset(1);
 }
 
+void kvstore::load_snapshot_deltas_in_thread() {
+    _gate.check(); // early out on shutdown
+
+    auto dir = std::filesystem::path(_ntpc.work_directory());
+    std::regex delta_re(fmt::format(
+      R"(^{}\.delta\.(\d+)$)",
+      simple_snapshot_manager::default_snapshot_filename));
+    std::regex partial_re(fmt::format(
+      R"(^{}\.delta\.\d+\.partial\..*$)",
+      simple_snapshot_manager::default_snapshot_filename));
+
+    std::vector<model::offset> deltas;
+    directory_walker::walk(
+      dir.string(),
+      [&dir, &deltas, &delta_re, &partial_re](ss::directory_entry ent) {
+          if (!ent.type || *ent.type != ss::directory_entry_type::regular) {
+              return ss::now();
+          }
+          std::cmatch match;
+          if (std::regex_match(ent.name.c_str(), match, delta_re)) {
+              deltas.emplace_back(std::stoll(match[1].str()));
+          } else if (std::regex_match(ent.name.c_str(), partial_re)) {
+              return ss::remove_file((dir / ent.name.c_str()).string());
+          }
+          return ss::now();
+      })
+      .get();
+    std::sort(deltas.begin(), deltas.end());
+
+    for (auto last_offset : deltas) {
+        auto path = snapshot_delta_path(last_offset);
+
+        // already merged into the snapshot, the removal didn't complete
+        if (last_offset < _next_offset) {
+            vlog(lg.debug, "Removing merged snapshot delta {}", path.string());
+            ss::remove_file(path.string()).get();
+            continue;
+        }
+
+        simple_snapshot_manager snap(
+          dir, path.filename().string(), ss::default_priority_class());
+        auto reader = snap.open_snapshot().get0();
+        vassert(reader, "Snapshot delta {} disappeared", path.string());
+        auto close_reader = ss::defer([&reader] { reader->close().get(); });
+
+        auto [meta_offset, batch] = read_snapshot_in_thread(*reader);
+        if (meta_offset != last_offset) {
+            throw std::runtime_error(fmt::format(
+              "Snapshot delta {} has unexpected last offset {}",
+              path.string(),
+              meta_offset));
+        }
+        vlog(
+          lg.debug,
+          "Load snapshot: applying delta with last offset {} and {} keys",
+          last_offset,
+          batch.record_count());
+
+        batch.for_each_record([this](model::record r) {
+            auto key = iobuf_to_bytes(r.release_key());
+            auto value = reflection::from_iobuf<std::optional<iobuf>>(
+              r.release_value());
+            apply_op(std::move(key), std::move(value));
+        });
+
+        _deltas.push_back(last_offset);
+        _next_offset = last_offset + model::offset(1);
+    }
+}
+
 void kvstore::replay_segments_in_thread(segment_set segs) {
     vlog(
       lg.debug,
@@ -497,7 +832,7 @@ void kvstore::replay_segments_in_thread(segment_set segs) {
 
     // if no exact match was found (match == segs.end()) then all the segments
     // are old and can be deleted. the recovery loop below will be skipped, and
-    // we'll immediately gc the old segments.
+    // the old segments are removed once the snapshot below covers them.
 
     for (auto it = match; it != segs.end(); it++) {
         auto seg = *it;
@@ -527,28 +862,27 @@ void kvstore::replay_segments_in_thread(segment_set segs) {
         _gate.check();
     }
 
-    // garbage collect range: [segs.begin(), match)
+    for (auto& seg : segs) {
+        seg->close().get();
+    }
+
+    // saving a snapshot right after recovery during start-up prevents an
+    // accumulation of segments in cases where the system restarts many times
+    // without ever filling up a segment and snapshotting when rolling. they'll
+    // be removed on the next startup.
+    save_snapshot().get();
+
+    // garbage collect range: [segs.begin(), match), only once the snapshot
+    // covering it is on disk
     for (auto it = segs.begin(); it != match; it++) {
         auto seg = *it;
         vlog(
           lg.info,
           "Removing old segment with base offset {}",
           seg->offsets().base_offset);
-        seg->close().get();
         ss::remove_file(seg->reader().filename()).get();
         ss::remove_file(seg->index().filename()).get();
     }
-
-    // close the rest
-    for (auto it = match; it != segs.end(); it++) {
-        (*it)->close().get();
-    }
-
-    // saving a snapshot right after recovery during start-up prevents an
-    // accumulation of segments in cases where the system restarts many times
-    // without ever filling up a segment and snapshotting when rolling. they'll
-    // be removed on the next startup.
-    save_snapshot().get();
 }
 
 batch_consumer::consume_result kvstore::replay_consumer::accept_batch_start(
@@ -24,8 +24,13 @@
 #include <seastar/core/future.hh>
 #include <seastar/core/gate.hh>
 #include <seastar/core/timer.hh>
+#include <seastar/util/bool_class.hh>
 
+#include <absl/container/btree_map.h>
 #include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
+
+#include <deque>
 
 namespace storage {
 
@@ -49,6 +54,13 @@ namespace storage {
  * flushed to disk. Once the flush is complete the operations are applied to the
  * in-memory cache, and the associated promise is resolved.
  *
+ * The commit interval is skipped once `flush_threshold` operations are pending
+ * and for operations put with `flush_priority::yes` (raft election state).
+ * The latter are staged separately and always go into the next flush, the
+ * other operations are flushed in batches of at most `flush_threshold` so
+ * that a large backlog doesn't delay them. Operations arriving during a flush
+ * are grouped into the following one.
+ *
  * Concurrency
  * ===========
  *
@@ -60,6 +72,20 @@ namespace storage {
  * in which access to the underlying file storing the metadata was already
  * controlled.
  *
+ * Snapshots
+ * =========
+ *
+ * When a segment rolls only the keys modified since the previous snapshot are
+ * written out, as a snapshot delta holding the latest value or a tombstone of
+ * each key. Once `max_snapshot_deltas` deltas accumulate the full database is
+ * captured and written as a new snapshot in the background, after which the
+ * merged deltas are removed. Recovery loads the snapshot, applies the deltas
+ * which follow it in offset order and then replays the remaining segments.
+ *
+ * Rolled segments are only removed once a full snapshot covers them, so the
+ * snapshot and the segments following it recover the store on their own and a
+ * version which doesn't know about deltas can still start from them.
+ *
  * Limitations
  * ===========
  *
@@ -72,10 +98,17 @@ namespace storage {
  * O(#-partitions-per-core).
  */
 struct kvstore_config {
+    static constexpr size_t default_max_snapshot_deltas = 8;
+    static constexpr size_t default_flush_threshold = 512;
+
     size_t max_segment_size;
     config::binding<std::chrono::milliseconds> commit_interval;
     ss::sstring base_dir;
     debug_sanitize_files sanitize_fileops;
+    // number of snapshot deltas after which a full snapshot is written
+    size_t max_snapshot_deltas{default_max_snapshot_deltas};
+    // number of pending operations which are flushed right away
+    size_t flush_threshold{default_flush_threshold};
 
     kvstore_config(
       size_t max_segment_size,
@@ -99,13 +132,20 @@ public:
         /* your sub-system here */
     };
 
+    // flushed right away instead of waiting for the commit interval
+    using flush_priority = ss::bool_class<struct flush_priority_tag>;
+
     explicit kvstore(kvstore_config kv_conf, storage_resources&);
 
     ss::future<> start();
     ss::future<> stop();
 
     std::optional<iobuf> get(key_space ks, bytes_view key);
-    ss::future<> put(key_space ks, bytes key, iobuf value);
+    ss::future<> put(
+      key_space ks,
+      bytes key,
+      iobuf value,
+      flush_priority priority = flush_priority::no);
     ss::future<> remove(key_space ks, bytes key);
 
     bool empty() const {
@@ -138,30 +178,99 @@ private:
     /*
      * database operations are cached in `ops` and periodically flushed to the
      * current `segment` at position `next_offset` and then applied to `db`.
-     * when the segment reaches a threshold size a snapshot is saved a new
+     * when the segment reaches a threshold size a snapshot delta is saved a new
      * segment is created.
      */
     std::vector<op> _ops;
+    std::vector<op> _priority_ops;
     ss::timer<> _timer;
     ssx::semaphore _sem{0, "s/kvstore"};
     ss::lw_shared_ptr<segment> _segment;
     model::offset _next_offset;
-    absl::flat_hash_map<bytes, iobuf, bytes_type_hash, bytes_type_eq> _db;
 
-    ss::future<> put(key_space ks, bytes key, std::optional<iobuf> value);
+    /*
+     * ordered so that building a snapshot can yield and then resume after the
+     * last key it visited.
+     */
+    struct key_less {
+        using is_transparent = std::true_type;
+        bool operator()(bytes_view lhs, bytes_view rhs) const {
+            return lhs < rhs;
+        }
+    };
+    absl::btree_map<bytes, iobuf, key_less> _db;
+
+    /*
+     * keys modified since the last snapshot or snapshot delta was captured,
+     * and the last offsets of the snapshot deltas on disk in ascending order.
+     */
+    absl::flat_hash_set<bytes, bytes_type_hash, bytes_type_eq> _dirty;
+    std::deque<model::offset> _deltas;
+    bool _merging_deltas{false};
+
+    /*
+     * segments rolled since the last full snapshot, in ascending offset order.
+     */
+    struct rolled_segment {
+        model::offset last_offset;
+        ss::sstring data_path;
+        ss::sstring index_path;
+    };
+    std::deque<rolled_segment> _rolled;
+
+    /*
+     * state of the full snapshot being built. keys up to `cursor` have already
+     * been added to the snapshot. `undo` holds the captured values of the keys
+     * after it which were modified since, std::nullopt if a key didn't exist.
+     */
+    struct snapshot_capture {
+        std::optional<bytes> cursor;
+        absl::flat_hash_map<
+          bytes,
+          std::optional<iobuf>,
+          bytes_type_hash,
+          bytes_type_eq>
+          undo;
+
+        bool needs_undo(const bytes& key) const {
+            return (!cursor || key_less{}(*cursor, key))
+                   && !undo.contains(key);
+        }
+    };
+    std::unique_ptr<snapshot_capture> _capture;
+
+    ss::future<> put(
+      key_space ks,
+      bytes key,
+      std::optional<iobuf> value,
+      flush_priority priority);
+    std::vector<op> take_ops();
     void apply_op(bytes key, std::optional<iobuf> value);
     ss::future<> flush_and_apply_ops();
     ss::future<> roll();
+
+    /*
+     * Both capture the database at the offset applied when called. A delta is
+     * captured synchronously, the full snapshot is built with scheduling
+     * points while operations keep being applied.
+     */
     ss::future<> save_snapshot();
+    ss::future<iobuf> build_snapshot();
+    ss::future<> save_snapshot_delta();
+    void maybe_merge_snapshot_deltas();
+    ss::future<> remove_merged(model::offset last_offset);
+    std::filesystem::path snapshot_delta_path(model::offset) const;
 
     /*
      * Recovery
      *
      * 1. load snapshot if found
-     * 2. then recover from segments
+     * 2. apply the snapshot deltas following it
+     * 3. then recover from segments
      */
     ss::future<> recover();
     void load_snapshot_in_thread();
+    void load_snapshot_deltas_in_thread();
     void replay_segments_in_thread(segment_set);
 
     /**
@@ -199,14 +308,32 @@ private:
         void entry_fetched() { ++entries_fetched; }
         void entry_written() { ++entries_written; }
         void entry_removed() { ++entries_removed; }
+        void early_flush() { ++early_flushes; }
         void add_cached_bytes(size_t count) { cached_bytes += count; }
         void dec_cached_bytes(size_t count) { cached_bytes -= count; }
+        void snapshot_saved(size_t size, std::chrono::milliseconds took) {
+            ++snapshots_saved;
+            snapshot_bytes = size;
+            last_snapshot_ms = took.count();
+        }
+        void snapshot_delta_saved(size_t size, std::chrono::milliseconds took) {
+            ++snapshot_deltas_saved;
+            snapshot_delta_bytes += size;
+            last_snapshot_delta_ms = took.count();
+        }
 
         uint64_t segments_rolled{0};
         uint64_t entries_fetched{0};
         uint64_t entries_written{0};
         uint64_t entries_removed{0};
+        uint64_t early_flushes{0};
         size_t cached_bytes{0};
+        uint64_t snapshots_saved{0};
+        uint64_t snapshot_deltas_saved{0};
+        size_t snapshot_bytes{0};
+        uint64_t snapshot_delta_bytes{0};
+        int64_t last_snapshot_ms{0};
+        int64_t last_snapshot_delta_ms{0};
 
         ss::metrics::metric_groups metrics;
     };
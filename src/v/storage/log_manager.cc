@@ -13,6 +13,7 @@
 #include "likely.h"
 #include "model/fundamental.h"
 #include "model/timestamp.h"
+#include "prometheus/prometheus_sanitize.h"
 #include "resource_mgmt/io_priority.h"
 #include "ssx/async-clear.h"
 #include "ssx/future-util.h"
@@ -38,6 +39,7 @@
 #include <seastar/core/future-util.hh>
 #include <seastar/core/future.hh>
 #include <seastar/core/gate.hh>
+#include <seastar/core/metrics.hh>
 #include <seastar/core/print.hh>
 #include <seastar/core/seastar.hh>
 #include <seastar/core/shared_ptr.hh>
@@ -70,6 +72,32 @@ log_manager::log_manager(
         _jitter = simple_time_jitter<ss::lowres_clock>{
           _config.compaction_interval()};
     });
+    setup_metrics();
+}
+
+void log_manager::setup_metrics() {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+
+    namespace sm = ss::metrics;
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("storage:batch_cache"),
+      {
+        sm::make_current_bytes(
+          "size_bytes",
+          [this] { return _batch_cache.size_bytes(); },
+          sm::description("Size of the cached batches")),
+        sm::make_counter(
+          "reclaims",
+          [this] { return _batch_cache.reclaims(); },
+          sm::description(
+            "Number of times cached batches were released to free memory")),
+        sm::make_total_bytes(
+          "reclaimed_bytes",
+          [this] { return _batch_cache.reclaimed_bytes(); },
+          sm::description("Bytes of cached batches released to free memory")),
+      });
 }
 void log_manager::trigger_housekeeping() {
     ssx::background = ssx::spawn_with_gate_then(_open_gate, [this] {
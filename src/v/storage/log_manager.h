@@ -32,6 +32,7 @@
 #include <seastar/core/future.hh>
 #include <seastar/core/gate.hh>
 #include <seastar/core/lowres_clock.hh>
+#include <seastar/core/metrics_registration.hh>
 #include <seastar/core/scheduling.hh>
 #include <seastar/core/sstring.hh>
 
@@ -248,6 +249,7 @@ private:
     ss::future<> housekeeping();
 
     std::optional<batch_cache_index> create_cache(with_cache);
+    void setup_metrics();
 
     ss::future<> dispatch_topic_dir_deletion(ss::sstring dir);
     ss::future<> recover_log_state(const ntp_config&);
@@ -263,6 +265,7 @@ private:
     logs_type _logs;
     compaction_list_type _logs_list;
     batch_cache _batch_cache;
+    ss::metrics::metric_groups _metrics;
     ss::gate _open_gate;
     ss::abort_source _abort_source;
 
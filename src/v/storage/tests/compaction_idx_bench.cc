@@ -8,6 +8,9 @@
 // by the Apache License, Version 2.0
 
 #include "model/fundamental.h"
+#include "model/record.h"
+#include "model/record_view.h"
+#include "model/tests/random_batch.h"
 #include "random/generators.h"
 #include "storage/compacted_index.h"
 #include "storage/compaction_reducers.h"
@@ -40,3 +43,34 @@ PERF_TEST_F(reducer_bench, compaction_key_reducer_test) {
         perf_tests::stop_measuring_time();
     });
 }
+
+/*
+ * Extracting the keys of a batch the way the compaction index is built, with
+ * materialized records and with record views.
+ */
+struct key_extraction_bench {
+    static constexpr int records = 1000;
+
+    model::record_batch batch = model::test::make_random_batch(
+      model::offset(0), records, false);
+};
+
+PERF_TEST_F(key_extraction_bench, for_each_record) {
+    perf_tests::start_measuring_time();
+    batch.for_each_record([](model::record r) {
+        perf_tests::do_not_optimize(iobuf_to_bytes(r.key()));
+        perf_tests::do_not_optimize(r.offset_delta());
+    });
+    perf_tests::stop_measuring_time();
+    return records;
+}
+
+PERF_TEST_F(key_extraction_bench, record_views) {
+    perf_tests::start_measuring_time();
+    for (const auto& r : model::record_views(batch)) {
+        perf_tests::do_not_optimize(r.copy_key());
+        perf_tests::do_not_optimize(r.offset_delta());
+    }
+    perf_tests::stop_measuring_time();
+    return records;
+}
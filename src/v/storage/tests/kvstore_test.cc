@@ -16,6 +16,8 @@
 #include <seastar/testing/thread_test_case.hh>
 #include <seastar/util/file.hh>
 
+#include <filesystem>
+
 template<typename T>
 static void set_configuration(ss::sstring p_name, T v) {
     ss::smp::invoke_on_all([p_name, v = std::move(v)] {
@@ -233,3 +235,174 @@ SEASTAR_THREAD_TEST_CASE(kvstore) {
 
     cleanup_store(dir).get();
 }
+
+static void snapshot_deltas_restart_test(size_t max_snapshot_deltas) {
+    auto dir = ssx::sformat(
+      "kvstore_test_{}", random_generators::get_int(4000));
+
+    auto conf = prepare_store(dir).get();
+    conf.max_snapshot_deltas = max_snapshot_deltas;
+
+    std::unordered_map<bytes, iobuf> truth;
+    std::vector<bytes> removed;
+
+    storage::storage_resources resources;
+    auto kvs = std::make_unique<storage::kvstore>(conf, resources);
+    kvs->start().get();
+    // small segments roll every few dozen operations
+    for (int i = 0; i < 1000; i++) {
+        auto key = random_generators::get_bytes(1);
+        auto value = bytes_to_iobuf(random_generators::get_bytes(100));
+        truth[key] = value.copy();
+        kvs->put(storage::kvstore::key_space::testing, key, std::move(value))
+          .get();
+
+        // remove keys written to earlier segments
+        if (random_generators::get_int(10) == 0) {
+            auto it = truth.begin();
+            removed.push_back(it->first);
+            kvs->remove(storage::kvstore::key_space::testing, it->first).get();
+            truth.erase(it);
+        }
+    }
+    kvs->stop().get();
+
+    // restart twice: first from the snapshot deltas, then from the snapshot
+    // saved during the first recovery
+    for (int restart = 0; restart < 2; restart++) {
+        kvs = std::make_unique<storage::kvstore>(conf, resources);
+        kvs->start().get();
+        for (auto& e : truth) {
+            BOOST_REQUIRE(
+              kvs->get(storage::kvstore::key_space::testing, e.first).value()
+              == e.second);
+        }
+        for (auto& key : removed) {
+            if (!truth.contains(key)) {
+                BOOST_REQUIRE(
+                  !kvs->get(storage::kvstore::key_space::testing, key));
+            }
+        }
+        kvs->stop().get();
+    }
+
+    cleanup_store(dir).get();
+}
+
+SEASTAR_THREAD_TEST_CASE(kvstore_snapshot_deltas) {
+    set_configuration("disable_metrics", true);
+
+    // deltas are never merged while running
+    snapshot_deltas_restart_test(1000);
+    // deltas are merged in the background
+    snapshot_deltas_restart_test(1);
+    snapshot_deltas_restart_test(3);
+}
+
+/*
+ * A version without snapshot deltas ignores them and recovers from the full
+ * snapshot followed by the segments, which must still be around.
+ */
+static void snapshot_deltas_downgrade_test(size_t max_snapshot_deltas) {
+    auto dir = ssx::sformat(
+      "kvstore_test_{}", random_generators::get_int(4000));
+
+    auto conf = prepare_store(dir).get();
+    conf.max_snapshot_deltas = max_snapshot_deltas;
+
+    std::unordered_map<bytes, iobuf> truth;
+
+    storage::storage_resources resources;
+    auto kvs = std::make_unique<storage::kvstore>(conf, resources);
+    kvs->start().get();
+    for (int i = 0; i < 1000; i++) {
+        auto key = random_generators::get_bytes(1);
+        auto value = bytes_to_iobuf(random_generators::get_bytes(100));
+        truth[key] = value.copy();
+        kvs->put(storage::kvstore::key_space::testing, key, std::move(value))
+          .get();
+    }
+    kvs->stop().get();
+
+    std::vector<std::filesystem::path> deltas;
+    for (const auto& ent :
+         std::filesystem::recursive_directory_iterator(dir.c_str())) {
+        auto name = ent.path().filename().string();
+        if (name.find(".delta.") != std::string::npos) {
+            deltas.push_back(ent.path());
+        }
+    }
+    for (const auto& p : deltas) {
+        std::filesystem::remove(p);
+    }
+
+    kvs = std::make_unique<storage::kvstore>(conf, resources);
+    kvs->start().get();
+    for (auto& e : truth) {
+        BOOST_REQUIRE(
+          kvs->get(storage::kvstore::key_space::testing, e.first).value()
+          == e.second);
+    }
+    kvs->stop().get();
+
+    cleanup_store(dir).get();
+}
+
+SEASTAR_THREAD_TEST_CASE(kvstore_snapshot_deltas_downgrade) {
+    set_configuration("disable_metrics", true);
+
+    snapshot_deltas_downgrade_test(1000);
+    snapshot_deltas_downgrade_test(3);
+}
+
+SEASTAR_THREAD_TEST_CASE(kvstore_early_flush) {
+    set_configuration("disable_metrics", true);
+
+    auto dir = ssx::sformat(
+      "kvstore_test_{}", random_generators::get_int(4000));
+
+    // the flush interval never elapses during the test
+    auto conf = prepare_store(dir).get();
+    conf.commit_interval = config::mock_binding(
+      std::chrono::milliseconds(std::chrono::hours(1)));
+    conf.flush_threshold = 10;
+
+    storage::storage_resources resources;
+    auto kvs = std::make_unique<storage::kvstore>(conf, resources);
+    kvs->start().get();
+
+    auto value = bytes_to_iobuf(random_generators::get_bytes(100));
+
+    // reaching the threshold flushes the pending operations
+    std::vector<ss::future<>> batch;
+    for (int i = 0; i < 10; i++) {
+        batch.push_back(kvs->put(
+          storage::kvstore::key_space::testing,
+          random_generators::get_bytes(2),
+          value.copy()));
+    }
+    ss::when_all_succeed(batch.begin(), batch.end()).get();
+    batch.clear();
+
+    // priority writes are flushed right away along with the pending
+    // operations
+    for (int i = 0; i < 5; i++) {
+        batch.push_back(kvs->put(
+          storage::kvstore::key_space::testing,
+          random_generators::get_bytes(2),
+          value.copy()));
+    }
+    kvs->put(
+         storage::kvstore::key_space::consensus,
+         random_generators::get_bytes(2),
+         value.copy(),
+         storage::kvstore::flush_priority::yes)
+      .get();
+    BOOST_REQUIRE(std::all_of(batch.begin(), batch.end(), [](auto& f) {
+        return f.available();
+    }));
+    ss::when_all_succeed(batch.begin(), batch.end()).get();
+
+    kvs->stop().get();
+    cleanup_store(dir).get();
+}
@@ -12,6 +12,7 @@
 
 #include "vassert.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <vector>
 
@@ -65,6 +66,40 @@ public:
         ++_size;
     }
 
+    /**
+     * Append n value initialized elements and pass each contiguous range of
+     * the new elements to fill(T*, size_t) in order. Used to populate the
+     * vector with a bulk copy when T is trivially copyable.
+     */
+    template<typename Func>
+    void append(size_t n, Func&& fill) {
+        while (n > 0) {
+            if (_size == _capacity) {
+                std::vector<T> frag;
+                frag.reserve(elems_per_frag);
+                _frags.push_back(std::move(frag));
+                _capacity += elems_per_frag;
+            }
+            auto& frag = _frags.back();
+            const auto offset = frag.size();
+            const auto count = std::min(n, elems_per_frag - offset);
+            frag.resize(offset + count);
+            _size += count;
+            n -= count;
+            fill(frag.data() + offset, count);
+        }
+    }
+
+    /**
+     * Call f(const T*, size_t) for each contiguous fragment in order.
+     */
+    template<typename Func>
+    void for_each_fragment(Func&& f) const {
+        for (const auto& frag : _frags) {
+            f(frag.data(), frag.size());
+        }
+    }
+
     void pop_back() {
         vassert(_size > 0, "Cannot pop from empty container");
         _frags.back().pop_back();
@@ -0,0 +1,87 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/bytes.h"
+#include "random/generators.h"
+#include "utils/vint.h"
+
+#include <seastar/core/reactor.hh>
+#include <seastar/testing/perf_tests.hh>
+
+#include <vector>
+
+static constexpr size_t step_values = 1000;
+
+/*
+ * Buffer of varints with values up to max_value, small values are typical for
+ * the record fields (deltas and lengths).
+ */
+static bytes make_varints(int64_t max_value) {
+    bytes buf;
+    for (size_t i = 0; i < step_values; ++i) {
+        auto v = random_generators::get_int<int64_t>(-max_value, max_value);
+        buf.append(vint::to_bytes(v).data(), vint::vint_size(v));
+    }
+    return buf;
+}
+
+static size_t bench_byte_by_byte(const bytes& buf) {
+    perf_tests::start_measuring_time();
+    size_t offset = 0;
+    for (size_t i = 0; i < step_values; ++i) {
+        auto [v, len] = vint::deserialize(
+          bytes_view(buf.data() + offset, buf.size() - offset));
+        perf_tests::do_not_optimize(v);
+        offset += len;
+    }
+    perf_tests::stop_measuring_time();
+    return step_values;
+}
+
+static size_t bench_contiguous(const bytes& buf) {
+    perf_tests::start_measuring_time();
+    size_t offset = 0;
+    for (size_t i = 0; i < step_values; ++i) {
+        auto [v, len] = vint::deserialize(
+          buf.data() + offset, buf.size() - offset);
+        perf_tests::do_not_optimize(v);
+        offset += len;
+    }
+    perf_tests::stop_measuring_time();
+    return step_values;
+}
+
+static size_t bench_bulk(const bytes& buf) {
+    std::vector<int64_t> out(step_values);
+    perf_tests::start_measuring_time();
+    auto consumed = vint::deserialize_n(
+      buf.data(), buf.size(), out.data(), out.size());
+    perf_tests::do_not_optimize(consumed);
+    perf_tests::do_not_optimize(out);
+    perf_tests::stop_measuring_time();
+    return step_values;
+}
+
+PERF_TEST(vint_byte_by_byte, small_values) {
+    return bench_byte_by_byte(make_varints(1000));
+}
+PERF_TEST(vint_contiguous, small_values) {
+    return bench_contiguous(make_varints(1000));
+}
+PERF_TEST(vint_bulk, small_values) { return bench_bulk(make_varints(1000)); }
+
+PERF_TEST(vint_byte_by_byte, large_values) {
+    return bench_byte_by_byte(make_varints(int64_t(1) << 40));
+}
+PERF_TEST(vint_contiguous, large_values) {
+    return bench_contiguous(make_varints(int64_t(1) << 40));
+}
+PERF_TEST(vint_bulk, large_values) {
+    return bench_bulk(make_varints(int64_t(1) << 40));
+}
@@ -18,6 +18,7 @@
 #include <array>
 #include <cstdint>
 #include <iostream>
+#include <limits>
 #include <random>
 
 namespace {
@@ -63,3 +64,51 @@ SEASTAR_THREAD_TEST_CASE(test_unsigned_stream_deserializer) {
       = unsigned_vint::stream_deserialize(istream).get();
     BOOST_CHECK_EQUAL(result, test_number);
 }
+
+SEASTAR_THREAD_TEST_CASE(contiguous_deserialize_matches_byte_by_byte) {
+    std::vector<int64_t> values{
+      0,
+      1,
+      -1,
+      63,
+      -64,
+      64,
+      std::numeric_limits<int32_t>::max(),
+      std::numeric_limits<int32_t>::min(),
+      std::numeric_limits<int64_t>::max(),
+      std::numeric_limits<int64_t>::min()};
+    // cover every encoded length
+    for (int shift = 0; shift < 64; ++shift) {
+        values.push_back(int64_t(1) << shift);
+        values.push_back(-(int64_t(1) << shift));
+        values.push_back(random_generators::get_int<int64_t>(
+          0, std::numeric_limits<int64_t>::max() >> (63 - shift)));
+    }
+
+    bytes buf;
+    for (auto v : values) {
+        buf.append(vint::to_bytes(v).data(), vint::vint_size(v));
+    }
+
+    // one at a time, the tail exercises the byte by byte fallback
+    size_t offset = 0;
+    for (auto v : values) {
+        auto [fast, fast_read] = vint::deserialize(
+          buf.data() + offset, buf.size() - offset);
+        auto [slow, slow_read] = vint::deserialize(
+          bytes_view(buf.data() + offset, buf.size() - offset));
+        BOOST_REQUIRE_EQUAL(fast, v);
+        BOOST_REQUIRE_EQUAL(slow, v);
+        BOOST_REQUIRE_EQUAL(fast_read, slow_read);
+        BOOST_REQUIRE_EQUAL(fast_read, vint::vint_size(v));
+        offset += fast_read;
+    }
+    BOOST_REQUIRE_EQUAL(offset, buf.size());
+
+    // all at once
+    std::vector<int64_t> decoded(values.size());
+    auto consumed = vint::deserialize_n(
+      buf.data(), buf.size(), decoded.data(), decoded.size());
+    BOOST_REQUIRE_EQUAL(consumed, buf.size());
+    BOOST_REQUIRE(decoded == values);
+}
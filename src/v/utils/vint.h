@@ -11,11 +11,15 @@
 
 #pragma once
 #include "bytes/bytes.h"
+#include "likely.h"
 
+#include <seastar/core/byteorder.hh>
 #include <seastar/core/future.hh>
 #include <seastar/core/iostream.hh>
 
+#include <bit>
 #include <cstdint>
+#include <cstring>
 
 namespace unsigned_vint {
 /// At most 5 bytes are needed to encode a 32 bit value
@@ -166,6 +170,68 @@ inline std::pair<int64_t, size_t> deserialize(Range&& r) noexcept {
     return {decode_zigzag(result), bytes_read};
 }
 
+namespace detail {
+
+/*
+ * Branchless decoding of a varint of up to 8 bytes loaded as a single little
+ * endian word: the first byte without the continuation bit gives the length
+ * and the 7 bit groups are packed together with three shift and mask steps
+ * (SWAR). Returns a length of 0 for longer varints, these are left to the
+ * byte by byte decoder.
+ */
+inline std::pair<uint64_t, size_t> decode_word(const uint8_t* src) noexcept {
+    uint64_t word;
+    std::memcpy(&word, src, sizeof(word));
+    word = ss::le_to_cpu(word);
+    const uint64_t stop_bits = ~word & 0x8080808080808080ULL;
+    if (unlikely(stop_bits == 0)) {
+        return {0, 0};
+    }
+    const size_t length = (std::countr_zero(stop_bits) >> 3) + 1;
+    // keep the bytes up to the last one of the varint, without the
+    // continuation bits
+    uint64_t x = word & (stop_bits ^ (stop_bits - 1)) & 0x7f7f7f7f7f7f7f7fULL;
+    x = ((x & 0x7f007f007f007f00ULL) >> 1) | (x & 0x007f007f007f007fULL);
+    x = ((x & 0x3fff00003fff0000ULL) >> 2) | (x & 0x00003fff00003fffULL);
+    x = ((x & 0x0fffffff00000000ULL) >> 4) | (x & 0x000000000fffffffULL);
+    return {x, length};
+}
+
+} // namespace detail
+
+/**
+ * Decode a varint from a contiguous buffer of `available` bytes. Uses the
+ * branchless decoder when a whole word can be loaded and falls back to the
+ * byte by byte decoder otherwise.
+ */
+inline std::pair<int64_t, size_t>
+deserialize(const uint8_t* src, size_t available) noexcept {
+    if (likely(available >= sizeof(uint64_t))) {
+        auto [result, bytes_read] = detail::decode_word(src);
+        if (likely(bytes_read != 0)) {
+            return {decode_zigzag(result), bytes_read};
+        }
+    }
+    return deserialize(bytes_view(src, available));
+}
+
+/**
+ * Decode `n` consecutive varints from a contiguous buffer of `available`
+ * bytes into `out`. The buffer must hold all of them. Returns the number of
+ * bytes consumed.
+ */
+inline size_t deserialize_n(
+  const uint8_t* src, size_t available, int64_t* out, size_t n) noexcept {
+    size_t consumed = 0;
+    for (size_t i = 0; i < n; ++i) {
+        auto [result, bytes_read] = deserialize(
+          src + consumed, available - consumed);
+        out[i] = result;
+        consumed += bytes_read;
+    }
+    return consumed;
+}
+
 inline bytes to_bytes(int64_t value) noexcept {
     // our bytes uses a short-string optimization of 31 bytes, at most
     // vint::max_length bytes will be used to allocate the encoded size at the
@@ -19,6 +19,8 @@
 #include <seastar/core/smp.hh>
 
 #include <exception>
+#include <mutex>
+#include <thread>
 
 namespace v8_engine {
 
@@ -41,29 +43,57 @@ ss::future<> spsc_queue::push(work_item* item) {
     auto lock = co_await _push_mutex.get_units();
 
     while (!_items.push(item)) {
+        // The executor thread signals the eventfd only when we are waiting.
+        // Check the queue again after setting the flag, otherwise the executor
+        // thread could drain the queue between the failed push and the flag.
+        _producer_waiting.store(true);
+        if (_items.push(item)) {
+            _producer_waiting.store(false);
+            break;
+        }
         co_await _is_not_full.wait();
     }
 
-    _has_element_cv.notify_one();
+    notify_consumer();
 }
 
-work_item* spsc_queue::pop() {
-    work_item* item = nullptr;
-    std::unique_lock lock{_std_mutex};
+void spsc_queue::notify_consumer() {
+    if (_consumer_parked.load()) {
+        // Take the lock so that the notification can't be delivered between
+        // the check of the predicate and the sleep of the executor thread
+        std::lock_guard lock{_std_mutex};
+        _has_element_cv.notify_one();
+    }
+}
 
-    // We need to use wait_for, because std::thread can miss notification from
-    // seastar thread (between check pred and sleep)
-    _has_element_cv.wait_for(lock, _timeout_cond_wait_std_thread_ms, [this] {
-        return !empty() || _is_stopped;
-    });
+void spsc_queue::wait_not_empty() {
+    auto spin_until = std::chrono::steady_clock::now() + _spin_before_park;
+    while (empty() && !_is_stopped) {
+        if (std::chrono::steady_clock::now() >= spin_until) {
+            std::unique_lock lock{_std_mutex};
+            _consumer_parked.store(true);
+            // The timed wait only guards against a missed notification, the
+            // producer notifies under the lock whenever we are parked
+            _has_element_cv.wait_for(
+              lock, _timeout_cond_wait_std_thread_ms, [this] {
+                  return !empty() || _is_stopped;
+              });
+            _consumer_parked.store(false);
+            return;
+        }
+        std::this_thread::yield();
+    }
+}
 
-    if (!empty()) {
-        item = _items.front();
-        _items.pop();
+size_t spsc_queue::pop_batch(batch& items) {
+    wait_not_empty();
+
+    auto popped = _items.pop(items.data(), items.size());
+    if (popped > 0 && _producer_waiting.exchange(false)) {
         _is_not_full.write_side().signal(1);
     }
 
-    return item;
+    return popped;
 }
 
 bool spsc_queue::empty() { return _items.empty(); }
@@ -118,32 +148,39 @@ void executor::pin(unsigned cpu_id) {
     vassert(r == 0, "Can not pin executor thread to core {}", cpu_id);
 }
 
+void executor::switch_watchdog(
+  internal::work_item* finished, internal::work_item* next) {
+    ss::alien::submit_to(
+      _alien_instance,
+      _watchdog_shard,
+      [this, finished, next] {
+          if (finished) {
+              cancel_watchdog(*finished);
+          }
+          if (next) {
+              rearm_watchdog(*next, next->get_timeout());
+          }
+          return ss::now();
+      })
+      .wait();
+}
+
 void executor::loop() {
+    internal::spsc_queue::batch items;
     while (!(is_stopping() && _tasks.empty())) {
-        internal::work_item* item = _tasks.pop();
-
-        if (item) {
-            ss::alien::submit_to(
-              _alien_instance,
-              _watchdog_shard,
-              [this, item] {
-                  rearm_watchdog(*item, item->get_timeout());
-                  return ss::now();
-              })
-              .wait();
-
-            item->process();
-
-            ss::alien::submit_to(
-              _alien_instance,
-              _watchdog_shard,
-              [this, item] {
-                  cancel_watchdog(*item);
-                  return ss::now();
-              })
-              .wait();
-
-            item->done();
+        auto size = _tasks.pop_batch(items);
+        if (size == 0) {
+            continue;
+        }
+
+        switch_watchdog(nullptr, items[0]);
+        for (size_t i = 0; i < size; ++i) {
+            items[i]->process();
+
+            auto* next = i + 1 < size ? items[i + 1] : nullptr;
+            switch_watchdog(items[i], next);
+
+            items[i]->done();
         }
     }
 }
@@ -25,6 +25,7 @@
 
 #include <boost/lockfree/spsc_queue.hpp>
 
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
@@ -117,11 +118,23 @@ struct task final : work_item {
 // This class implement queue for submit task from seastar to std::thread. Only
 // one core with seastar can submit task to queue. Only one std::thread can
 // consume task from queue.
+//
+// The queue is a lock-free ring. Pushing an item doesn't make a syscall unless
+// the executor thread is parked, and the executor thread takes all available
+// items at once. When the ring is empty the executor thread spins for a short
+// while before parking on the condition variable, so that a steady stream of
+// tasks doesn't pay for a cross-thread wakeup per task.
 class spsc_queue {
     static constexpr std::chrono::milliseconds _timeout_cond_wait_std_thread_ms{
       30};
+    static constexpr std::chrono::microseconds _spin_before_park{50};
 
 public:
+    // Maximum number of items returned by one pop_batch
+    static constexpr size_t max_batch_size = 64;
+
+    using batch = std::array<work_item*, max_batch_size>;
+
     explicit spsc_queue(size_t queue_size);
 
     // Close queue and break waiting on seastar mutex
@@ -130,19 +143,29 @@ public:
     // Push new item to queue. Only one future can wait on readable_eventfd
     ss::future<> push(work_item* item);
 
-    // Pop element from queue (blocking)
-    work_item* pop();
+    // Pop all available elements, up to max_batch_size (blocking). Returns the
+    // number of popped elements, zero if the queue was closed or the wait
+    // timed out.
+    size_t pop_batch(batch& items);
 
     bool empty();
 
 private:
+    // Wait until queue has elements or closed, spinning first
+    void wait_not_empty();
+
+    // Wake up executor thread if it is parked
+    void notify_consumer();
+
     mutex _push_mutex;
     seastar::readable_eventfd _is_not_full;
+    std::atomic<bool> _producer_waiting{false};
 
     std::atomic<bool> _is_stopped{false};
 
     boost::lockfree::spsc_queue<work_item*> _items;
 
+    std::atomic<bool> _consumer_parked{false};
     std::mutex _std_mutex;
     std::condition_variable _has_element_cv;
 };
@@ -150,7 +173,9 @@ private:
 } // namespace internal
 
 // This class implement executor (std::thread) for runing v8 script. It
-// uses boost::spsc_queue for storing task.
+// uses boost::spsc_queue for storing task. Tasks are taken from the queue in
+// batches, the watchdog of the finished task and the watchdog of the next task
+// in the batch are updated with a single message to the seastar shard.
 // For use we need create ss::shared<executor> and run submit like
 // executor_sharded.invoke_on(<core with executor>)
 class executor {
@@ -201,6 +226,11 @@ private:
     // Cancel watchdog
     void cancel_watchdog(internal::work_item& task);
 
+    // Cancel watchdog of the finished task and rearm it for the next one with
+    // a single message to the watchdog shard
+    void
+    switch_watchdog(internal::work_item* finished, internal::work_item* next);
+
     // We need to pin thread to core without seastar reactor
     void pin(unsigned cpu_id);
 
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "seastarx.h"
+#include "v8_engine/internal/executor.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/reactor.hh>
+#include <seastar/core/smp.hh>
+#include <seastar/core/when_all.hh>
+#include <seastar/testing/perf_tests.hh>
+
+#include <chrono>
+#include <vector>
+
+namespace {
+
+struct noop_task {
+    void operator()() {}
+
+    void cancel() {}
+
+    void on_timeout() {}
+};
+
+constexpr size_t tasks_per_run = 1000;
+constexpr size_t queue_size
+  = v8_engine::internal::spsc_queue::max_batch_size;
+constexpr auto task_timeout = std::chrono::seconds(10);
+
+} // namespace
+
+// Round trip of a single task: submit, run on the executor thread and wait
+// for the completion, one task at a time.
+PERF_TEST(v8_executor, sequential_submit) {
+    v8_engine::executor executor(ss::engine().alien(), 1, queue_size);
+
+    perf_tests::start_measuring_time();
+    for (size_t i = 0; i < tasks_per_run; ++i) {
+        co_await executor.submit(noop_task(), task_timeout);
+    }
+    perf_tests::stop_measuring_time();
+
+    co_await executor.stop();
+    co_return tasks_per_run;
+}
+
+// Throughput with the queue kept full by many concurrent submits.
+PERF_TEST(v8_executor, concurrent_submit) {
+    v8_engine::executor executor(ss::engine().alien(), 1, queue_size);
+
+    std::vector<ss::future<>> futures;
+    futures.reserve(tasks_per_run);
+
+    perf_tests::start_measuring_time();
+    for (size_t i = 0; i < tasks_per_run; ++i) {
+        futures.push_back(executor.submit(noop_task(), task_timeout));
+    }
+    co_await ss::when_all_succeed(futures.begin(), futures.end());
+    perf_tests::stop_measuring_time();
+
+    co_await executor.stop();
+    co_return tasks_per_run;
+}